@@ -187,6 +187,33 @@
 
 #endif // (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86_64)
 
+/**
+ * @macro MYSTIC_ARCH_CPU_CACHE_LINE_SIZE
+ * @brief Destructive interference size (in bytes), for padding shared data.
+ *
+ * @details
+ * Apple Arm64 cores use 128 byte lines; the other supported CPUs use 64.
+ * Can be overridden by defining it before inclusion.
+ */
+#if defined(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE)
+/**
+ * @brief Keep the user provided size.
+ */
+
+#elif (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM64) && defined(__APPLE__)
+/**
+ * @brief Set cache line size to 128 for Apple Arm64.
+ */
+# define MYSTIC_ARCH_CPU_CACHE_LINE_SIZE 128
+
+#else /* x86-64, x86, Arm64, Arm32, and unknown */
+/**
+ * @brief Set cache line size to 64.
+ */
+# define MYSTIC_ARCH_CPU_CACHE_LINE_SIZE 64
+
+#endif
+
 /* =============================================
     CPU Runtime Logic
    --------------------------------------------- */
@@ -216,6 +243,11 @@ constexpr inline const char* get_cpu_name() {
     return MYSTIC_ARCH_CPU_NAME;
 }
 
+/**
+ * @brief Cache line size (in bytes), as a constant.
+ */
+constexpr inline unsigned int kCacheLineSize = MYSTIC_ARCH_CPU_CACHE_LINE_SIZE;
+
 } // namespace cpu
 } // namespace architecture
 } // namespace mystic
@@ -100,7 +100,7 @@
  * @macro MYSTIC_ARCH_SIMD
  * @brief Tag for simd identification.
  */
-#if defined(__AVX512__) /* using AVX512 */
+#if defined(__AVX512F__) || defined(__AVX512__) /* using AVX512 */
 /**
  * @brief Set simd tag to AVX512.
  */
@@ -136,7 +136,7 @@
  */
 # define MYSTIC_ARCH_SIMD MYSTIC_ARCH_SIMD_UNKNOWN
 
-#endif // defined(__AVX512__)
+#endif // defined(__AVX512F__) || defined(__AVX512__)
 
 
 /* =============================================
@@ -202,6 +202,134 @@
 
 #endif
 
+/* =============================================
+    SIMD Instruction Set Availability
+   --------------------------------------------- */
+
+/**
+ * @macro MYSTIC_ARCH_SIMD_HAS_SSE2
+ * @brief 1 if SSE2 instructions are available, else 0.
+ *
+ * @details
+ * SSE2 is part of the x86-64 baseline, so it is available even when
+ * no wider instruction set was enabled.
+ */
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+    (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+/**
+ * @brief SSE2 is available.
+ */
+# define MYSTIC_ARCH_SIMD_HAS_SSE2 1
+
+#else /* if non-supported */
+/**
+ * @brief SSE2 is not available.
+ */
+# define MYSTIC_ARCH_SIMD_HAS_SSE2 0
+
+#endif
+
+/**
+ * @macro MYSTIC_ARCH_SIMD_HAS_AVX2
+ * @brief 1 if AVX2 instructions are available, else 0.
+ *
+ * @details
+ * AVX512 targets are supersets of AVX2, so kernels written for
+ * AVX2 are shared by both tags.
+ */
+#if (MYSTIC_ARCH_SIMD == MYSTIC_ARCH_SIMD_AVX512) || \
+    (MYSTIC_ARCH_SIMD == MYSTIC_ARCH_SIMD_AVX2)
+/**
+ * @brief AVX2 is available.
+ */
+# define MYSTIC_ARCH_SIMD_HAS_AVX2 1
+
+#else /* if non-supported */
+/**
+ * @brief AVX2 is not available.
+ */
+# define MYSTIC_ARCH_SIMD_HAS_AVX2 0
+
+#endif
+
+/**
+ * @macro MYSTIC_ARCH_SIMD_HAS_AVX512BW
+ * @brief 1 if AVX512 byte, and word instructions are available, else 0.
+ */
+#if (MYSTIC_ARCH_SIMD == MYSTIC_ARCH_SIMD_AVX512) && defined(__AVX512BW__)
+/**
+ * @brief AVX512BW is available.
+ */
+# define MYSTIC_ARCH_SIMD_HAS_AVX512BW 1
+
+#else /* if non-supported */
+/**
+ * @brief AVX512BW is not available.
+ */
+# define MYSTIC_ARCH_SIMD_HAS_AVX512BW 0
+
+#endif
+
+/**
+ * @macro MYSTIC_ARCH_SIMD_HAS_AVX512VBMI
+ * @brief 1 if AVX512 byte permutation (VBMI) instructions are available, else 0.
+ */
+#if MYSTIC_ARCH_SIMD_HAS_AVX512BW && defined(__AVX512VBMI__)
+/**
+ * @brief AVX512VBMI is available.
+ */
+# define MYSTIC_ARCH_SIMD_HAS_AVX512VBMI 1
+
+#else /* if non-supported */
+/**
+ * @brief AVX512VBMI is not available.
+ */
+# define MYSTIC_ARCH_SIMD_HAS_AVX512VBMI 0
+
+#endif
+
+/**
+ * @macro MYSTIC_ARCH_SIMD_HAS_AVX512VPOPCNTDQ
+ * @brief 1 if AVX512 vector population count instructions are available, else 0.
+ */
+#if (MYSTIC_ARCH_SIMD == MYSTIC_ARCH_SIMD_AVX512) && defined(__AVX512VPOPCNTDQ__)
+/**
+ * @brief AVX512VPOPCNTDQ is available.
+ */
+# define MYSTIC_ARCH_SIMD_HAS_AVX512VPOPCNTDQ 1
+
+#else /* if non-supported */
+/**
+ * @brief AVX512VPOPCNTDQ is not available.
+ */
+# define MYSTIC_ARCH_SIMD_HAS_AVX512VPOPCNTDQ 0
+
+#endif
+
+/**
+ * @macro MYSTIC_ARCH_SIMD_HAS_NEON
+ * @brief 1 if NEON (Advanced SIMD) instructions are available, else 0.
+ *
+ * @details
+ * SVE, and SVE2 targets always carry NEON as well, so kernels written
+ * for NEON are shared by all three tags.
+ */
+#if ((MYSTIC_ARCH_SIMD == MYSTIC_ARCH_SIMD_NEON) || \
+     (MYSTIC_ARCH_SIMD == MYSTIC_ARCH_SIMD_SVE)  || \
+     (MYSTIC_ARCH_SIMD == MYSTIC_ARCH_SIMD_SVE2)) && defined(__ARM_NEON)
+/**
+ * @brief NEON is available.
+ */
+# define MYSTIC_ARCH_SIMD_HAS_NEON 1
+
+#else /* if non-supported */
+/**
+ * @brief NEON is not available.
+ */
+# define MYSTIC_ARCH_SIMD_HAS_NEON 0
+
+#endif
+
 /* =============================================
     SIMD Runtime Logic
    --------------------------------------------- */
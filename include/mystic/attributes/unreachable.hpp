@@ -75,7 +75,7 @@ namespace mystic {
 /**
  * @brief Function for unreachable macro in runtime.
  */
-MYSTIC_FORCEINLINE void unreachable() noexcept {
+MYSTIC_FORCEINLINE inline void unreachable() noexcept {
     MYSTIC_UNREACHABLE();
 }
 
@@ -0,0 +1,395 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/cancellation_token.hpp
+ * @file cancellation_token.hpp
+ * @brief Defines cancellation sources, tokens, and callbacks.
+ *
+ * @details
+ * A `CancellationSource` is cancelled once, with a reason (`CANCELLED`,
+ * `DEADLINE_EXCEEDED`, ...). Its `CancellationToken`s are one pointer,
+ * passed down call chains by value; polling one is a single relaxed
+ * load, and never writes shared memory.
+ *
+ * Sources form a tree: a source built from a parent token is cancelled
+ * (with the parent's reason) when the parent is. `CancellationCallback`
+ * runs a function on cancellation; the callback object is itself the
+ * list node, so registering never allocates, however many listeners a
+ * source has.
+ *
+ * Callbacks run on the cancelling thread, or in the callback constructor
+ * if the source is already cancelled. Destroying a callback while it
+ * runs on another thread waits for it to return, so its captures stay
+ * valid. Registration takes a short spin lock; polling never does.
+ *
+ * Sources are not reference counted: a source must outlive its tokens,
+ * callbacks, and child sources (the usual shape, with the source owned
+ * by the request, and children on the stack of sub-calls).
+ *
+ * This header file provides,
+ * 1. CancellationToken - Read-only view of a source.
+ * 2. CancellationSource - The cancellable state.
+ * 3. CancellationCallback - Scoped cancellation listener.
+ * 4. cancellation_status() - Token, and deadline folded into one StatusCode.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/concurrency/cancellation_token.hpp"
+ *
+ * mystic::concurrency::CancellationSource request;                  // Per request.
+ * mystic::concurrency::CancellationSource backend(request.token()); // Per sub-call.
+ *
+ * mystic::concurrency::CancellationCallback on_cancel(backend.token(), [&](mystic::status::StatusCode) {
+ *     socket.abort();
+ * });
+ *
+ * request.cancel(mystic::status::StatusCode::DEADLINE_EXCEEDED);  // Aborts the socket.
+ * backend.token().status();                                       // DEADLINE_EXCEEDED
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "mystic/concurrency/spin_lock.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/time/deadline.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Synchronization primitives.
+ */
+namespace concurrency {
+
+class CancellationSource;
+
+/**
+ * @namespace mystic::concurrency::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/**
+ * @brief Listener linked into a source; guarded by the source lock, except `finished`.
+ */
+struct CancellationNode {
+    CancellationNode* prev = nullptr;
+    CancellationNode* next = nullptr;
+    void (*invoke)(CancellationNode* node, ::mystic::status::StatusCode reason) = nullptr;
+    void* context = nullptr;
+    bool linked = false;
+    bool* destroyed = nullptr;          ///< Set by a destructor running inside the callback.
+    ::std::atomic<bool> finished{false}; ///< Callback returned (or never will run).
+};
+
+} // namespace internal
+
+/**
+ * @brief Cheap, copyable view of a `CancellationSource`.
+ *
+ * @details
+ * Default constructed tokens are never cancelled.
+ */
+class CancellationToken {
+public:
+    constexpr CancellationToken() noexcept = default;
+
+    /**
+     * @brief One relaxed load; use `status()` before acting on data the canceller published.
+     */
+    bool is_cancelled() const noexcept;
+
+    /**
+     * @brief `OK`, or the reason the source was cancelled with (acquire load).
+     */
+    ::mystic::status::StatusCode status() const noexcept;
+
+    bool can_be_cancelled() const noexcept {
+        return source_ != nullptr;
+    }
+
+    friend bool operator==(CancellationToken lhs, CancellationToken rhs) noexcept {
+        return lhs.source_ == rhs.source_;
+    }
+
+    friend bool operator!=(CancellationToken lhs, CancellationToken rhs) noexcept {
+        return lhs.source_ != rhs.source_;
+    }
+
+private:
+    friend class CancellationSource;
+
+    template <typename Fn>
+    friend class CancellationCallback;
+
+    explicit CancellationToken(const CancellationSource* source) noexcept
+        : source_(source) {}
+
+    const CancellationSource* source_ = nullptr;
+};
+
+/**
+ * @brief Cancellable state, optionally linked under a parent.
+ *
+ * @details
+ * Not copyable, or movable (tokens, and listeners point at it).
+ */
+class CancellationSource {
+public:
+    CancellationSource() noexcept = default;
+
+    /**
+     * @brief Child source, cancelled with the reason of `parent` when it is.
+     */
+    explicit CancellationSource(CancellationToken parent) noexcept
+        : parent_(parent.source_) {
+        if (parent_ != nullptr) {
+            parent_node_.invoke = &cancel_from_parent;
+            parent_node_.context = this;
+            if (!parent_->attach(&parent_node_)) {
+                cancel(parent_->status());
+            }
+        }
+    }
+
+    CancellationSource(const CancellationSource&) = delete;
+    CancellationSource& operator=(const CancellationSource&) = delete;
+
+    /**
+     * @brief Unlinks from the parent (waiting if the parent is cancelling this source right now).
+     */
+    ~CancellationSource() {
+        if (parent_ != nullptr) {
+            parent_->detach(&parent_node_);
+        }
+    }
+
+    CancellationToken token() const noexcept {
+        return CancellationToken(this);
+    }
+
+    bool is_cancelled() const noexcept {
+        return state_.load(::std::memory_order_relaxed) != 0;
+    }
+
+    ::mystic::status::StatusCode status() const noexcept {
+        return static_cast<::mystic::status::StatusCode>(state_.load(::std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Cancels with `reason` (`OK` counts as `CANCELLED`), then runs the listeners.
+     *
+     * @returns True if this call cancelled the source, false if it already was.
+     */
+    bool cancel(::mystic::status::StatusCode reason = ::mystic::status::StatusCode::CANCELLED) noexcept {
+        if (reason == ::mystic::status::StatusCode::OK) {
+            reason = ::mystic::status::StatusCode::CANCELLED;
+        }
+        ::mystic::types::uint32_t expected = 0;
+        if (!state_.compare_exchange_strong(expected, static_cast<::mystic::types::uint32_t>(reason),
+                                            ::std::memory_order_acq_rel, ::std::memory_order_acquire)) {
+            return false;
+        }
+        // Attach re-checks the state under the lock, so no listener is missed.
+        lock_.lock();
+        running_thread_ = ::std::this_thread::get_id();
+        while (head_ != nullptr) {
+            internal::CancellationNode* node = head_;
+            head_ = node->next;
+            if (head_ != nullptr) {
+                head_->prev = nullptr;
+            }
+            node->linked = false;
+            bool destroyed = false;
+            node->destroyed = &destroyed;
+            running_ = node;
+            lock_.unlock();
+
+            node->invoke(node, reason);
+
+            lock_.lock();
+            running_ = nullptr;
+            if (!destroyed) {
+                node->destroyed = nullptr;
+                node->finished.store(true, ::std::memory_order_release);
+            }
+        }
+        lock_.unlock();
+        return true;
+    }
+
+private:
+    friend class CancellationToken;
+
+    template <typename Fn>
+    friend class CancellationCallback;
+
+    static void cancel_from_parent(internal::CancellationNode* node, ::mystic::status::StatusCode reason) noexcept {
+        static_cast<CancellationSource*>(node->context)->cancel(reason);
+    }
+
+    /**
+     * @brief Links `node`; false (not linked) if the source is already cancelled.
+     */
+    bool attach(internal::CancellationNode* node) const noexcept {
+        if (state_.load(::std::memory_order_acquire) != 0) {
+            return false;
+        }
+        lock_.lock();
+        if (state_.load(::std::memory_order_acquire) != 0) {
+            lock_.unlock();
+            return false;
+        }
+        node->prev = nullptr;
+        node->next = head_;
+        if (head_ != nullptr) {
+            head_->prev = node;
+        }
+        head_ = node;
+        node->linked = true;
+        lock_.unlock();
+        return true;
+    }
+
+    /**
+     * @brief Unlinks `node`, or waits for its callback if another thread is running it.
+     */
+    void detach(internal::CancellationNode* node) const noexcept {
+        lock_.lock();
+        if (node->linked) {
+            if (node->prev != nullptr) {
+                node->prev->next = node->next;
+            } else {
+                head_ = node->next;
+            }
+            if (node->next != nullptr) {
+                node->next->prev = node->prev;
+            }
+            node->linked = false;
+            lock_.unlock();
+            return;
+        }
+        const bool running = (running_ == node);
+        const bool same_thread = running && (running_thread_ == ::std::this_thread::get_id());
+        if (same_thread) {
+            // Destroyed from inside its own callback: cancel() must not touch it again.
+            *node->destroyed = true;
+        }
+        lock_.unlock();
+        if (running && !same_thread) {
+            while (!node->finished.load(::std::memory_order_acquire)) {
+                ::std::this_thread::yield();
+            }
+        }
+    }
+
+    ::std::atomic<::mystic::types::uint32_t> state_{0}; ///< `OK` while live, else the reason.
+    mutable SpinLock lock_;
+    mutable internal::CancellationNode* head_ = nullptr;
+    mutable internal::CancellationNode* running_ = nullptr;
+    mutable ::std::thread::id running_thread_;
+    const CancellationSource* parent_ = nullptr;
+    internal::CancellationNode parent_node_;
+};
+
+inline bool CancellationToken::is_cancelled() const noexcept {
+    return (source_ != nullptr) && source_->is_cancelled();
+}
+
+inline ::mystic::status::StatusCode CancellationToken::status() const noexcept {
+    return (source_ != nullptr) ? source_->status() : ::mystic::status::StatusCode::OK;
+}
+
+/**
+ * @brief Runs `fn(reason)` (or `fn()`) once when the token's source is cancelled.
+ *
+ * @details
+ * Runs immediately in the constructor if the source already is. `fn`
+ * must not throw (it usually runs inside `cancel`, which is noexcept).
+ * Not copyable, or movable.
+ */
+template <typename Fn>
+class CancellationCallback {
+public:
+    template <typename Callable>
+    CancellationCallback(CancellationToken token, Callable&& fn)
+        : fn_(::std::forward<Callable>(fn)), source_(token.source_) {
+        node_.invoke = &run;
+        node_.context = this;
+        if ((source_ != nullptr) && !source_->attach(&node_)) {
+            call(source_->status());
+        }
+    }
+
+    CancellationCallback(const CancellationCallback&) = delete;
+    CancellationCallback& operator=(const CancellationCallback&) = delete;
+
+    ~CancellationCallback() {
+        if (source_ != nullptr) {
+            source_->detach(&node_);
+        }
+    }
+
+private:
+    static void run(internal::CancellationNode* node, ::mystic::status::StatusCode reason) {
+        static_cast<CancellationCallback*>(node->context)->call(reason);
+    }
+
+    void call(::mystic::status::StatusCode reason) {
+        if constexpr (::std::is_invocable_v<Fn&, ::mystic::status::StatusCode>) {
+            fn_(reason);
+        } else {
+            (void)reason;
+            fn_();
+        }
+    }
+
+    Fn fn_;
+    const CancellationSource* source_;
+    internal::CancellationNode node_;
+};
+
+template <typename Callable>
+CancellationCallback(CancellationToken, Callable) -> CancellationCallback<Callable>;
+
+/**
+ * @brief The token's reason if cancelled, else `DEADLINE_EXCEEDED` if the deadline passed, else `OK`.
+ */
+inline ::mystic::status::StatusCode cancellation_status(CancellationToken token, ::mystic::time::Deadline deadline) noexcept {
+    if (token.is_cancelled()) {
+        return token.status();
+    }
+    return deadline.status();
+}
+
+} // namespace concurrency
+} // namespace mystic
@@ -0,0 +1,246 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/seq_lock.hpp
+ * @file seq_lock.hpp
+ * @brief Defines a sequence lock for optimistic, lock-free reads.
+ *
+ * @details
+ * A sequence lock pairs a writer lock with a counter that is odd while a
+ * write is in progress. Readers never write shared memory: they note the
+ * counter, copy the data, and retry if the counter moved. Reads scale
+ * with the number of cores, as long as writes are comparatively rare.
+ *
+ * Data read under the lock may be torn, so readers must only copy
+ * trivially copyable values, and must not act on them before
+ * `read_retry()` returns false. Since the copy races with writers,
+ * shared data is read with `seq_load()`, and written with `seq_store()`,
+ * which go word by word through relaxed atomics: a torn copy is then
+ * merely discarded, not undefined behavior (and TSan agrees).
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/concurrency/seq_lock.hpp"
+ *
+ * mystic::concurrency::SeqLock lock;
+ * Point shared;
+ *
+ * // Writer.
+ * {
+ *     std::lock_guard<mystic::concurrency::SeqLock> guard(lock);
+ *     mystic::concurrency::seq_store(&shared, next);
+ * }
+ *
+ * // Reader.
+ * Point copy;
+ * std::uint32_t seq;
+ * do {
+ *     seq = lock.read_begin();
+ *     copy = mystic::concurrency::seq_load(&shared);
+ * } while (lock.read_retry(seq));
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <type_traits>
+
+#include "mystic/architecture/compiler_detection.hpp"
+#include "mystic/attributes/forceinline.hpp"
+#include "mystic/concurrency/spin_lock.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Synchronization primitives.
+ */
+namespace concurrency {
+
+/**
+ * @brief Sequence lock; `lock()`, and `unlock()` bracket a write.
+ */
+class SeqLock {
+public:
+    SeqLock() noexcept = default;
+
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    /**
+     * @brief Starts a read, waiting out any write in progress.
+     *
+     * @returns The sequence to pass to `read_retry()`.
+     */
+    MYSTIC_FORCEINLINE ::mystic::types::uint32_t read_begin() const noexcept {
+        ::mystic::types::uint32_t seq = sequence_.load(::std::memory_order_acquire);
+        while ((seq & 1) != 0) {
+            cpu_relax();
+            seq = sequence_.load(::std::memory_order_acquire);
+        }
+        return seq;
+    }
+
+    /**
+     * @brief Returns true if a write overlapped the read started at `seq`.
+     */
+    MYSTIC_FORCEINLINE bool read_retry(::mystic::types::uint32_t seq) const noexcept {
+        // Orders the data loads before the second sequence load.
+        ::std::atomic_thread_fence(::std::memory_order_acquire);
+        return sequence_.load(::std::memory_order_relaxed) != seq;
+    }
+
+    /**
+     * @brief Takes the writer lock, and marks a write in progress.
+     */
+    MYSTIC_FORCEINLINE void lock() noexcept {
+        writer_.lock();
+        begin_write();
+    }
+
+    MYSTIC_FORCEINLINE bool try_lock() noexcept {
+        if (!writer_.try_lock()) {
+            return false;
+        }
+        begin_write();
+        return true;
+    }
+
+    /**
+     * @brief Publishes the write, and releases the writer lock.
+     */
+    MYSTIC_FORCEINLINE void unlock() noexcept {
+        sequence_.store(sequence_.load(::std::memory_order_relaxed) + 1, ::std::memory_order_release);
+        writer_.unlock();
+    }
+
+private:
+    MYSTIC_FORCEINLINE void begin_write() noexcept {
+        sequence_.store(sequence_.load(::std::memory_order_relaxed) + 1, ::std::memory_order_relaxed);
+        // Orders the odd sequence before the data stores.
+        ::std::atomic_thread_fence(::std::memory_order_release);
+    }
+
+    ::std::atomic<::mystic::types::uint32_t> sequence_{0};
+    SpinLock writer_;
+};
+
+/**
+ * @namespace mystic::concurrency::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/**
+ * @brief Unsigned word of `Bytes` bytes, allowed to alias the object it copies.
+ */
+template <::mystic::types::size_t Bytes>
+struct SeqWord;
+
+#if (MYSTIC_ARCH_COMPILER == MYSTIC_ARCH_COMPILER_MSVC)
+template <> struct SeqWord<1> { using type = ::mystic::types::uint8_t; };
+template <> struct SeqWord<2> { using type = ::mystic::types::uint16_t; };
+template <> struct SeqWord<4> { using type = ::mystic::types::uint32_t; };
+template <> struct SeqWord<8> { using type = ::mystic::types::uint64_t; };
+#else
+// Member typedefs keep the attribute, which template arguments would drop.
+template <> struct SeqWord<1> { typedef ::mystic::types::uint8_t __attribute__((__may_alias__)) type; };
+template <> struct SeqWord<2> { typedef ::mystic::types::uint16_t __attribute__((__may_alias__)) type; };
+template <> struct SeqWord<4> { typedef ::mystic::types::uint32_t __attribute__((__may_alias__)) type; };
+template <> struct SeqWord<8> { typedef ::mystic::types::uint64_t __attribute__((__may_alias__)) type; };
+#endif
+
+/**
+ * @brief Widest word size that tiles `Type` at its alignment.
+ */
+template <typename Type>
+constexpr ::mystic::types::size_t seq_word_size() noexcept {
+    return ((alignof(Type) >= 8) && (sizeof(Type) % 8 == 0))   ? 8
+           : ((alignof(Type) >= 4) && (sizeof(Type) % 4 == 0)) ? 4
+           : ((alignof(Type) >= 2) && (sizeof(Type) % 2 == 0)) ? 2
+                                                               : 1;
+}
+
+/**
+ * @brief Copies `count` words from shared memory (relaxed loads), or to it (relaxed stores).
+ */
+template <::mystic::types::size_t Bytes, bool Store>
+inline void seq_copy(void* dest, const void* source, ::mystic::types::size_t count) noexcept {
+    using Word = typename SeqWord<Bytes>::type;
+    Word* to = static_cast<Word*>(dest);
+    const Word* from = static_cast<const Word*>(source);
+    for (::mystic::types::size_t i = 0; i < count; ++i) {
+#if (MYSTIC_ARCH_COMPILER == MYSTIC_ARCH_COMPILER_MSVC)
+        if constexpr (Store) {
+            static_cast<volatile Word*>(to)[i] = from[i];
+        } else {
+            to[i] = static_cast<const volatile Word*>(from)[i];
+        }
+#else
+        if constexpr (Store) {
+            __atomic_store_n(to + i, from[i], __ATOMIC_RELAXED);
+        } else {
+            to[i] = __atomic_load_n(from + i, __ATOMIC_RELAXED);
+        }
+#endif
+    }
+}
+
+} // namespace internal
+
+/**
+ * @brief Copies `*source`, which a writer may be changing, inside a read section.
+ *
+ * @details
+ * Each word is a relaxed atomic load, so the copy may be torn, but is
+ * never a data race; validate it with `read_retry()` before use.
+ */
+template <typename Type>
+inline Type seq_load(const Type* source) noexcept {
+    static_assert(::std::is_trivially_copyable<Type>::value, "seq_load copies trivially copyable types only");
+    static_assert(::std::is_default_constructible<Type>::value, "seq_load copies into a default-constructed value");
+    constexpr ::mystic::types::size_t kWord = internal::seq_word_size<Type>();
+    // Copying the representation into a live object is well defined for
+    // trivially copyable types; reinterpreting raw bytes is not.
+    Type copy;
+    internal::seq_copy<kWord, false>(&copy, source, sizeof(Type) / kWord);
+    return copy;
+}
+
+/**
+ * @brief Writes `value` to `*dest` under the writer lock, for readers using `seq_load()`.
+ */
+template <typename Type>
+inline void seq_store(Type* dest, const Type& value) noexcept {
+    static_assert(::std::is_trivially_copyable<Type>::value, "seq_store copies trivially copyable types only");
+    constexpr ::mystic::types::size_t kWord = internal::seq_word_size<Type>();
+    internal::seq_copy<kWord, true>(dest, &value, sizeof(Type) / kWord);
+}
+
+} // namespace concurrency
+} // namespace mystic
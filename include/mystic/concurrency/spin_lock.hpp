@@ -0,0 +1,149 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/spin_lock.hpp
+ * @file spin_lock.hpp
+ * @brief Defines a test-and-test-and-set spin lock.
+ *
+ * @details
+ * `SpinLock` is one byte of state for critical sections a few hundred
+ * nanoseconds long. Waiters spin on a plain load (so the cache line stays
+ * shared until the holder releases it), pause between probes with
+ * exponential backoff, and yield the CPU once backoff saturates so a
+ * preempted holder can run.
+ *
+ * This header file provides,
+ * 1. cpu_relax(), the spin-wait hint of the target CPU.
+ * 2. SpinLock, a `Lockable` usable with `std::lock_guard`, and `std::unique_lock`.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/concurrency/spin_lock.hpp"
+ *
+ * mystic::concurrency::SpinLock lock;
+ * {
+ *     std::lock_guard<mystic::concurrency::SpinLock> guard(lock);
+ *     ++counter;
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <thread>
+
+#include "mystic/architecture/compiler_detection.hpp"
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/attributes/forceinline.hpp"
+#include "mystic/attributes/noinline.hpp"
+#include "mystic/types/standard_int.hpp"
+
+#if (MYSTIC_ARCH_COMPILER == MYSTIC_ARCH_COMPILER_MSVC)
+# include <intrin.h>
+#elif (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86_64) || (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86)
+# include <immintrin.h>
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Synchronization primitives.
+ */
+namespace concurrency {
+
+/**
+ * @brief Tells the CPU the caller is spin-waiting (`pause`, or `yield`).
+ */
+MYSTIC_FORCEINLINE inline void cpu_relax() noexcept {
+#if (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86_64) || (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86)
+    _mm_pause();
+#elif (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM64) || (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM32)
+# if (MYSTIC_ARCH_COMPILER == MYSTIC_ARCH_COMPILER_MSVC)
+    __yield();
+# else
+    __asm__ __volatile__("yield" ::: "memory");
+# endif
+#endif
+}
+
+/**
+ * @brief Test-and-test-and-set lock with bounded exponential backoff.
+ */
+class SpinLock {
+public:
+    SpinLock() noexcept = default;
+
+    SpinLock(const SpinLock&) = delete;
+    SpinLock& operator=(const SpinLock&) = delete;
+
+    MYSTIC_FORCEINLINE void lock() noexcept {
+        if (!locked_.exchange(true, ::std::memory_order_acquire)) {
+            return;
+        }
+        lock_slow();
+    }
+
+    MYSTIC_FORCEINLINE bool try_lock() noexcept {
+        return !locked_.load(::std::memory_order_relaxed) && !locked_.exchange(true, ::std::memory_order_acquire);
+    }
+
+    MYSTIC_FORCEINLINE void unlock() noexcept {
+        locked_.store(false, ::std::memory_order_release);
+    }
+
+    /**
+     * @brief Racy snapshot; only meaningful for assertions, and statistics.
+     */
+    bool is_locked() const noexcept {
+        return locked_.load(::std::memory_order_relaxed);
+    }
+
+private:
+    /// Pauses per probe are doubled up to this, then the thread yields.
+    static constexpr ::mystic::types::uint32_t kMaxBackoff = 64;
+
+    MYSTIC_NOINLINE void lock_slow() noexcept {
+        ::mystic::types::uint32_t backoff = 1;
+        do {
+            while (locked_.load(::std::memory_order_relaxed)) {
+                if (backoff <= kMaxBackoff) {
+                    for (::mystic::types::uint32_t i = 0; i < backoff; ++i) {
+                        cpu_relax();
+                    }
+                    backoff <<= 1;
+                } else {
+                    ::std::this_thread::yield();
+                }
+            }
+        } while (locked_.exchange(true, ::std::memory_order_acquire));
+    }
+
+    ::std::atomic<bool> locked_{false};
+};
+
+} // namespace concurrency
+} // namespace mystic
@@ -0,0 +1,1270 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/btree_map.hpp
+ * @file btree_map.hpp
+ * @brief Defines a cache-friendly B+tree ordered map.
+ *
+ * @details
+ * `btree_map<K, V>` keeps its elements in leaves of a B+tree, each leaf
+ * holding dozens of keys in one contiguous array (values in a parallel
+ * array), linked to its neighbours for range iteration. Nodes span
+ * eight cache lines of the target CPU (`MYSTIC_ARCH_CPU_CACHE_LINE_SIZE`),
+ * so a lookup misses roughly once per level of a tree a fraction of the
+ * height of `std::map`.
+ *
+ * Within a node, 32, and 64-bit integer keys ordered by `std::less` are
+ * searched by counting smaller keys with SIMD compares (AVX2, SSE2, or
+ * NEON); other keys use binary search.
+ *
+ * Differences from `std::map`:
+ * 1. Iterators yield `std::pair<const K&, V&>` proxies, not references
+ *    to stored pairs.
+ * 2. Insertion, and erasure invalidate all iterators, and references.
+ * 3. Keys must be copyable (separators are copies of keys), and keys,
+ *    and values must move without throwing (nodes are reshaped in place).
+ * 4. `sorted_unique` construction, and `assign_sorted()` bulk-load
+ *    strictly ascending input in linear time.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/btree_map.hpp"
+ *
+ * mystic::btree_map<std::uint64_t, Order> orders;
+ * orders.try_emplace(id, order);
+ *
+ * // Visit ids in [lo, hi).
+ * for (auto it = orders.lower_bound(lo); it != orders.end() && it->first < hi; ++it) {
+ *     settle(it->second);
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/architecture/simd_detection.hpp"
+#include "mystic/attributes/no_unique_address.hpp"
+#include "mystic/attributes/noinline.hpp"
+#include "mystic/memory/relocate.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+#include "mystic/utility/bit.hpp"
+
+#if MYSTIC_ARCH_SIMD_HAS_AVX2 || MYSTIC_ARCH_SIMD_HAS_SSE2
+# include <immintrin.h>
+#elif MYSTIC_ARCH_SIMD_HAS_NEON && (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM64)
+# include <arm_neon.h>
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @brief Tag selecting construction from strictly ascending input.
+ */
+struct sorted_unique_t {
+    explicit sorted_unique_t() = default;
+};
+
+constexpr inline sorted_unique_t sorted_unique{};
+
+/**
+ * @namespace mystic::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/**
+ * @brief True if nodes of `Key` under `Compare` are searched with SIMD counting.
+ */
+template <typename Key, typename Compare>
+constexpr inline bool kBtreeCountSearch =
+    ::std::is_integral_v<Key> && !::std::is_same_v<Key, bool> && ((sizeof(Key) == 4) || (sizeof(Key) == 8)) &&
+    (::std::is_same_v<Compare, ::std::less<Key>> || ::std::is_same_v<Compare, ::std::less<>>);
+
+/// Bytes a node search may read past its last key.
+constexpr inline ::mystic::types::size_t kBtreeSearchOverread = 32;
+
+/**
+ * @brief Counts the sorted `keys` less than (or, with `OrEqual`, not greater than) `needle`.
+ *
+ * @details
+ * Reads whole vectors, up to `kBtreeSearchOverread` bytes past `keys + count`,
+ * and stops at the first vector holding a key not counted.
+ */
+template <bool OrEqual, typename Key>
+inline ::mystic::types::size_t btree_count(const Key* keys, ::mystic::types::size_t count, Key needle) noexcept {
+    using size_type = ::mystic::types::size_t;
+#if MYSTIC_ARCH_SIMD_HAS_AVX2
+    constexpr size_type kLanes = 32 / sizeof(Key);
+    constexpr unsigned int kAll = (1u << kLanes) - 1;
+    __m256i bias;
+    __m256i target;
+    if constexpr (sizeof(Key) == 8) {
+        bias = _mm256_set1_epi64x(::std::is_signed_v<Key> ? 0 : static_cast<long long>(1ull << 63));
+        target = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<long long>(needle)), bias);
+    } else {
+        bias = _mm256_set1_epi32(::std::is_signed_v<Key> ? 0 : static_cast<int>(1u << 31));
+        target = _mm256_xor_si256(_mm256_set1_epi32(static_cast<int>(needle)), bias);
+    }
+    for (size_type i = 0; i < count; i += kLanes) {
+        const __m256i block =
+            _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), bias);
+        __m256i counted;
+        if constexpr (sizeof(Key) == 8) {
+            counted = OrEqual ? _mm256_cmpgt_epi64(block, target) : _mm256_cmpgt_epi64(target, block);
+        } else {
+            counted = OrEqual ? _mm256_cmpgt_epi32(block, target) : _mm256_cmpgt_epi32(target, block);
+        }
+        unsigned int bits = (sizeof(Key) == 8)
+                                ? static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(counted)))
+                                : static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(counted)));
+        if constexpr (OrEqual) {
+            bits = ~bits & kAll;
+        }
+        if (count - i < kLanes) {
+            bits &= (1u << (count - i)) - 1;
+        }
+        if (bits != kAll) {
+            return i + static_cast<size_type>(::mystic::bit::popcount(bits));
+        }
+    }
+    return count;
+#elif MYSTIC_ARCH_SIMD_HAS_SSE2
+    if constexpr (sizeof(Key) == 4) {
+        constexpr size_type kLanes = 4;
+        const __m128i bias = _mm_set1_epi32(::std::is_signed_v<Key> ? 0 : static_cast<int>(1u << 31));
+        const __m128i target = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(needle)), bias);
+        for (size_type i = 0; i < count; i += kLanes) {
+            const __m128i block = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)), bias);
+            const __m128i counted = OrEqual ? _mm_cmpgt_epi32(block, target) : _mm_cmpgt_epi32(target, block);
+            unsigned int bits = static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(counted)));
+            if constexpr (OrEqual) {
+                bits = ~bits & 0xFu;
+            }
+            if (count - i < kLanes) {
+                bits &= (1u << (count - i)) - 1;
+            }
+            if (bits != 0xFu) {
+                return i + static_cast<size_type>(::mystic::bit::popcount(bits));
+            }
+        }
+        return count;
+    }
+#elif MYSTIC_ARCH_SIMD_HAS_NEON && (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM64)
+    if constexpr (sizeof(Key) == 8) {
+        for (size_type i = 0; i < count; i += 2) {
+            uint64x2_t counted;
+            if constexpr (::std::is_signed_v<Key>) {
+                const int64x2_t block = vld1q_s64(reinterpret_cast<const ::mystic::types::int64_t*>(keys + i));
+                const int64x2_t target = vdupq_n_s64(static_cast<::mystic::types::int64_t>(needle));
+                counted = OrEqual ? vcleq_s64(block, target) : vcltq_s64(block, target);
+            } else {
+                const uint64x2_t block = vld1q_u64(reinterpret_cast<const ::mystic::types::uint64_t*>(keys + i));
+                const uint64x2_t target = vdupq_n_u64(static_cast<::mystic::types::uint64_t>(needle));
+                counted = OrEqual ? vcleq_u64(block, target) : vcltq_u64(block, target);
+            }
+            size_type n = static_cast<size_type>((vgetq_lane_u64(counted, 0) & 1) + (vgetq_lane_u64(counted, 1) & 1));
+            if (count - i < 2) {
+                n = static_cast<size_type>(vgetq_lane_u64(counted, 0) & 1);
+            }
+            if (n != 2) {
+                return i + n;
+            }
+        }
+        return count;
+    } else {
+        for (size_type i = 0; i < count; i += 4) {
+            uint32x4_t counted;
+            if constexpr (::std::is_signed_v<Key>) {
+                const int32x4_t block = vld1q_s32(reinterpret_cast<const ::mystic::types::int32_t*>(keys + i));
+                const int32x4_t target = vdupq_n_s32(static_cast<::mystic::types::int32_t>(needle));
+                counted = OrEqual ? vcleq_s32(block, target) : vcltq_s32(block, target);
+            } else {
+                const uint32x4_t block = vld1q_u32(reinterpret_cast<const ::mystic::types::uint32_t*>(keys + i));
+                const uint32x4_t target = vdupq_n_u32(static_cast<::mystic::types::uint32_t>(needle));
+                counted = OrEqual ? vcleq_u32(block, target) : vcltq_u32(block, target);
+            }
+            if (count - i < 4) {
+                static constexpr ::mystic::types::uint32_t kLane[4] = {0, 1, 2, 3};
+                counted = vandq_u32(counted, vcltq_u32(vld1q_u32(kLane), vdupq_n_u32(static_cast<::mystic::types::uint32_t>(count - i))));
+            }
+            const size_type n = static_cast<size_type>(vaddvq_u32(vshrq_n_u32(counted, 31)));
+            if (n != 4) {
+                return i + n;
+            }
+        }
+        return count;
+    }
+#endif
+    // Branchless, so the compiler may vectorize it.
+    size_type counted = 0;
+    for (size_type i = 0; i < count; ++i) {
+        counted += OrEqual ? static_cast<size_type>(!(needle < keys[i])) : static_cast<size_type>(keys[i] < needle);
+    }
+    return counted;
+}
+
+} // namespace internal
+
+/**
+ * @brief Ordered map on a B+tree with cache-line sized nodes.
+ *
+ * @tparam Key Key type (copyable).
+ * @tparam Value Mapped type.
+ * @tparam Compare Strict weak ordering of keys.
+ */
+template <typename Key, typename Value, typename Compare = ::std::less<Key>>
+class btree_map {
+    static_assert(::mystic::memory::is_nothrow_relocatable_v<Key> && ::mystic::memory::is_nothrow_relocatable_v<Value>,
+                  "btree_map splits, and merges nodes in place; keys, and values must move without throwing");
+
+public:
+    using key_type        = Key;
+    using mapped_type     = Value;
+    using value_type      = ::std::pair<const Key, Value>;
+    using size_type       = ::mystic::types::size_t;
+    using difference_type = ::mystic::types::ptrdiff_t;
+    using key_compare     = Compare;
+    using reference       = ::std::pair<const Key&, Value&>;
+    using const_reference = ::std::pair<const Key&, const Value&>;
+
+private:
+    struct NodeBase {
+        ::mystic::types::uint16_t count = 0;
+        bool leaf = false;
+    };
+
+    static constexpr size_type kNodeBytes = MYSTIC_ARCH_CPU_CACHE_LINE_SIZE * 8;
+    static constexpr size_type kOverread = internal::kBtreeSearchOverread;
+
+    static constexpr size_type fit(size_type bytes, size_type per_slot) noexcept {
+        const size_type slots = (bytes > per_slot * 3) ? bytes / per_slot : 3;
+        return (slots < 256) ? slots : 256;
+    }
+
+public:
+    /// Elements per leaf.
+    static constexpr size_type kLeafSlots =
+        fit(kNodeBytes - sizeof(NodeBase) - 2 * sizeof(void*) - kOverread, sizeof(Key) + sizeof(Value));
+
+    /// Separator keys per inner node (children is one more).
+    static constexpr size_type kInnerSlots =
+        fit(kNodeBytes - sizeof(NodeBase) - sizeof(void*) - kOverread, sizeof(Key) + sizeof(void*));
+
+private:
+    static constexpr size_type kLeafMin = kLeafSlots / 2;
+    static constexpr size_type kInnerMin = kInnerSlots / 2;
+    static constexpr size_type kMaxDepth = 64;
+
+    static constexpr size_type kNodeAlign = ::std::max<size_type>(
+        {static_cast<size_type>(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE), alignof(Key), alignof(Value), alignof(void*)});
+
+    struct alignas(kNodeAlign) Leaf : NodeBase {
+        Leaf* prev = nullptr;
+        Leaf* next = nullptr;
+        alignas(Key) unsigned char key_bytes[sizeof(Key) * kLeafSlots + kOverread];
+        alignas(Value) unsigned char value_bytes[sizeof(Value) * kLeafSlots];
+
+        Leaf() noexcept {
+            this->leaf = true;
+        }
+
+        Key* keys() noexcept {
+            return reinterpret_cast<Key*>(key_bytes);
+        }
+
+        const Key* keys() const noexcept {
+            return reinterpret_cast<const Key*>(key_bytes);
+        }
+
+        Value* values() noexcept {
+            return reinterpret_cast<Value*>(value_bytes);
+        }
+
+        const Value* values() const noexcept {
+            return reinterpret_cast<const Value*>(value_bytes);
+        }
+    };
+
+    struct alignas(kNodeAlign) Inner : NodeBase {
+        alignas(Key) unsigned char key_bytes[sizeof(Key) * kInnerSlots + kOverread];
+        NodeBase* children[kInnerSlots + 1];
+
+        Key* keys() noexcept {
+            return reinterpret_cast<Key*>(key_bytes);
+        }
+
+        const Key* keys() const noexcept {
+            return reinterpret_cast<const Key*>(key_bytes);
+        }
+    };
+
+    /// Inner node, and child index taken on the way down.
+    struct PathEntry {
+        Inner* node;
+        size_type index;
+    };
+
+public:
+    /**
+     * @brief Bidirectional iterator yielding key, and value reference pairs.
+     */
+    template <bool Const>
+    class basic_iterator {
+        using leaf_pointer = ::std::conditional_t<Const, const Leaf*, Leaf*>;
+
+    public:
+        using iterator_category = ::std::bidirectional_iterator_tag;
+        using value_type        = ::std::pair<const Key, Value>;
+        using difference_type   = ::mystic::types::ptrdiff_t;
+        using reference         = ::std::conditional_t<Const, const_reference, btree_map::reference>;
+
+        /// Gives `it->first`, and `it->second` on a proxy reference.
+        struct pointer {
+            reference ref;
+
+            const reference* operator->() const noexcept {
+                return &ref;
+            }
+        };
+
+        basic_iterator() noexcept = default;
+
+        template <bool OtherConst, typename = ::std::enable_if_t<Const && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst>& other) noexcept
+            : leaf_(other.leaf_), index_(other.index_) {}
+
+        reference operator*() const noexcept {
+            return reference(leaf_->keys()[index_], leaf_->values()[index_]);
+        }
+
+        pointer operator->() const noexcept {
+            return pointer{**this};
+        }
+
+        /// Key at the iterator, without building a pair.
+        const Key& key() const noexcept {
+            return leaf_->keys()[index_];
+        }
+
+        ::std::conditional_t<Const, const Value&, Value&> value() const noexcept {
+            return leaf_->values()[index_];
+        }
+
+        basic_iterator& operator++() noexcept {
+            ++index_;
+            if ((index_ == leaf_->count) && (leaf_->next != nullptr)) {
+                leaf_ = leaf_->next;
+                index_ = 0;
+            }
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept {
+            basic_iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        basic_iterator& operator--() noexcept {
+            if (index_ == 0) {
+                leaf_ = leaf_->prev;
+                index_ = leaf_->count;
+            }
+            --index_;
+            return *this;
+        }
+
+        basic_iterator operator--(int) noexcept {
+            basic_iterator copy = *this;
+            --*this;
+            return copy;
+        }
+
+        friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+            return (lhs.leaf_ == rhs.leaf_) && (lhs.index_ == rhs.index_);
+        }
+
+        friend bool operator!=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+
+    private:
+        friend class btree_map;
+
+        template <bool>
+        friend class basic_iterator;
+
+        basic_iterator(leaf_pointer leaf, size_type index) noexcept
+            : leaf_(leaf), index_(index) {}
+
+        leaf_pointer leaf_ = nullptr;
+        size_type index_ = 0;
+    };
+
+    using iterator       = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    btree_map() noexcept = default;
+
+    explicit btree_map(const Compare& compare) noexcept
+        : compare_(compare) {}
+
+    /**
+     * @brief Bulk-loads strictly ascending `[first, last)` in linear time.
+     */
+    template <typename Iterator>
+    btree_map(sorted_unique_t, Iterator first, Iterator last, const Compare& compare = Compare())
+        : compare_(compare) {
+        assign_sorted(first, last);
+    }
+
+    template <typename Iterator>
+    btree_map(Iterator first, Iterator last, const Compare& compare = Compare())
+        : compare_(compare) {
+        insert(first, last);
+    }
+
+    btree_map(::std::initializer_list<value_type> values, const Compare& compare = Compare())
+        : compare_(compare) {
+        insert(values.begin(), values.end());
+    }
+
+    btree_map(const btree_map& other)
+        : compare_(other.compare_) {
+        assign_sorted(other.begin(), other.end());
+    }
+
+    btree_map(btree_map&& other) noexcept
+        : root_(::std::exchange(other.root_, nullptr)), leftmost_(::std::exchange(other.leftmost_, nullptr)),
+          rightmost_(::std::exchange(other.rightmost_, nullptr)), size_(::std::exchange(other.size_, 0)),
+          height_(::std::exchange(other.height_, 0)), compare_(other.compare_) {}
+
+    btree_map& operator=(const btree_map& other) {
+        if (this != &other) {
+            btree_map copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    btree_map& operator=(btree_map&& other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~btree_map() {
+        clear();
+    }
+
+    /* =============================================
+        Iteration, and Capacity
+       --------------------------------------------- */
+
+    iterator begin() noexcept {
+        return iterator(leftmost_, 0);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(leftmost_, 0);
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    iterator end() noexcept {
+        return iterator(rightmost_, (rightmost_ != nullptr) ? rightmost_->count : 0);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(rightmost_, (rightmost_ != nullptr) ? rightmost_->count : 0);
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    /**
+     * @brief Levels of inner nodes above the leaves.
+     */
+    size_type height() const noexcept {
+        return height_;
+    }
+
+    key_compare key_comp() const {
+        return compare_;
+    }
+
+    /* =============================================
+        Lookup
+       --------------------------------------------- */
+
+    iterator find(const Key& key) noexcept {
+        if (root_ == nullptr) {
+            return end();
+        }
+        Leaf* leaf = descend(key, nullptr);
+        const size_type pos = lower_index(leaf, key);
+        if ((pos == leaf->count) || compare_(key, leaf->keys()[pos])) {
+            return end();
+        }
+        return iterator(leaf, pos);
+    }
+
+    const_iterator find(const Key& key) const noexcept {
+        return const_cast<btree_map*>(this)->find(key);
+    }
+
+    bool contains(const Key& key) const noexcept {
+        return find(key) != end();
+    }
+
+    size_type count(const Key& key) const noexcept {
+        return contains(key) ? 1 : 0;
+    }
+
+    /**
+     * @brief First element not less than `key`.
+     */
+    iterator lower_bound(const Key& key) noexcept {
+        if (root_ == nullptr) {
+            return end();
+        }
+        Leaf* leaf = descend(key, nullptr);
+        return normalize(leaf, lower_index(leaf, key));
+    }
+
+    const_iterator lower_bound(const Key& key) const noexcept {
+        return const_cast<btree_map*>(this)->lower_bound(key);
+    }
+
+    /**
+     * @brief First element greater than `key`.
+     */
+    iterator upper_bound(const Key& key) noexcept {
+        if (root_ == nullptr) {
+            return end();
+        }
+        Leaf* leaf = descend(key, nullptr);
+        return normalize(leaf, upper_index(leaf, key));
+    }
+
+    const_iterator upper_bound(const Key& key) const noexcept {
+        return const_cast<btree_map*>(this)->upper_bound(key);
+    }
+
+    ::std::pair<iterator, iterator> equal_range(const Key& key) noexcept {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    ::std::pair<const_iterator, const_iterator> equal_range(const Key& key) const noexcept {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    /**
+     * @brief Returns the mapped value, inserting a value-initialized one if absent.
+     */
+    Value& operator[](const Key& key) {
+        return try_emplace(key).first.value();
+    }
+
+    Value& operator[](Key&& key) {
+        return try_emplace(::std::move(key)).first.value();
+    }
+
+    /* =============================================
+        Modifiers
+       --------------------------------------------- */
+
+    ::std::pair<iterator, bool> insert(const value_type& value) {
+        return try_emplace(value.first, value.second);
+    }
+
+    ::std::pair<iterator, bool> insert(value_type&& value) {
+        return try_emplace(::std::move(const_cast<Key&>(value.first)), ::std::move(value.second));
+    }
+
+    template <typename Iterator>
+    void insert(Iterator first, Iterator last) {
+        for (; first != last; ++first) {
+            try_emplace((*first).first, (*first).second);
+        }
+    }
+
+    void insert(::std::initializer_list<value_type> values) {
+        insert(values.begin(), values.end());
+    }
+
+    /**
+     * @brief Constructs the mapped value from `args` only if `key` is absent.
+     */
+    template <typename... Args>
+    ::std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        return emplace_key(key, ::std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    ::std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        return emplace_key(::std::move(key), ::std::forward<Args>(args)...);
+    }
+
+    template <typename Mapped>
+    ::std::pair<iterator, bool> insert_or_assign(const Key& key, Mapped&& value) {
+        ::std::pair<iterator, bool> result = try_emplace(key, ::std::forward<Mapped>(value));
+        if (!result.second) {
+            result.first.value() = ::std::forward<Mapped>(value);
+        }
+        return result;
+    }
+
+    template <typename Mapped>
+    ::std::pair<iterator, bool> insert_or_assign(Key&& key, Mapped&& value) {
+        ::std::pair<iterator, bool> result = try_emplace(::std::move(key), ::std::forward<Mapped>(value));
+        if (!result.second) {
+            result.first.value() = ::std::forward<Mapped>(value);
+        }
+        return result;
+    }
+
+    size_type erase(const Key& key) {
+        if (root_ == nullptr) {
+            return 0;
+        }
+        PathEntry path[kMaxDepth];
+        Leaf* leaf = descend(key, path);
+        const size_type pos = lower_index(leaf, key);
+        if ((pos == leaf->count) || compare_(key, leaf->keys()[pos])) {
+            return 0;
+        }
+        erase_at(path, leaf, pos);
+        return 1;
+    }
+
+    /**
+     * @brief Erases the element at `pos`, returning the next one.
+     */
+    iterator erase(const_iterator pos) {
+        Leaf* leaf = const_cast<Leaf*>(pos.leaf_);
+        const size_type index = pos.index_;
+        if ((height_ == 0) || (leaf->count > kLeafMin)) {
+            // No rebalancing, so the successor slides into `index`.
+            erase_at(nullptr, leaf, index);
+            return normalize(leaf, index);
+        }
+
+        // Rebalancing moves elements between leaves; find the successor again.
+        iterator next(leaf, index);
+        ++next;
+        if (next == end()) {
+            erase(Key(leaf->keys()[index]));
+            return end();
+        }
+        const Key successor(next.key());
+        erase(Key(leaf->keys()[index]));
+        return lower_bound(successor);
+    }
+
+    iterator erase(iterator pos) {
+        return erase(const_iterator(pos));
+    }
+
+    /**
+     * @brief Replaces the contents with strictly ascending `[first, last)`.
+     *
+     * @details
+     * Leaves, and inner nodes are filled completely (the last two of each
+     * level evenly), so a bulk-loaded tree is as short as possible.
+     */
+    template <typename Iterator>
+    void assign_sorted(Iterator first, Iterator last) {
+        clear();
+        if (first == last) {
+            return;
+        }
+        ::std::vector<NodeBase*> level;
+        ::std::vector<const Leaf*> lowest;
+#if defined(__cpp_exceptions)
+        try {
+#endif
+            build_leaves(first, last, level);
+            for (NodeBase* node : level) {
+                lowest.push_back(static_cast<const Leaf*>(node));
+            }
+            while (level.size() > 1) {
+                build_inner_level(level, lowest);
+                ++height_;
+            }
+#if defined(__cpp_exceptions)
+        } catch (...) {
+            // Leaves are linked, inner levels own their children; free by level.
+            destroy_partial(level);
+            throw;
+        }
+#endif
+        root_ = level.front();
+    }
+
+    void clear() noexcept {
+        if (root_ != nullptr) {
+            destroy(root_, height_);
+        }
+        root_ = nullptr;
+        leftmost_ = nullptr;
+        rightmost_ = nullptr;
+        size_ = 0;
+        height_ = 0;
+    }
+
+    void swap(btree_map& other) noexcept {
+        using ::std::swap;
+        swap(root_, other.root_);
+        swap(leftmost_, other.leftmost_);
+        swap(rightmost_, other.rightmost_);
+        swap(size_, other.size_);
+        swap(height_, other.height_);
+        swap(compare_, other.compare_);
+    }
+
+    friend bool operator==(const btree_map& lhs, const btree_map& rhs) {
+        if (lhs.size_ != rhs.size_) {
+            return false;
+        }
+        const_iterator it = rhs.begin();
+        for (const_iterator lt = lhs.begin(); lt != lhs.end(); ++lt, ++it) {
+            if (!(lt.key() == it.key()) || !(lt.value() == it.value())) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    friend bool operator!=(const btree_map& lhs, const btree_map& rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    /* ---------------- Search ---------------- */
+
+    /// Index of the first key not less than `key`.
+    template <typename Node>
+    size_type lower_index(const Node* node, const Key& key) const noexcept {
+        if constexpr (internal::kBtreeCountSearch<Key, Compare>) {
+            return internal::btree_count<false>(node->keys(), node->count, key);
+        } else {
+            return static_cast<size_type>(::std::lower_bound(node->keys(), node->keys() + node->count, key, compare_) -
+                                          node->keys());
+        }
+    }
+
+    /// Index of the first key greater than `key`.
+    template <typename Node>
+    size_type upper_index(const Node* node, const Key& key) const noexcept {
+        if constexpr (internal::kBtreeCountSearch<Key, Compare>) {
+            return internal::btree_count<true>(node->keys(), node->count, key);
+        } else {
+            return static_cast<size_type>(::std::upper_bound(node->keys(), node->keys() + node->count, key, compare_) -
+                                          node->keys());
+        }
+    }
+
+    /**
+     * @brief Walks to the leaf that holds, or would hold `key`, recording the path.
+     */
+    Leaf* descend(const Key& key, PathEntry* path) const noexcept {
+        NodeBase* node = root_;
+        for (size_type level = 0; level < height_; ++level) {
+            Inner* inner = static_cast<Inner*>(node);
+            const size_type index = upper_index(inner, key);
+            if (path != nullptr) {
+                path[level] = PathEntry{inner, index};
+            }
+            node = inner->children[index];
+        }
+        return static_cast<Leaf*>(node);
+    }
+
+    /// Moves a one-past-the-end leaf position to the start of the next leaf.
+    iterator normalize(Leaf* leaf, size_type index) noexcept {
+        if ((index == leaf->count) && (leaf->next != nullptr)) {
+            return iterator(leaf->next, 0);
+        }
+        return iterator(leaf, index);
+    }
+
+    /* ---------------- Insertion ---------------- */
+
+    template <typename KeyArg, typename... Args>
+    ::std::pair<iterator, bool> emplace_key(KeyArg&& key, Args&&... args) {
+        if (root_ == nullptr) {
+            Leaf* leaf = new Leaf;
+            root_ = leaf;
+            leftmost_ = leaf;
+            rightmost_ = leaf;
+        }
+        PathEntry path[kMaxDepth];
+        Leaf* leaf = descend(key, path);
+        const size_type pos = lower_index(leaf, key);
+        if ((pos != leaf->count) && !compare_(key, leaf->keys()[pos])) {
+            return {iterator(leaf, pos), false};
+        }
+
+        // Built before the tree changes, so a throwing constructor leaves it intact.
+        Key new_key(::std::forward<KeyArg>(key));
+        Value new_value(::std::forward<Args>(args)...);
+        return {insert_at(path, leaf, pos, new_key, new_value), true};
+    }
+
+    static void place(Leaf* leaf, size_type pos, Key& key, Value& value) noexcept {
+        ::mystic::memory::shift_right(leaf->keys() + pos, leaf->keys() + leaf->count, 1);
+        ::mystic::memory::shift_right(leaf->values() + pos, leaf->values() + leaf->count, 1);
+        ::new (static_cast<void*>(leaf->keys() + pos)) Key(::std::move(key));
+        ::new (static_cast<void*>(leaf->values() + pos)) Value(::std::move(value));
+        ++leaf->count;
+    }
+
+    iterator insert_at(PathEntry* path, Leaf* leaf, size_type pos, Key& key, Value& value) {
+        if (leaf->count < kLeafSlots) {
+            place(leaf, pos, key, value);
+            ++size_;
+            return iterator(leaf, pos);
+        }
+
+        // Allocate every node the split may cascade into before changing anything.
+        size_type inner_needed = 0;
+        while ((inner_needed < height_) && (path[height_ - 1 - inner_needed].node->count == kInnerSlots)) {
+            ++inner_needed;
+        }
+        if (inner_needed == height_) {
+            ++inner_needed;
+        }
+        Inner* spares[kMaxDepth + 1];
+        size_type spare_count = 0;
+        Leaf* right = new Leaf;
+#if defined(__cpp_exceptions)
+        try {
+#endif
+            for (; spare_count < inner_needed; ++spare_count) {
+                spares[spare_count] = new Inner;
+            }
+#if defined(__cpp_exceptions)
+        } catch (...) {
+            while (spare_count != 0) {
+                delete spares[--spare_count];
+            }
+            delete right;
+            throw;
+        }
+#endif
+
+        // Appending to the last leaf keeps it full, so ascending inserts pack leaves.
+        const size_type split = ((pos == leaf->count) && (leaf->next == nullptr)) ? leaf->count : (kLeafSlots + 1) / 2;
+        right->count = static_cast<::mystic::types::uint16_t>(leaf->count - split);
+        ::mystic::memory::relocate_n(leaf->keys() + split, right->count, right->keys());
+        ::mystic::memory::relocate_n(leaf->values() + split, right->count, right->values());
+        leaf->count = static_cast<::mystic::types::uint16_t>(split);
+
+        right->prev = leaf;
+        right->next = leaf->next;
+        if (leaf->next != nullptr) {
+            leaf->next->prev = right;
+        } else {
+            rightmost_ = right;
+        }
+        leaf->next = right;
+
+        Leaf* target = (pos >= split) ? right : leaf;
+        const size_type target_pos = (pos >= split) ? pos - split : pos;
+        place(target, target_pos, key, value);
+        ++size_;
+
+        alignas(Key) unsigned char separator[sizeof(Key)];
+        ::new (static_cast<void*>(separator)) Key(right->keys()[0]);
+        insert_separator(path, reinterpret_cast<Key*>(separator), right, spares);
+        return iterator(target, target_pos);
+    }
+
+    /**
+     * @brief Adds `*separator` and `right` after the child split at each level, upward.
+     *
+     * @details
+     * Consumes `*separator`, and the spare nodes (all of them are used).
+     */
+    void insert_separator(PathEntry* path, Key* separator, NodeBase* right, Inner** spares) noexcept {
+        size_type level = height_;
+        while (true) {
+            if (level == 0) {
+                Inner* root = *spares;
+                ::mystic::memory::relocate_n(separator, 1, root->keys());
+                root->children[0] = root_;
+                root->children[1] = right;
+                root->count = 1;
+                root_ = root;
+                ++height_;
+                return;
+            }
+            --level;
+            Inner* parent = path[level].node;
+            const size_type index = path[level].index;
+            const size_type count = parent->count;
+            if (count < kInnerSlots) {
+                ::mystic::memory::shift_right(parent->keys() + index, parent->keys() + count, 1);
+                ::mystic::memory::relocate_n(separator, 1, parent->keys() + index);
+                ::std::memmove(parent->children + index + 2, parent->children + index + 1,
+                               (count - index) * sizeof(NodeBase*));
+                parent->children[index + 1] = right;
+                ++parent->count;
+                return;
+            }
+
+            // Split: lay out the count + 1 keys in order, and send the median up.
+            alignas(Key) unsigned char key_bytes[sizeof(Key) * (kInnerSlots + 1)];
+            NodeBase* children[kInnerSlots + 2];
+            Key* keys = reinterpret_cast<Key*>(key_bytes);
+            ::mystic::memory::relocate_n(parent->keys(), index, keys);
+            ::mystic::memory::relocate_n(separator, 1, keys + index);
+            ::mystic::memory::relocate_n(parent->keys() + index, count - index, keys + index + 1);
+            ::std::memcpy(children, parent->children, (index + 1) * sizeof(NodeBase*));
+            children[index + 1] = right;
+            ::std::memcpy(children + index + 2, parent->children + index + 1, (count - index) * sizeof(NodeBase*));
+
+            const size_type total = count + 1;
+            const size_type mid = total / 2;
+            Inner* sibling = *spares++;
+            ::mystic::memory::relocate_n(keys, mid, parent->keys());
+            ::std::memcpy(parent->children, children, (mid + 1) * sizeof(NodeBase*));
+            parent->count = static_cast<::mystic::types::uint16_t>(mid);
+            ::mystic::memory::relocate_n(keys + mid, 1, separator);
+            ::mystic::memory::relocate_n(keys + mid + 1, total - mid - 1, sibling->keys());
+            ::std::memcpy(sibling->children, children + mid + 1, (total - mid) * sizeof(NodeBase*));
+            sibling->count = static_cast<::mystic::types::uint16_t>(total - mid - 1);
+            right = sibling;
+        }
+    }
+
+    /* ---------------- Erasure ---------------- */
+
+    /**
+     * @brief Erases `leaf[pos]`; `path` is only read if the leaf underflows.
+     */
+    void erase_at(PathEntry* path, Leaf* leaf, size_type pos) {
+        leaf->keys()[pos].~Key();
+        leaf->values()[pos].~Value();
+        ::mystic::memory::shift_left(leaf->keys() + pos, leaf->keys() + leaf->count, 1);
+        ::mystic::memory::shift_left(leaf->values() + pos, leaf->values() + leaf->count, 1);
+        --leaf->count;
+        --size_;
+        if ((height_ == 0) || (leaf->count >= kLeafMin)) {
+            return;
+        }
+        rebalance_leaf(path, leaf);
+    }
+
+    void rebalance_leaf(PathEntry* path, Leaf* leaf) {
+        Inner* parent = path[height_ - 1].node;
+        const size_type index = path[height_ - 1].index;
+        Leaf* left = (index > 0) ? static_cast<Leaf*>(parent->children[index - 1]) : nullptr;
+        Leaf* right = (index < parent->count) ? static_cast<Leaf*>(parent->children[index + 1]) : nullptr;
+
+        if ((left != nullptr) && (left->count > kLeafMin)) {
+            ::mystic::memory::shift_right(leaf->keys(), leaf->keys() + leaf->count, 1);
+            ::mystic::memory::shift_right(leaf->values(), leaf->values() + leaf->count, 1);
+            ::mystic::memory::relocate_n(left->keys() + left->count - 1, 1, leaf->keys());
+            ::mystic::memory::relocate_n(left->values() + left->count - 1, 1, leaf->values());
+            --left->count;
+            ++leaf->count;
+            parent->keys()[index - 1] = leaf->keys()[0];
+            return;
+        }
+        if ((right != nullptr) && (right->count > kLeafMin)) {
+            ::mystic::memory::relocate_n(right->keys(), 1, leaf->keys() + leaf->count);
+            ::mystic::memory::relocate_n(right->values(), 1, leaf->values() + leaf->count);
+            ::mystic::memory::shift_left(right->keys(), right->keys() + right->count, 1);
+            ::mystic::memory::shift_left(right->values(), right->values() + right->count, 1);
+            --right->count;
+            ++leaf->count;
+            parent->keys()[index] = right->keys()[0];
+            return;
+        }
+        if (left != nullptr) {
+            merge_leaves(left, leaf);
+            remove_child(path, height_ - 1, index - 1, true);
+        } else {
+            merge_leaves(leaf, right);
+            remove_child(path, height_ - 1, index, true);
+        }
+    }
+
+    /// Moves all of `right` into `left`, and frees `right`.
+    void merge_leaves(Leaf* left, Leaf* right) noexcept {
+        ::mystic::memory::relocate_n(right->keys(), right->count, left->keys() + left->count);
+        ::mystic::memory::relocate_n(right->values(), right->count, left->values() + left->count);
+        left->count = static_cast<::mystic::types::uint16_t>(left->count + right->count);
+        left->next = right->next;
+        if (right->next != nullptr) {
+            right->next->prev = left;
+        } else {
+            rightmost_ = left;
+        }
+        delete right;
+    }
+
+    /**
+     * @brief Removes key `key_index`, and the child after it from the inner node at `level`.
+     *
+     * @param destroy_key False if the key was already relocated out.
+     */
+    void remove_child(PathEntry* path, size_type level, size_type key_index, bool destroy_key) noexcept {
+        Inner* node = path[level].node;
+        if (destroy_key) {
+            node->keys()[key_index].~Key();
+        }
+        ::mystic::memory::shift_left(node->keys() + key_index, node->keys() + node->count, 1);
+        ::std::memmove(node->children + key_index + 1, node->children + key_index + 2,
+                       (node->count - key_index - 1) * sizeof(NodeBase*));
+        --node->count;
+
+        if (level == 0) {
+            if (node->count == 0) {
+                root_ = node->children[0];
+                --height_;
+                delete node;
+            }
+            return;
+        }
+        if (node->count >= kInnerMin) {
+            return;
+        }
+        rebalance_inner(path, level);
+    }
+
+    void rebalance_inner(PathEntry* path, size_type level) noexcept {
+        Inner* node = path[level].node;
+        Inner* parent = path[level - 1].node;
+        const size_type index = path[level - 1].index;
+        Inner* left = (index > 0) ? static_cast<Inner*>(parent->children[index - 1]) : nullptr;
+        Inner* right = (index < parent->count) ? static_cast<Inner*>(parent->children[index + 1]) : nullptr;
+
+        if ((left != nullptr) && (left->count > kInnerMin)) {
+            // Rotate right through the parent.
+            ::mystic::memory::shift_right(node->keys(), node->keys() + node->count, 1);
+            ::mystic::memory::relocate_n(parent->keys() + index - 1, 1, node->keys());
+            ::mystic::memory::relocate_n(left->keys() + left->count - 1, 1, parent->keys() + index - 1);
+            ::std::memmove(node->children + 1, node->children, (node->count + 1) * sizeof(NodeBase*));
+            node->children[0] = left->children[left->count];
+            --left->count;
+            ++node->count;
+            return;
+        }
+        if ((right != nullptr) && (right->count > kInnerMin)) {
+            // Rotate left through the parent.
+            ::mystic::memory::relocate_n(parent->keys() + index, 1, node->keys() + node->count);
+            ::mystic::memory::relocate_n(right->keys(), 1, parent->keys() + index);
+            ::mystic::memory::shift_left(right->keys(), right->keys() + right->count, 1);
+            node->children[node->count + 1] = right->children[0];
+            ::std::memmove(right->children, right->children + 1, right->count * sizeof(NodeBase*));
+            --right->count;
+            ++node->count;
+            return;
+        }
+        if (left != nullptr) {
+            merge_inner(left, parent->keys() + index - 1, node);
+            remove_child(path, level - 1, index - 1, false);
+        } else {
+            merge_inner(node, parent->keys() + index, right);
+            remove_child(path, level - 1, index, false);
+        }
+    }
+
+    /// Moves `*separator`, and all of `right` into `left`, and frees `right`.
+    static void merge_inner(Inner* left, Key* separator, Inner* right) noexcept {
+        ::mystic::memory::relocate_n(separator, 1, left->keys() + left->count);
+        ::mystic::memory::relocate_n(right->keys(), right->count, left->keys() + left->count + 1);
+        ::std::memcpy(left->children + left->count + 1, right->children, (right->count + 1) * sizeof(NodeBase*));
+        left->count = static_cast<::mystic::types::uint16_t>(left->count + 1 + right->count);
+        delete right;
+    }
+
+    /* ---------------- Bulk Loading ---------------- */
+
+    template <typename Iterator>
+    void build_leaves(Iterator first, Iterator last, ::std::vector<NodeBase*>& level) {
+        Leaf* leaf = nullptr;
+        for (; first != last; ++first) {
+            if ((leaf == nullptr) || (leaf->count == kLeafSlots)) {
+                if (level.size() == level.capacity()) {
+                    level.reserve(level.size() * 2 + 16);
+                }
+                Leaf* next = new Leaf;
+                next->prev = leaf;
+                if (leaf != nullptr) {
+                    leaf->next = next;
+                } else {
+                    leftmost_ = next;
+                }
+                leaf = next;
+                rightmost_ = leaf;
+                level.push_back(leaf);
+            }
+            ::new (static_cast<void*>(leaf->keys() + leaf->count)) Key((*first).first);
+#if defined(__cpp_exceptions)
+            try {
+#endif
+                ::new (static_cast<void*>(leaf->values() + leaf->count)) Value((*first).second);
+#if defined(__cpp_exceptions)
+            } catch (...) {
+                leaf->keys()[leaf->count].~Key();
+                throw;
+            }
+#endif
+            ++leaf->count;
+            ++size_;
+        }
+
+        // Even out the last two leaves, so the last is not nearly empty.
+        if ((leaf->prev != nullptr) && (leaf->count < kLeafMin)) {
+            Leaf* prev = leaf->prev;
+            const size_type move = (prev->count + leaf->count) / 2 - leaf->count;
+            ::mystic::memory::shift_right(leaf->keys(), leaf->keys() + leaf->count, move);
+            ::mystic::memory::shift_right(leaf->values(), leaf->values() + leaf->count, move);
+            ::mystic::memory::relocate_n(prev->keys() + prev->count - move, move, leaf->keys());
+            ::mystic::memory::relocate_n(prev->values() + prev->count - move, move, leaf->values());
+            prev->count = static_cast<::mystic::types::uint16_t>(prev->count - move);
+            leaf->count = static_cast<::mystic::types::uint16_t>(leaf->count + move);
+        }
+    }
+
+    /**
+     * @brief Groups `level` under new inner nodes, spreading children evenly.
+     */
+    void build_inner_level(::std::vector<NodeBase*>& level, ::std::vector<const Leaf*>& lowest) {
+        const size_type nodes = level.size();
+        const size_type groups = (nodes + kInnerSlots) / (kInnerSlots + 1);
+        const size_type base = nodes / groups;
+        const size_type extra = nodes % groups;
+
+        ::std::vector<NodeBase*> parents;
+        ::std::vector<const Leaf*> parent_lowest;
+        parents.reserve(groups);
+        parent_lowest.reserve(groups);
+        size_type next = 0;
+#if defined(__cpp_exceptions)
+        try {
+#endif
+            for (size_type group = 0; group < groups; ++group) {
+                const size_type children = base + ((group < extra) ? 1 : 0);
+                Inner* inner = new Inner;
+                parents.push_back(inner);
+                parent_lowest.push_back(lowest[next]);
+                inner->children[0] = level[next];
+                for (size_type i = 1; i < children; ++i) {
+                    ::new (static_cast<void*>(inner->keys() + i - 1)) Key(lowest[next + i]->keys()[0]);
+                    inner->children[i] = level[next + i];
+                    inner->count = static_cast<::mystic::types::uint16_t>(i);
+                }
+                next += children;
+            }
+#if defined(__cpp_exceptions)
+        } catch (...) {
+            // Free the new parents alone; `level` still owns the children.
+            for (NodeBase* parent : parents) {
+                Inner* inner = static_cast<Inner*>(parent);
+                ::std::destroy_n(inner->keys(), inner->count);
+                delete inner;
+            }
+            throw;
+        }
+#endif
+        level.swap(parents);
+        lowest.swap(parent_lowest);
+    }
+
+    /// Frees a bulk load that failed; `level` is the highest complete level.
+    void destroy_partial(::std::vector<NodeBase*>& level) noexcept {
+        for (NodeBase* node : level) {
+            destroy(node, height_);
+        }
+        level.clear();
+        root_ = nullptr;
+        leftmost_ = nullptr;
+        rightmost_ = nullptr;
+        size_ = 0;
+        height_ = 0;
+    }
+
+    /* ---------------- Destruction ---------------- */
+
+    static void destroy(NodeBase* node, size_type height) noexcept {
+        if (height == 0) {
+            Leaf* leaf = static_cast<Leaf*>(node);
+            ::std::destroy_n(leaf->keys(), leaf->count);
+            ::std::destroy_n(leaf->values(), leaf->count);
+            delete leaf;
+            return;
+        }
+        Inner* inner = static_cast<Inner*>(node);
+        for (size_type i = 0; i <= inner->count; ++i) {
+            destroy(inner->children[i], height - 1);
+        }
+        ::std::destroy_n(inner->keys(), inner->count);
+        delete inner;
+    }
+
+    NodeBase* root_ = nullptr;
+    Leaf* leftmost_ = nullptr;
+    Leaf* rightmost_ = nullptr;
+    size_type size_ = 0;
+    size_type height_ = 0;
+    MYSTIC_NO_UNIQUE_ADDRESS Compare compare_;
+};
+
+template <typename Key, typename Value, typename Compare>
+inline void swap(btree_map<Key, Value, Compare>& lhs, btree_map<Key, Value, Compare>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mystic
@@ -0,0 +1,795 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/concurrent_clock_cache.hpp
+ * @file concurrent_clock_cache.hpp
+ * @brief Defines a sharded CLOCK cache with lock-free hits.
+ *
+ * @details
+ * `concurrent_clock_cache<K, V>` bounds its contents by a byte budget
+ * (each entry carries a caller-supplied charge), and evicts with CLOCK,
+ * an LRU approximation that needs no list splicing on a hit. Keys are
+ * split over shards, each a fixed, linear-probing slot table padded to
+ * its own cache line.
+ *
+ * Hits take no lock: a lookup probes with plain loads, pins the matching
+ * slot with one reference-count increment (and the handle unpins it),
+ * marks it recently used, and bumps the shard's hit counter. Readers
+ * never wait on each other, unlike a mutex-guarded `std::list` LRU, but
+ * these are still writes: threads hitting the same entry, or the same
+ * shard, contend on its cache lines. Inserts, erasure, and eviction lock
+ * one shard.
+ *
+ * Pinned entries are never evicted, or destroyed; erasing one only hides
+ * it, and the last unpin frees it. Values therefore need not be
+ * trivially copyable: `lookup` hands out a `Handle` to the value in
+ * place, and `get` copies it out.
+ *
+ * Expiry uses a coarse clock the owner advances with `set_now` (from a
+ * timer tick, say), so hits never read the system clock. Expired
+ * entries miss, and are the first to go when room is needed.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/concurrent_clock_cache.hpp"
+ *
+ * // 64 MiB of rendered pages, at about 16 KiB each.
+ * mystic::concurrent_clock_cache<std::string, std::string> pages(64 << 20, 16 << 10);
+ *
+ * pages.insert(url, body, body.size(), 30'000'000'000); // 30 s TTL.
+ *
+ * // From any thread.
+ * if (auto page = pages.lookup(std::string_view(url))) {
+ *     respond(*page);
+ * }
+ *
+ * // From a 10 ms timer.
+ * pages.set_now(mystic::time::monotonic_ns());
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/attributes/no_unique_address.hpp"
+#include "mystic/attributes/noinline.hpp"
+#include "mystic/concurrency/spin_lock.hpp"
+#include "mystic/containers/flat_hash_table.hpp"
+#include "mystic/hash/fast_hash.hpp"
+#include "mystic/time/deadline.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+#include "mystic/utility/bit.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @brief Byte-budgeted CLOCK cache; hits are lock-free, writes lock a shard.
+ *
+ * @details
+ * Not copyable, or movable. Handles must not outlive the cache.
+ *
+ * @tparam Key Key type.
+ * @tparam Value Cached type.
+ * @tparam Hash Hasher (`hash::Hasher<Key>` by default).
+ * @tparam Equal Key equality (transparent when the hasher is).
+ */
+template <typename Key, typename Value, typename Hash = ::mystic::hash::Hasher<Key>,
+          typename Equal = typename internal::hash_default_equal<Key, Hash>::type>
+class concurrent_clock_cache {
+    struct Slot;
+    struct Shard;
+
+public:
+    using key_type    = Key;
+    using mapped_type = Value;
+    using size_type   = ::mystic::types::size_t;
+    using hasher      = Hash;
+    using key_equal   = Equal;
+
+    /// Heterogeneous lookup is enabled when both functors are transparent.
+    template <typename Lookup>
+    using key_arg = typename internal::hash_key_arg<internal::hash_is_transparent<Hash>::value &&
+                                                    internal::hash_is_transparent<Equal>::value>::template type<Lookup, Key>;
+
+    /// TTL of entries that never expire.
+    static constexpr ::mystic::types::uint64_t kNoExpiry = ~::mystic::types::uint64_t{0};
+
+    /**
+     * @brief Counter snapshot; each counter is exact, but not taken at one instant.
+     */
+    struct Stats {
+        ::mystic::types::uint64_t hits        = 0;
+        ::mystic::types::uint64_t misses      = 0; ///< Including expired entries.
+        ::mystic::types::uint64_t inserts     = 0;
+        ::mystic::types::uint64_t evictions   = 0; ///< Live entries dropped for room.
+        ::mystic::types::uint64_t expirations = 0; ///< Expired entries dropped.
+        ::mystic::types::uint64_t rejections  = 0; ///< Inserts that found no room.
+    };
+
+    /**
+     * @brief Pins one entry; the value stays valid, and unchanged while held.
+     *
+     * @details
+     * Movable, not copyable. An erased, or replaced entry is freed when
+     * its last handle goes.
+     */
+    class Handle {
+    public:
+        Handle() noexcept = default;
+
+        Handle(Handle&& other) noexcept
+            : shard_(other.shard_), slot_(other.slot_) {
+            other.shard_ = nullptr;
+            other.slot_ = nullptr;
+        }
+
+        Handle& operator=(Handle&& other) noexcept {
+            if (this != &other) {
+                reset();
+                shard_ = other.shard_;
+                slot_ = other.slot_;
+                other.shard_ = nullptr;
+                other.slot_ = nullptr;
+            }
+            return *this;
+        }
+
+        Handle(const Handle&) = delete;
+        Handle& operator=(const Handle&) = delete;
+
+        ~Handle() {
+            reset();
+        }
+
+        explicit operator bool() const noexcept {
+            return slot_ != nullptr;
+        }
+
+        /// Precondition: not empty.
+        const Key& key() const noexcept {
+            return slot_->key();
+        }
+
+        const Value& value() const noexcept {
+            return slot_->value();
+        }
+
+        const Value& operator*() const noexcept {
+            return slot_->value();
+        }
+
+        const Value* operator->() const noexcept {
+            return &slot_->value();
+        }
+
+        /**
+         * @brief Unpins the entry, if any.
+         */
+        void reset() noexcept {
+            if (slot_ != nullptr) {
+                unpin(*shard_, *slot_);
+                shard_ = nullptr;
+                slot_ = nullptr;
+            }
+        }
+
+    private:
+        friend class concurrent_clock_cache;
+
+        Handle(Shard* shard, Slot* slot) noexcept
+            : shard_(shard), slot_(slot) {}
+
+        Shard* shard_ = nullptr;
+        Slot* slot_ = nullptr;
+    };
+
+    /**
+     * @brief Empty cache holding at most `capacity` total charge.
+     *
+     * @param estimated_charge Typical entry charge, which sizes the slot
+     * tables; shards stop admitting at 3/4 slot occupancy even under
+     * budget, so underestimating wastes slots, and overestimating the
+     * budget. With the default charge of 1, `capacity` counts entries.
+     * @param shards Shard count, rounded up to a power of two; 0 picks
+     * four per hardware thread, fewer if shards would hold under 64
+     * entries. Each shard gets an equal slice of the budget.
+     */
+    explicit concurrent_clock_cache(size_type capacity, size_type estimated_charge = 1, size_type shards = 0,
+                                    const Hash& hash = Hash(), const Equal& equal = Equal())
+        : hash_(hash), equal_(equal) {
+        if (estimated_charge == 0) {
+            estimated_charge = 1;
+        }
+        const size_type entries = capacity / estimated_charge + 1;
+        if (shards == 0) {
+            const unsigned int cpus = ::std::thread::hardware_concurrency();
+            shards = static_cast<size_type>((cpus != 0) ? cpus : 1) * 4;
+            while ((shards > 1) && (entries / shards < kMinShardEntries)) {
+                shards >>= 1;
+            }
+        }
+        shards = static_cast<size_type>(::mystic::bit::bit_ceil((shards < kMaxShards) ? shards : kMaxShards));
+        shard_mask_ = shards - 1;
+        shard_shift_ = static_cast<unsigned int>((kHashBits - ::mystic::bit::countr_zero(shards)) % kHashBits);
+
+        const size_type per_shard = entries / shards + 1;
+        size_type slots = kMinSlots;
+        while (slots < per_shard * 2) {
+            slots <<= 1;
+        }
+        shards_ = new Shard[shards];
+#if defined(__cpp_exceptions)
+        try {
+#endif
+            for (size_type i = 0; i < shards; ++i) {
+                Shard& shard = shards_[i];
+                shard.slots = new Slot[slots];
+                shard.mask = slots - 1;
+                shard.occupancy_limit = slots - slots / 4;
+                shard.capacity = capacity / shards + ((i < capacity % shards) ? 1 : 0);
+            }
+#if defined(__cpp_exceptions)
+        } catch (...) {
+            for (size_type i = 0; i < shards; ++i) {
+                delete[] shards_[i].slots;
+            }
+            delete[] shards_;
+            throw;
+        }
+#endif
+        now_ns_.store(::mystic::time::monotonic_ns(), ::std::memory_order_relaxed);
+    }
+
+    concurrent_clock_cache(const concurrent_clock_cache&) = delete;
+    concurrent_clock_cache& operator=(const concurrent_clock_cache&) = delete;
+
+    /**
+     * @brief Destroys every entry. Precondition: no handles are held.
+     */
+    ~concurrent_clock_cache() {
+        for (size_type i = 0; i <= shard_mask_; ++i) {
+            Shard& shard = shards_[i];
+            for (size_type j = 0; j <= shard.mask; ++j) {
+                Slot& slot = shard.slots[j];
+                if ((slot.meta.load(::std::memory_order_relaxed) & kStateMask) >= kVisible) {
+                    slot.destroy();
+                }
+            }
+            delete[] shard.slots;
+        }
+        delete[] shards_;
+    }
+
+    /* =============================================
+        Lookup (lock-free)
+       --------------------------------------------- */
+
+    /**
+     * @brief Pins the live entry for `key`, and marks it recently used.
+     *
+     * @returns An empty handle on a miss (absent, or expired).
+     */
+    template <typename Lookup = Key>
+    Handle lookup(const key_arg<Lookup>& key) const noexcept {
+        const size_type hash = hash_(key);
+        Shard& shard = shard_for(hash);
+        Slot* slot = pin(shard, key, hash);
+        if (slot == nullptr) {
+            shard.misses.fetch_add(1, ::std::memory_order_relaxed);
+            return Handle();
+        }
+        // The pin already dirtied this line; skip the redundant store.
+        if (slot->clock.load(::std::memory_order_relaxed) != kMaxClock) {
+            slot->clock.store(kMaxClock, ::std::memory_order_relaxed);
+        }
+        shard.hits.fetch_add(1, ::std::memory_order_relaxed);
+        return Handle(&shard, slot);
+    }
+
+    /**
+     * @brief Copy of the live value for `key`, if any (counted like `lookup`).
+     */
+    template <typename Lookup = Key>
+    ::std::optional<Value> get(const key_arg<Lookup>& key) const {
+        Handle handle = lookup<Lookup>(key);
+        if (!handle) {
+            return ::std::nullopt;
+        }
+        return ::std::optional<Value>(*handle);
+    }
+
+    /**
+     * @brief True if `key` has a live entry; neither counted, nor marked used.
+     */
+    template <typename Lookup = Key>
+    bool contains(const key_arg<Lookup>& key) const noexcept {
+        const size_type hash = hash_(key);
+        Shard& shard = shard_for(hash);
+        Slot* slot = pin(shard, key, hash);
+        if (slot == nullptr) {
+            return false;
+        }
+        unpin(shard, *slot);
+        return true;
+    }
+
+    /* =============================================
+        Modifiers (lock one shard)
+       --------------------------------------------- */
+
+    /**
+     * @brief Inserts, or replaces the entry for `key`, evicting as needed.
+     *
+     * @details
+     * New entries get one CLOCK pass of grace before eviction; a hit
+     * grants the maximum. Fails, leaving `key` absent, if `charge`
+     * exceeds the shard's slice of the budget, or pinned entries leave
+     * no room.
+     *
+     * @param ttl_ns Lifetime from the current `now_ns()`.
+     * @returns True if inserted.
+     */
+    bool insert(const Key& key, Value value, size_type charge = 1, ::mystic::types::uint64_t ttl_ns = kNoExpiry) {
+        const size_type hash = hash_(key);
+        Shard& shard = shard_for(hash);
+        const ::mystic::types::uint64_t now = now_ns_.load(::std::memory_order_relaxed);
+        ::std::lock_guard<::mystic::concurrency::SpinLock> guard(shard.lock);
+        if (Slot* old = find_locked(shard, key, hash)) {
+            retire(shard, *old);
+        }
+        if ((charge > shard.capacity) || !make_room(shard, charge, now)) {
+            bump(shard.rejections);
+            return false;
+        }
+
+        Slot& slot = claim(shard, hash);
+        slot.hash.store(hash, ::std::memory_order_relaxed);
+#if defined(__cpp_exceptions)
+        try {
+#endif
+            slot.construct(key, ::std::move(value));
+#if defined(__cpp_exceptions)
+        } catch (...) {
+            release(shard, slot, false);
+            throw;
+        }
+#endif
+        slot.charge = charge;
+        slot.expiry_ns = (ttl_ns >= kNoExpiry - now) ? kNoExpiry : now + ttl_ns;
+        slot.clock.store(kInitialClock, ::std::memory_order_relaxed);
+        shard.usage.store(shard.usage.load(::std::memory_order_relaxed) + charge, ::std::memory_order_relaxed);
+        bump(shard.inserts);
+        // Readers that pin the slot from here on see the constructed entry.
+        slot.meta.fetch_add(kVisible - kBusy, ::std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the entry for `key`; pinned values live on until unpinned.
+     *
+     * @returns True if a live entry was removed.
+     */
+    template <typename Lookup = Key>
+    bool erase(const key_arg<Lookup>& key) noexcept {
+        const size_type hash = hash_(key);
+        Shard& shard = shard_for(hash);
+        ::std::lock_guard<::mystic::concurrency::SpinLock> guard(shard.lock);
+        Slot* slot = find_locked(shard, key, hash);
+        if (slot == nullptr) {
+            return false;
+        }
+        retire(shard, *slot);
+        return true;
+    }
+
+    /**
+     * @brief Drops every expired entry now, rather than when room is needed.
+     *
+     * @returns The number dropped.
+     */
+    size_type evict_expired() noexcept {
+        const ::mystic::types::uint64_t now = now_ns_.load(::std::memory_order_relaxed);
+        size_type dropped = 0;
+        for (size_type i = 0; i <= shard_mask_; ++i) {
+            Shard& shard = shards_[i];
+            ::std::lock_guard<::mystic::concurrency::SpinLock> guard(shard.lock);
+            for (size_type j = 0; j <= shard.mask; ++j) {
+                Slot& slot = shard.slots[j];
+                if (((slot.meta.load(::std::memory_order_relaxed) & kStateMask) == kVisible) && (slot.expiry_ns <= now)) {
+                    retire(shard, slot);
+                    bump(shard.expirations);
+                    ++dropped;
+                }
+            }
+        }
+        return dropped;
+    }
+
+    /**
+     * @brief Removes every entry; pinned values live on until unpinned.
+     */
+    void clear() noexcept {
+        for (size_type i = 0; i <= shard_mask_; ++i) {
+            Shard& shard = shards_[i];
+            ::std::lock_guard<::mystic::concurrency::SpinLock> guard(shard.lock);
+            for (size_type j = 0; j <= shard.mask; ++j) {
+                Slot& slot = shard.slots[j];
+                if ((slot.meta.load(::std::memory_order_relaxed) & kStateMask) == kVisible) {
+                    retire(shard, slot);
+                }
+            }
+        }
+    }
+
+    /* =============================================
+        Clock
+       --------------------------------------------- */
+
+    /**
+     * @brief Sets the coarse clock that TTLs are measured on (`monotonic_ns` at construction).
+     */
+    void set_now(::mystic::types::uint64_t now_ns) noexcept {
+        now_ns_.store(now_ns, ::std::memory_order_relaxed);
+    }
+
+    ::mystic::types::uint64_t now_ns() const noexcept {
+        return now_ns_.load(::std::memory_order_relaxed);
+    }
+
+    /* =============================================
+        Capacity
+       --------------------------------------------- */
+
+    /**
+     * @brief Resident entries, including hidden ones still pinned; approximate while writers run.
+     */
+    size_type size() const noexcept {
+        size_type total = 0;
+        for (size_type i = 0; i <= shard_mask_; ++i) {
+            total += shards_[i].occupied.load(::std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Total charge of resident entries; never above `capacity()`.
+     */
+    size_type usage() const noexcept {
+        size_type total = 0;
+        for (size_type i = 0; i <= shard_mask_; ++i) {
+            total += shards_[i].usage.load(::std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    size_type capacity() const noexcept {
+        size_type total = 0;
+        for (size_type i = 0; i <= shard_mask_; ++i) {
+            total += shards_[i].capacity;
+        }
+        return total;
+    }
+
+    size_type shard_count() const noexcept {
+        return shard_mask_ + 1;
+    }
+
+    Stats stats() const noexcept {
+        Stats stats;
+        for (size_type i = 0; i <= shard_mask_; ++i) {
+            const Shard& shard = shards_[i];
+            stats.hits += shard.hits.load(::std::memory_order_relaxed);
+            stats.misses += shard.misses.load(::std::memory_order_relaxed);
+            stats.inserts += shard.inserts.load(::std::memory_order_relaxed);
+            stats.evictions += shard.evictions.load(::std::memory_order_relaxed);
+            stats.expirations += shard.expirations.load(::std::memory_order_relaxed);
+            stats.rejections += shard.rejections.load(::std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+private:
+    static constexpr size_type kMinSlots = 16;
+    static constexpr size_type kMinShardEntries = 64;
+    static constexpr size_type kMaxShards = 1024;
+    static constexpr unsigned int kHashBits = sizeof(size_type) * 8;
+
+    /* ---------------- Slot state ---------------- */
+
+    // `meta` is the state in the low bits, plus a reference count above.
+    // Readers only ever add, and remove references, including briefly on
+    // slots that turn out not to match; the state changes only under the
+    // shard lock, by RMWs that keep those references.
+    static constexpr ::mystic::types::uint32_t kEmpty     = 0;
+    static constexpr ::mystic::types::uint32_t kBusy      = 1; ///< Being built, or destroyed, by the lock holder.
+    static constexpr ::mystic::types::uint32_t kVisible   = 2; ///< Live.
+    static constexpr ::mystic::types::uint32_t kInvisible = 3; ///< Erased, but pinned.
+    static constexpr ::mystic::types::uint32_t kStateMask = 3;
+    static constexpr ::mystic::types::uint32_t kRef       = 4;
+
+    static constexpr ::mystic::types::uint8_t kInitialClock = 1;
+    static constexpr ::mystic::types::uint8_t kMaxClock     = 3;
+
+    struct Slot {
+        ::std::atomic<::mystic::types::uint32_t> meta{kEmpty};
+        /// Entries whose probe passed over this slot; zero ends a lookup.
+        ::std::atomic<::mystic::types::uint32_t> displacements{0};
+        ::std::atomic<::mystic::types::uint8_t> clock{0};
+        ::std::atomic<size_type> hash{0};
+        size_type charge = 0;
+        ::mystic::types::uint64_t expiry_ns = 0;
+        alignas(Key) unsigned char key_bytes[sizeof(Key)];
+        alignas(Value) unsigned char value_bytes[sizeof(Value)];
+
+        Key& key() noexcept {
+            return *::std::launder(reinterpret_cast<Key*>(key_bytes));
+        }
+
+        Value& value() noexcept {
+            return *::std::launder(reinterpret_cast<Value*>(value_bytes));
+        }
+
+        void construct(const Key& key_value, Value&& mapped) {
+            ::new (static_cast<void*>(key_bytes)) Key(key_value);
+#if defined(__cpp_exceptions)
+            try {
+#endif
+                ::new (static_cast<void*>(value_bytes)) Value(::std::move(mapped));
+#if defined(__cpp_exceptions)
+            } catch (...) {
+                key().~Key();
+                throw;
+            }
+#endif
+        }
+
+        void destroy() noexcept {
+            value().~Value();
+            key().~Key();
+        }
+    };
+
+    struct alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) Shard {
+        ::mystic::concurrency::SpinLock lock;
+        Slot* slots = nullptr;
+        size_type mask = 0;
+        size_type occupancy_limit = 0;
+        size_type capacity = 0;
+        size_type hand = 0;
+        ::std::atomic<size_type> usage{0};
+        ::std::atomic<size_type> occupied{0};
+        ::std::atomic<::mystic::types::uint64_t> inserts{0};
+        ::std::atomic<::mystic::types::uint64_t> evictions{0};
+        ::std::atomic<::mystic::types::uint64_t> expirations{0};
+        ::std::atomic<::mystic::types::uint64_t> rejections{0};
+        // Written by readers; kept off the writers' line.
+        alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) ::std::atomic<::mystic::types::uint64_t> hits{0};
+        ::std::atomic<::mystic::types::uint64_t> misses{0};
+    };
+
+    /// Increments a counter only the lock holder writes.
+    static void bump(::std::atomic<::mystic::types::uint64_t>& counter) noexcept {
+        counter.store(counter.load(::std::memory_order_relaxed) + 1, ::std::memory_order_relaxed);
+    }
+
+    /// Shards take the top hash bits; slots take the bottom ones.
+    Shard& shard_for(size_type hash) const noexcept {
+        return shards_[(hash >> shard_shift_) & shard_mask_];
+    }
+
+    /* ---------------- Readers ---------------- */
+
+    /**
+     * @brief Pins the live, unexpired entry for `key`, or returns null.
+     *
+     * @details
+     * Probes with loads, and pins only a slot whose hash matches; the
+     * key is compared after pinning, since until then the slot may be
+     * recycled under the reader. May miss an entry inserted concurrently.
+     */
+    template <typename Lookup>
+    Slot* pin(Shard& shard, const Lookup& key, size_type hash) const noexcept {
+        const size_type mask = shard.mask;
+        size_type index = hash & mask;
+        for (size_type n = 0; n <= mask; ++n) {
+            Slot& slot = shard.slots[index];
+            if (((slot.meta.load(::std::memory_order_relaxed) & kStateMask) == kVisible) &&
+                (slot.hash.load(::std::memory_order_relaxed) == hash)) {
+                const ::mystic::types::uint32_t meta = slot.meta.fetch_add(kRef, ::std::memory_order_acquire);
+                if (((meta & kStateMask) == kVisible) && (slot.hash.load(::std::memory_order_relaxed) == hash) &&
+                    equal_(slot.key(), key)) {
+                    if (slot.expiry_ns > now_ns_.load(::std::memory_order_relaxed)) {
+                        return &slot;
+                    }
+                    unpin(shard, slot);
+                    return nullptr;
+                }
+                unpin(shard, slot);
+            }
+            if (slot.displacements.load(::std::memory_order_relaxed) == 0) {
+                return nullptr;
+            }
+            index = (index + 1) & mask;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Drops a reference; the last one on a hidden entry frees it.
+     */
+    static void unpin(Shard& shard, Slot& slot) noexcept {
+        if (slot.meta.fetch_sub(kRef, ::std::memory_order_acq_rel) == (kRef | kInvisible)) {
+            ::std::lock_guard<::mystic::concurrency::SpinLock> guard(shard.lock);
+            reclaim(shard, slot);
+        }
+    }
+
+    /* ---------------- Writers (shard locked) ---------------- */
+
+    template <typename Lookup>
+    Slot* find_locked(Shard& shard, const Lookup& key, size_type hash) const noexcept {
+        size_type index = hash & shard.mask;
+        for (size_type n = 0; n <= shard.mask; ++n) {
+            Slot& slot = shard.slots[index];
+            if (((slot.meta.load(::std::memory_order_relaxed) & kStateMask) == kVisible) &&
+                (slot.hash.load(::std::memory_order_relaxed) == hash) && equal_(slot.key(), key)) {
+                return &slot;
+            }
+            if (slot.displacements.load(::std::memory_order_relaxed) == 0) {
+                return nullptr;
+            }
+            index = (index + 1) & shard.mask;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Takes the first empty slot on the probe of `hash` (one exists below the occupancy limit).
+     */
+    static Slot& claim(Shard& shard, size_type hash) noexcept {
+        size_type index = hash & shard.mask;
+        while (true) {
+            Slot& slot = shard.slots[index];
+            if ((slot.meta.load(::std::memory_order_relaxed) & kStateMask) == kEmpty) {
+                slot.meta.fetch_add(kBusy, ::std::memory_order_relaxed);
+                shard.occupied.store(shard.occupied.load(::std::memory_order_relaxed) + 1, ::std::memory_order_relaxed);
+                return slot;
+            }
+            slot.displacements.store(slot.displacements.load(::std::memory_order_relaxed) + 1,
+                                     ::std::memory_order_relaxed);
+            index = (index + 1) & shard.mask;
+        }
+    }
+
+    /**
+     * @brief Returns a busy slot to empty, destroying its entry if `constructed`.
+     */
+    static void release(Shard& shard, Slot& slot, bool constructed = true) noexcept {
+        const size_type mask = shard.mask;
+        const size_type index = static_cast<size_type>(&slot - shard.slots);
+        if (constructed) {
+            slot.destroy();
+            shard.usage.store(shard.usage.load(::std::memory_order_relaxed) - slot.charge, ::std::memory_order_relaxed);
+        }
+        for (size_type i = slot.hash.load(::std::memory_order_relaxed) & mask; i != index; i = (i + 1) & mask) {
+            Slot& passed = shard.slots[i];
+            passed.displacements.store(passed.displacements.load(::std::memory_order_relaxed) - 1,
+                                       ::std::memory_order_relaxed);
+        }
+        shard.occupied.store(shard.occupied.load(::std::memory_order_relaxed) - 1, ::std::memory_order_relaxed);
+        slot.meta.fetch_sub(kBusy, ::std::memory_order_release);
+    }
+
+    /**
+     * @brief Frees a hidden entry if nobody pins it any more.
+     */
+    static void reclaim(Shard& shard, Slot& slot) noexcept {
+        ::mystic::types::uint32_t expected = kInvisible;
+        if (slot.meta.compare_exchange_strong(expected, kBusy, ::std::memory_order_acquire, ::std::memory_order_relaxed)) {
+            release(shard, slot);
+        }
+    }
+
+    /**
+     * @brief Removes a live entry now, or hides it until its last unpin.
+     */
+    static void retire(Shard& shard, Slot& slot) noexcept {
+        ::mystic::types::uint32_t expected = kVisible;
+        if (slot.meta.compare_exchange_strong(expected, kBusy, ::std::memory_order_acquire, ::std::memory_order_relaxed)) {
+            release(shard, slot);
+            return;
+        }
+        // Readers may have unpinned since the exchange failed; if none is left, free it here.
+        if (slot.meta.fetch_add(kInvisible - kVisible, ::std::memory_order_acq_rel) == kVisible) {
+            reclaim(shard, slot);
+        }
+    }
+
+    /**
+     * @brief Sweeps the CLOCK hand until `charge` fits, and a slot is free.
+     *
+     * @details
+     * Unpinned entries are dropped once their clock count runs out
+     * (at once if expired); pinned ones are skipped. Gives up after
+     * enough full turns to have run every count down, so a shard full
+     * of pinned entries rejects instead of spinning.
+     */
+    MYSTIC_NOINLINE bool make_room(Shard& shard, size_type charge, ::mystic::types::uint64_t now) noexcept {
+        const size_type limit = (shard.mask + 1) * (kMaxClock + 2);
+        for (size_type steps = 0; (shard.usage.load(::std::memory_order_relaxed) + charge > shard.capacity) ||
+                                  (shard.occupied.load(::std::memory_order_relaxed) >= shard.occupancy_limit);
+             ++steps) {
+            if (steps == limit) {
+                return false;
+            }
+            Slot& slot = shard.slots[shard.hand];
+            shard.hand = (shard.hand + 1) & shard.mask;
+            const ::mystic::types::uint32_t meta = slot.meta.load(::std::memory_order_relaxed);
+            if (meta == kInvisible) {
+                reclaim(shard, slot);
+                continue;
+            }
+            if (meta != kVisible) {
+                continue; // Empty, or pinned.
+            }
+            const bool expired = slot.expiry_ns <= now;
+            if (!expired) {
+                const ::mystic::types::uint8_t clock = slot.clock.load(::std::memory_order_relaxed);
+                if (clock != 0) {
+                    slot.clock.store(static_cast<::mystic::types::uint8_t>(clock - 1), ::std::memory_order_relaxed);
+                    continue;
+                }
+            }
+            ::mystic::types::uint32_t expected = kVisible;
+            if (slot.meta.compare_exchange_strong(expected, kBusy, ::std::memory_order_acquire,
+                                                  ::std::memory_order_relaxed)) {
+                release(shard, slot);
+                bump(expired ? shard.expirations : shard.evictions);
+            }
+        }
+        return true;
+    }
+
+    Shard* shards_ = nullptr;
+    size_type shard_mask_ = 0;
+    unsigned int shard_shift_ = 0;
+    ::std::atomic<::mystic::types::uint64_t> now_ns_{0};
+    MYSTIC_NO_UNIQUE_ADDRESS Hash hash_;
+    MYSTIC_NO_UNIQUE_ADDRESS Equal equal_;
+};
+
+} // namespace mystic
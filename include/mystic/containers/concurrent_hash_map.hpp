@@ -0,0 +1,483 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/concurrent_hash_map.hpp
+ * @file concurrent_hash_map.hpp
+ * @brief Defines a sharded hash map with lock-free reads.
+ *
+ * @details
+ * `concurrent_hash_map<K, V>` splits its keys over independent shards,
+ * each a linear-probing table guarded by a `SeqLock`, and padded to its
+ * own cache line. Writers lock one shard; readers take no lock at all,
+ * they copy the key, and value optimistically, and retry only if a write
+ * to the same shard overlapped. Read-mostly workloads therefore scale
+ * with the number of cores instead of bouncing a lock's cache line.
+ *
+ * Since readers may observe torn slots (before discarding them), keys,
+ * and values must be trivially copyable, and are returned by value.
+ * Slots are read, and written word by word through relaxed atomics
+ * (`seq_load`, `seq_store`), so those torn reads are not data races.
+ * Erasure shifts later entries back instead of leaving tombstones. Grown
+ * tables are retired, not freed, until the map is destroyed, so a reader
+ * still probing an old table never touches freed memory; growth doubles,
+ * so retired tables never outweigh the live ones.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/concurrent_hash_map.hpp"
+ *
+ * mystic::concurrent_hash_map<std::uint64_t, Route> routes;
+ * routes.insert_or_assign(prefix, route);
+ *
+ * // From any thread.
+ * if (std::optional<Route> route = routes.get(prefix)) {
+ *     forward(*route);
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <thread>
+#include <type_traits>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/attributes/no_unique_address.hpp"
+#include "mystic/attributes/noinline.hpp"
+#include "mystic/concurrency/seq_lock.hpp"
+#include "mystic/hash/fast_hash.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+#include "mystic/utility/bit.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @brief Sharded hash map; writes lock a shard, reads are lock-free.
+ *
+ * @tparam Key Key type (trivially copyable).
+ * @tparam Value Mapped type (trivially copyable).
+ * @tparam Hash Hasher (`hash::Hasher<Key>` by default).
+ * @tparam Equal Key equality.
+ */
+template <typename Key, typename Value, typename Hash = ::mystic::hash::Hasher<Key>,
+          typename Equal = ::std::equal_to<Key>>
+class concurrent_hash_map {
+    static_assert(::std::is_trivially_copyable_v<Key> && ::std::is_trivially_copyable_v<Value>,
+                  "concurrent_hash_map reads slots optimistically; keys, and values must be trivially copyable");
+
+public:
+    using key_type    = Key;
+    using mapped_type = Value;
+    using size_type   = ::mystic::types::size_t;
+    using hasher      = Hash;
+    using key_equal   = Equal;
+
+    /**
+     * @brief Empty map sized for `expected` elements.
+     *
+     * @param shards Shard count, rounded up to a power of two; 0 picks
+     * four per hardware thread.
+     */
+    explicit concurrent_hash_map(size_type expected = 0, size_type shards = 0, const Hash& hash = Hash(),
+                                 const Equal& equal = Equal())
+        : hash_(hash), equal_(equal) {
+        if (shards == 0) {
+            const unsigned int cpus = ::std::thread::hardware_concurrency();
+            shards = static_cast<size_type>((cpus != 0) ? cpus : 1) * 4;
+        }
+        shards = static_cast<size_type>(::mystic::bit::bit_ceil((shards < kMaxShards) ? shards : kMaxShards));
+        shard_mask_ = shards - 1;
+        shard_shift_ = static_cast<unsigned int>((kHashBits - ::mystic::bit::countr_zero(shards)) % kHashBits);
+
+        const size_type per_shard = expected / shards + 1;
+        size_type capacity = kMinCapacity;
+        while (capacity * 3 < per_shard * 4) {
+            capacity <<= 1;
+        }
+        shards_ = new Shard[shards];
+        for (size_type i = 0; i < shards; ++i) {
+            shards_[i].table.store(allocate_table(capacity), ::std::memory_order_relaxed);
+        }
+    }
+
+    concurrent_hash_map(const concurrent_hash_map&) = delete;
+    concurrent_hash_map& operator=(const concurrent_hash_map&) = delete;
+
+    ~concurrent_hash_map() {
+        for (size_type i = 0; i <= shard_mask_; ++i) {
+            Table* table = shards_[i].table.load(::std::memory_order_relaxed);
+            while (table != nullptr) {
+                Table* retired = table->retired;
+                deallocate_table(table);
+                table = retired;
+            }
+        }
+        delete[] shards_;
+    }
+
+    /* =============================================
+        Lookup (lock-free)
+       --------------------------------------------- */
+
+    /**
+     * @brief Returns a copy of the value mapped to `key`, if any.
+     */
+    ::std::optional<Value> get(const Key& key) const noexcept {
+        const size_type hash = hash_(key);
+        const Shard& shard = shard_for(hash);
+        while (true) {
+            const ::mystic::types::uint32_t seq = shard.lock.read_begin();
+            const Table* table = shard.table.load(::std::memory_order_acquire);
+            const size_type index = probe_racy(table, key, hash);
+            if (index == kNotFound) {
+                if (!shard.lock.read_retry(seq)) {
+                    return ::std::nullopt;
+                }
+                continue;
+            }
+            const Value value = ::mystic::concurrency::seq_load(&table->slots()[index].value);
+            if (!shard.lock.read_retry(seq)) {
+                return value;
+            }
+        }
+    }
+
+    bool contains(const Key& key) const noexcept {
+        const size_type hash = hash_(key);
+        const Shard& shard = shard_for(hash);
+        while (true) {
+            const ::mystic::types::uint32_t seq = shard.lock.read_begin();
+            const Table* table = shard.table.load(::std::memory_order_acquire);
+            const bool found = probe_racy(table, key, hash) != kNotFound;
+            if (!shard.lock.read_retry(seq)) {
+                return found;
+            }
+        }
+    }
+
+    /* =============================================
+        Modifiers (lock one shard)
+       --------------------------------------------- */
+
+    /**
+     * @brief Inserts `key` unless present.
+     *
+     * @returns True if inserted.
+     */
+    bool insert(const Key& key, const Value& value) {
+        const size_type hash = hash_(key);
+        Shard& shard = shard_for(hash);
+        ::std::lock_guard<::mystic::concurrency::SeqLock> guard(shard.lock);
+        if (find_locked(shard, key, hash) != kNotFound) {
+            return false;
+        }
+        insert_locked(shard, key, value, hash);
+        return true;
+    }
+
+    /**
+     * @brief Inserts `key`, or overwrites its value.
+     *
+     * @returns True if inserted, false if assigned.
+     */
+    bool insert_or_assign(const Key& key, const Value& value) {
+        const size_type hash = hash_(key);
+        Shard& shard = shard_for(hash);
+        ::std::lock_guard<::mystic::concurrency::SeqLock> guard(shard.lock);
+        const size_type index = find_locked(shard, key, hash);
+        if (index != kNotFound) {
+            Slot& slot = shard.table.load(::std::memory_order_relaxed)->slots()[index];
+            ::mystic::concurrency::seq_store(&slot.value, value);
+            return false;
+        }
+        insert_locked(shard, key, value, hash);
+        return true;
+    }
+
+    /**
+     * @brief Calls `fn(Value&)` on a copy of the value of `key` under the
+     * shard lock, then publishes the copy.
+     *
+     * @details
+     * Readers copy the slot concurrently, so `fn` never writes it in
+     * place; if `fn` throws, the stored value is unchanged.
+     *
+     * @returns False if `key` is absent.
+     */
+    template <typename Fn>
+    bool update(const Key& key, Fn&& fn) {
+        const size_type hash = hash_(key);
+        Shard& shard = shard_for(hash);
+        ::std::lock_guard<::mystic::concurrency::SeqLock> guard(shard.lock);
+        const size_type index = find_locked(shard, key, hash);
+        if (index == kNotFound) {
+            return false;
+        }
+        Slot& slot = shard.table.load(::std::memory_order_relaxed)->slots()[index];
+        // Only writers store to the slot, and this one holds the lock.
+        Value value = slot.value;
+        ::std::forward<Fn>(fn)(value);
+        ::mystic::concurrency::seq_store(&slot.value, value);
+        return true;
+    }
+
+    /**
+     * @brief Removes `key`, shifting its probe run back over the hole.
+     *
+     * @returns True if removed.
+     */
+    bool erase(const Key& key) noexcept {
+        const size_type hash = hash_(key);
+        Shard& shard = shard_for(hash);
+        ::std::lock_guard<::mystic::concurrency::SeqLock> guard(shard.lock);
+        const size_type found = find_locked(shard, key, hash);
+        if (found == kNotFound) {
+            return false;
+        }
+
+        Table* table = shard.table.load(::std::memory_order_relaxed);
+        Slot* slots = table->slots();
+        size_type hole = found;
+        size_type next = found;
+        while (true) {
+            next = (next + 1) & table->mask;
+            if (slots[next].full == 0) {
+                break;
+            }
+            // An entry may fill the hole only if its home is not in (hole, next].
+            const size_type home = hash_(slots[next].key) & table->mask;
+            if (((next - home) & table->mask) >= ((next - hole) & table->mask)) {
+                ::mystic::concurrency::seq_store(&slots[hole].key, slots[next].key);
+                ::mystic::concurrency::seq_store(&slots[hole].value, slots[next].value);
+                ::mystic::concurrency::seq_store(&slots[hole].full, slots[next].full);
+                hole = next;
+            }
+        }
+        ::mystic::concurrency::seq_store(&slots[hole].full, ::mystic::types::uint8_t{0});
+        shard.size.store(shard.size.load(::std::memory_order_relaxed) - 1, ::std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Removes every element; capacity, and retired tables are kept.
+     */
+    void clear() noexcept {
+        for (size_type i = 0; i <= shard_mask_; ++i) {
+            Shard& shard = shards_[i];
+            ::std::lock_guard<::mystic::concurrency::SeqLock> guard(shard.lock);
+            Table* table = shard.table.load(::std::memory_order_relaxed);
+            for (size_type j = 0; j <= table->mask; ++j) {
+                ::mystic::concurrency::seq_store(&table->slots()[j].full, ::mystic::types::uint8_t{0});
+            }
+            shard.size.store(0, ::std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Calls `fn(const Key&, const Value&)` on every element.
+     *
+     * @details
+     * Each shard is locked while it is visited, so readers of that shard
+     * wait; the map as a whole is not a snapshot.
+     */
+    template <typename Fn>
+    void for_each(Fn&& fn) {
+        for (size_type i = 0; i <= shard_mask_; ++i) {
+            Shard& shard = shards_[i];
+            ::std::lock_guard<::mystic::concurrency::SeqLock> guard(shard.lock);
+            const Table* table = shard.table.load(::std::memory_order_relaxed);
+            for (size_type j = 0; j <= table->mask; ++j) {
+                const Slot& slot = table->slots()[j];
+                if (slot.full != 0) {
+                    fn(static_cast<const Key&>(slot.key), static_cast<const Value&>(slot.value));
+                }
+            }
+        }
+    }
+
+    /* =============================================
+        Capacity
+       --------------------------------------------- */
+
+    /**
+     * @brief Element count; approximate while writers run.
+     */
+    size_type size() const noexcept {
+        size_type total = 0;
+        for (size_type i = 0; i <= shard_mask_; ++i) {
+            total += shards_[i].size.load(::std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    size_type shard_count() const noexcept {
+        return shard_mask_ + 1;
+    }
+
+private:
+    static constexpr size_type kNotFound = static_cast<size_type>(-1);
+    static constexpr size_type kMinCapacity = 8;
+    static constexpr size_type kMaxShards = 1024;
+    static constexpr unsigned int kHashBits = sizeof(size_type) * 8;
+
+    struct Slot {
+        Key key;
+        Value value;
+        ::mystic::types::uint8_t full;
+    };
+
+    static constexpr size_type kTableAlign =
+        (alignof(Slot) > MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) ? alignof(Slot) : MYSTIC_ARCH_CPU_CACHE_LINE_SIZE;
+
+    /**
+     * @brief Table header, followed by `mask + 1` slots.
+     */
+    struct alignas(kTableAlign) Table {
+        size_type mask;
+        Table* retired;
+
+        Slot* slots() noexcept {
+            return reinterpret_cast<Slot*>(this + 1);
+        }
+
+        const Slot* slots() const noexcept {
+            return reinterpret_cast<const Slot*>(this + 1);
+        }
+    };
+
+    struct alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) Shard {
+        ::mystic::concurrency::SeqLock lock;
+        ::std::atomic<Table*> table{nullptr};
+        ::std::atomic<size_type> size{0};
+    };
+
+    static Table* allocate_table(size_type capacity) {
+        void* block = ::operator new(sizeof(Table) + capacity * sizeof(Slot), ::std::align_val_t(kTableAlign));
+        ::std::memset(block, 0, sizeof(Table) + capacity * sizeof(Slot));
+        Table* table = ::new (block) Table;
+        table->mask = capacity - 1;
+        table->retired = nullptr;
+        return table;
+    }
+
+    static void deallocate_table(Table* table) noexcept {
+        ::operator delete(static_cast<void*>(table), ::std::align_val_t(kTableAlign));
+    }
+
+    /// Shards take the top hash bits; slots take the bottom ones.
+    Shard& shard_for(size_type hash) const noexcept {
+        return shards_[(hash >> shard_shift_) & shard_mask_];
+    }
+
+    /**
+     * @brief Optimistic probe; the result is only valid if the read validates.
+     *
+     * @details
+     * Bounded by the table size, since a torn view may show no empty slot.
+     */
+    size_type probe_racy(const Table* table, const Key& key, size_type hash) const noexcept {
+        const size_type mask = table->mask;
+        size_type index = hash & mask;
+        for (size_type n = 0; n <= mask; ++n) {
+            const Slot* slot = table->slots() + index;
+            if (::mystic::concurrency::seq_load(&slot->full) == 0) {
+                return kNotFound;
+            }
+            if (equal_(::mystic::concurrency::seq_load(&slot->key), key)) {
+                return index;
+            }
+            index = (index + 1) & mask;
+        }
+        return kNotFound;
+    }
+
+    size_type find_locked(const Shard& shard, const Key& key, size_type hash) const noexcept {
+        const Table* table = shard.table.load(::std::memory_order_relaxed);
+        size_type index = hash & table->mask;
+        while (table->slots()[index].full != 0) {
+            if (equal_(table->slots()[index].key, key)) {
+                return index;
+            }
+            index = (index + 1) & table->mask;
+        }
+        return kNotFound;
+    }
+
+    void insert_locked(Shard& shard, const Key& key, const Value& value, size_type hash) {
+        Table* table = shard.table.load(::std::memory_order_relaxed);
+        const size_type size = shard.size.load(::std::memory_order_relaxed);
+        if ((size + 1) * 4 > (table->mask + 1) * 3) {
+            table = grow(shard, table);
+        }
+        place(table, key, value, hash);
+        shard.size.store(size + 1, ::std::memory_order_relaxed);
+    }
+
+    static void place(Table* table, const Key& key, const Value& value, size_type hash) noexcept {
+        size_type index = hash & table->mask;
+        while (table->slots()[index].full != 0) {
+            index = (index + 1) & table->mask;
+        }
+        Slot& slot = table->slots()[index];
+        ::mystic::concurrency::seq_store(&slot.key, key);
+        ::mystic::concurrency::seq_store(&slot.value, value);
+        ::mystic::concurrency::seq_store(&slot.full, ::mystic::types::uint8_t{1});
+    }
+
+    /**
+     * @brief Rehashes into a table twice the size, and retires the old one.
+     */
+    MYSTIC_NOINLINE Table* grow(Shard& shard, Table* old_table) {
+        Table* table = allocate_table((old_table->mask + 1) * 2);
+        for (size_type i = 0; i <= old_table->mask; ++i) {
+            const Slot& slot = old_table->slots()[i];
+            if (slot.full != 0) {
+                place(table, slot.key, slot.value, hash_(slot.key));
+            }
+        }
+        table->retired = old_table;
+        shard.table.store(table, ::std::memory_order_release);
+        return table;
+    }
+
+    Shard* shards_ = nullptr;
+    size_type shard_mask_ = 0;
+    unsigned int shard_shift_ = 0;
+    MYSTIC_NO_UNIQUE_ADDRESS Hash hash_;
+    MYSTIC_NO_UNIQUE_ADDRESS Equal equal_;
+};
+
+} // namespace mystic
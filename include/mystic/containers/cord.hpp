@@ -0,0 +1,688 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/cord.hpp
+ * @file cord.hpp
+ * @brief Defines cord (rope) string type.
+ *
+ * @details
+ * This header provides a cord, a string made of chunks that are held
+ * by reference instead of being copied into one contiguous buffer.
+ *
+ * A chunk is either,
+ * 1. Borrowed, the caller keeps the bytes alive (e.g. string literals).
+ * 2. Shared, the bytes live in a ref-counted `cord_buffer`, and the
+ *    cord holds a reference.
+ *
+ * Append, and prepend are O(1) (amortized), copying a cord copies chunk
+ * descriptors only, and small copied pieces are coalesced into one
+ * owned tail buffer. The chunks can be walked as string views, or
+ * flattened into an iovec array for writev.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/cord.hpp"
+ *
+ * mystic::cord record;
+ * record.append("{\"level\":\"");          // borrowed literal
+ * record.append_copy(level_name);          // copied into tail buffer
+ * record.append(payload_buffer, 0, size);  // shared, ref-counted
+ *
+ * ::iovec iov[16];
+ * auto count = record.fill_iovec(iov, 16);
+ * ::writev(fd, iov, static_cast<int>(count));
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <string_view>
+#include <utility>
+
+#include "mystic/architecture/os_detection.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX) || (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_MACOS)
+# include <sys/uio.h>
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/* =============================================
+    Shared Buffer
+   --------------------------------------------- */
+
+class cord_buffer_ref;
+
+/**
+ * @brief Ref-counted byte buffer, whose bytes can be shared by cords.
+ *
+ * @details
+ * Header, and bytes live in a single allocation. Bytes must not be
+ * modified once a cord references them.
+ */
+class cord_buffer {
+public:
+    cord_buffer(const cord_buffer&) = delete;
+    cord_buffer& operator=(const cord_buffer&) = delete;
+
+    /**
+     * @brief Allocates a buffer with one reference.
+     *
+     * @param capacity Number of bytes.
+     *
+     * @returns Handle owning the single reference.
+     */
+    static cord_buffer_ref create(::mystic::types::size_t capacity);
+
+    /**
+     * @brief Returns the bytes.
+     */
+    char* data() noexcept {
+        return reinterpret_cast<char*>(this + 1);
+    }
+
+    /**
+     * @brief Returns the bytes.
+     */
+    const char* data() const noexcept {
+        return reinterpret_cast<const char*>(this + 1);
+    }
+
+    /**
+     * @brief Returns the capacity in bytes.
+     */
+    ::mystic::types::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    /**
+     * @brief Adds a reference.
+     */
+    void acquire() noexcept {
+        references_.fetch_add(1, ::std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Drops a reference, frees the buffer on the last one.
+     */
+    void release() noexcept {
+        if (references_.fetch_sub(1, ::std::memory_order_acq_rel) == 1) {
+            this->~cord_buffer();
+            ::operator delete(static_cast<void*>(this));
+        }
+    }
+
+    /**
+     * @brief Returns true if the caller holds the only reference.
+     */
+    bool is_unique() const noexcept {
+        return references_.load(::std::memory_order_acquire) == 1;
+    }
+
+private:
+    explicit cord_buffer(::mystic::types::size_t capacity) noexcept
+        : references_(1), capacity_(capacity) {}
+
+    ~cord_buffer() = default;
+
+    static cord_buffer* allocate(::mystic::types::size_t capacity) {
+        void* memory = ::operator new(sizeof(cord_buffer) + capacity);
+        return ::new (memory) cord_buffer(capacity);
+    }
+
+    friend class cord;
+
+    ::std::atomic<::mystic::types::uint32_t> references_;
+    ::mystic::types::size_t capacity_;
+};
+
+/**
+ * @brief Owning handle of one cord_buffer reference.
+ */
+class cord_buffer_ref {
+public:
+    constexpr cord_buffer_ref() noexcept = default;
+
+    /**
+     * @brief Adopts an existing reference (does not add one).
+     */
+    explicit cord_buffer_ref(cord_buffer* buffer) noexcept : buffer_(buffer) {}
+
+    cord_buffer_ref(const cord_buffer_ref& other) noexcept : buffer_(other.buffer_) {
+        if (buffer_ != nullptr) {
+            buffer_->acquire();
+        }
+    }
+
+    cord_buffer_ref(cord_buffer_ref&& other) noexcept : buffer_(other.buffer_) {
+        other.buffer_ = nullptr;
+    }
+
+    cord_buffer_ref& operator=(cord_buffer_ref other) noexcept {
+        ::std::swap(buffer_, other.buffer_);
+        return *this;
+    }
+
+    ~cord_buffer_ref() {
+        if (buffer_ != nullptr) {
+            buffer_->release();
+        }
+    }
+
+    cord_buffer* get() const noexcept {
+        return buffer_;
+    }
+
+    cord_buffer* operator->() const noexcept {
+        return buffer_;
+    }
+
+    explicit operator bool() const noexcept {
+        return buffer_ != nullptr;
+    }
+
+private:
+    cord_buffer* buffer_ = nullptr;
+};
+
+inline cord_buffer_ref cord_buffer::create(::mystic::types::size_t capacity) {
+    return cord_buffer_ref(allocate(capacity));
+}
+
+/* =============================================
+    Cord
+   --------------------------------------------- */
+
+/**
+ * @brief String made of borrowed, or shared chunks.
+ */
+class cord {
+private:
+    /**
+     * @brief Chunk descriptor.
+     */
+    struct chunk {
+        const char* data;
+        ::mystic::types::size_t size;
+        cord_buffer* owner;
+    };
+
+public:
+    using size_type = ::mystic::types::size_t;
+
+    /**
+     * @brief Number of chunk descriptors stored inline.
+     */
+    static constexpr size_type kInlineChunks = 8;
+
+    /**
+     * @brief Size of the owned tail buffer used by append_copy().
+     */
+    static constexpr size_type kTailBufferSize = 512;
+
+    /**
+     * @brief Forward iterator over chunks, as string views.
+     */
+    class chunk_iterator {
+    public:
+        using iterator_category = ::std::forward_iterator_tag;
+        using value_type        = ::std::string_view;
+        using difference_type   = ::mystic::types::ptrdiff_t;
+        using pointer           = const ::std::string_view*;
+        using reference         = ::std::string_view;
+
+        chunk_iterator() noexcept = default;
+
+        ::std::string_view operator*() const noexcept {
+            const chunk& c = owner_->at(index_);
+            return ::std::string_view(c.data, c.size);
+        }
+
+        chunk_iterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        chunk_iterator operator++(int) noexcept {
+            chunk_iterator copy = *this;
+            ++index_;
+            return copy;
+        }
+
+        friend bool operator==(const chunk_iterator& lhs, const chunk_iterator& rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const chunk_iterator& lhs, const chunk_iterator& rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+    private:
+        friend class cord;
+
+        chunk_iterator(const cord* owner, size_type index) noexcept
+            : owner_(owner), index_(index) {}
+
+        const cord* owner_ = nullptr;
+        size_type index_ = 0;
+    };
+
+    /**
+     * @brief Range of chunks, for range-based for loops.
+     */
+    class chunk_range {
+    public:
+        chunk_iterator begin() const noexcept {
+            return chunk_iterator(owner_, 0);
+        }
+
+        chunk_iterator end() const noexcept {
+            return chunk_iterator(owner_, owner_->count_);
+        }
+
+    private:
+        friend class cord;
+
+        explicit chunk_range(const cord* owner) noexcept : owner_(owner) {}
+
+        const cord* owner_;
+    };
+
+    cord() noexcept = default;
+
+    /**
+     * @brief Copies descriptors, and shares buffers (no byte copies).
+     */
+    cord(const cord& other) {
+        reserve(other.count_);
+        for (size_type i = 0; i < other.count_; ++i) {
+            const chunk& c = other.at(i);
+            if (c.owner != nullptr) {
+                c.owner->acquire();
+            }
+            push_back_chunk(c);
+        }
+        size_ = other.size_;
+    }
+
+    cord(cord&& other) noexcept {
+        take(::std::move(other));
+    }
+
+    cord& operator=(const cord& other) {
+        if (this != &other) {
+            cord copy(other);
+            clear();
+            release_storage();
+            take(::std::move(copy));
+        }
+        return *this;
+    }
+
+    cord& operator=(cord&& other) noexcept {
+        if (this != &other) {
+            clear();
+            release_storage();
+            take(::std::move(other));
+        }
+        return *this;
+    }
+
+    ~cord() {
+        clear();
+        release_storage();
+    }
+
+    /**
+     * @brief Appends a borrowed chunk, bytes must outlive the cord.
+     */
+    void append(::std::string_view str) {
+        if (str.empty()) {
+            return;
+        }
+        push_back_chunk(chunk{str.data(), str.size(), nullptr});
+        size_ += str.size();
+    }
+
+    /**
+     * @brief Prepends a borrowed chunk, bytes must outlive the cord.
+     */
+    void prepend(::std::string_view str) {
+        if (str.empty()) {
+            return;
+        }
+        push_front_chunk(chunk{str.data(), str.size(), nullptr});
+        size_ += str.size();
+    }
+
+    /**
+     * @brief Appends a slice of a shared buffer (adds a reference).
+     */
+    void append(const cord_buffer_ref& buffer, size_type offset, size_type length) {
+        if (length == 0) {
+            return;
+        }
+        buffer->acquire();
+        push_back_chunk(chunk{buffer->data() + offset, length, buffer.get()});
+        size_ += length;
+    }
+
+    /**
+     * @brief Prepends a slice of a shared buffer (adds a reference).
+     */
+    void prepend(const cord_buffer_ref& buffer, size_type offset, size_type length) {
+        if (length == 0) {
+            return;
+        }
+        buffer->acquire();
+        push_front_chunk(chunk{buffer->data() + offset, length, buffer.get()});
+        size_ += length;
+    }
+
+    /**
+     * @brief Appends all chunks of another cord (shares its buffers).
+     */
+    void append(const cord& other) {
+        if (&other == this) {
+            cord copy(other);
+            append(copy);
+            return;
+        }
+        reserve(count_ + other.count_);
+        for (size_type i = 0; i < other.count_; ++i) {
+            const chunk& c = other.at(i);
+            if (c.owner != nullptr) {
+                c.owner->acquire();
+            }
+            push_back_chunk(c);
+        }
+        size_ += other.size_;
+    }
+
+    /**
+     * @brief Appends a copy of the bytes.
+     *
+     * @details
+     * Bytes are copied into the owned tail buffer, and coalesced with
+     * the previous chunk when it ends where the copy starts, so many
+     * small pieces (separators, numbers) cost a single chunk.
+     */
+    void append_copy(::std::string_view str) {
+        if (str.empty()) {
+            return;
+        }
+
+        if ((tail_ == nullptr) || (tail_->capacity_ - tail_used_ < str.size())) {
+            if (str.size() > kTailBufferSize / 2) {
+                cord_buffer_ref buffer = cord_buffer::create(str.size());
+                ::std::memcpy(buffer->data(), str.data(), str.size());
+                append(buffer, 0, str.size());
+                return;
+            }
+            if (tail_ != nullptr) {
+                tail_->release();
+            }
+            tail_ = cord_buffer::allocate(kTailBufferSize);
+            tail_used_ = 0;
+        }
+
+        char* destination = tail_->data() + tail_used_;
+        ::std::memcpy(destination, str.data(), str.size());
+        tail_used_ += str.size();
+        size_ += str.size();
+
+        if (count_ != 0) {
+            chunk& last = at(count_ - 1);
+            if ((last.owner == tail_) && (last.data + last.size == destination)) {
+                last.size += str.size();
+                return;
+            }
+        }
+
+        tail_->acquire();
+        push_back_chunk(chunk{destination, str.size(), tail_});
+    }
+
+    /**
+     * @brief Prepends a copy of the bytes.
+     */
+    void prepend_copy(::std::string_view str) {
+        if (str.empty()) {
+            return;
+        }
+        cord_buffer_ref buffer = cord_buffer::create(str.size());
+        ::std::memcpy(buffer->data(), str.data(), str.size());
+        prepend(buffer, 0, str.size());
+    }
+
+    /**
+     * @brief Drops all chunks (keeps descriptor storage).
+     */
+    void clear() noexcept {
+        for (size_type i = 0; i < count_; ++i) {
+            chunk& c = at(i);
+            if (c.owner != nullptr) {
+                c.owner->release();
+            }
+        }
+        if (tail_ != nullptr) {
+            tail_->release();
+            tail_ = nullptr;
+        }
+        tail_used_ = 0;
+        head_ = 0;
+        count_ = 0;
+        size_ = 0;
+    }
+
+    /**
+     * @brief Total size in bytes.
+     */
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @brief Returns true if there are no bytes.
+     */
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    /**
+     * @brief Number of chunks.
+     */
+    size_type chunk_count() const noexcept {
+        return count_;
+    }
+
+    /**
+     * @brief Returns chunk at index as a string view.
+     */
+    ::std::string_view chunk_at(size_type index) const noexcept {
+        const chunk& c = at(index);
+        return ::std::string_view(c.data, c.size);
+    }
+
+    /**
+     * @brief Returns the chunks, as a range of string views.
+     */
+    chunk_range chunks() const noexcept {
+        return chunk_range(this);
+    }
+
+    /**
+     * @brief Copies all bytes to a destination of at least size() bytes.
+     */
+    void copy_to(char* destination) const noexcept {
+        for (size_type i = 0; i < count_; ++i) {
+            const chunk& c = at(i);
+            ::std::memcpy(destination, c.data, c.size);
+            destination += c.size;
+        }
+    }
+
+    /**
+     * @brief Appends all bytes to a growable string (single growth).
+     */
+    template <typename String>
+    void append_to(String& str) const {
+        const size_type offset = str.size();
+        str.resize(offset + size_);
+        copy_to(&str.data()[offset]);
+    }
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX) || (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_MACOS)
+    /**
+     * @brief Fills an iovec array for writev.
+     *
+     * @param iov The iovec array.
+     * @param capacity Number of entries in iov.
+     * @param first_chunk First chunk to emit, to resume after a short
+     * array (e.g. IOV_MAX), or a partial write.
+     *
+     * @returns Number of entries filled.
+     */
+    size_type fill_iovec(::iovec* iov, size_type capacity, size_type first_chunk = 0) const noexcept {
+        size_type n = 0;
+        for (size_type i = first_chunk; (i < count_) && (n < capacity); ++i, ++n) {
+            const chunk& c = at(i);
+            iov[n].iov_base = const_cast<char*>(c.data);
+            iov[n].iov_len = c.size;
+        }
+        return n;
+    }
+#endif
+
+private:
+    chunk& at(size_type index) noexcept {
+        return chunks_[(head_ + index) & (capacity_ - 1)];
+    }
+
+    const chunk& at(size_type index) const noexcept {
+        return chunks_[(head_ + index) & (capacity_ - 1)];
+    }
+
+    bool is_inline() const noexcept {
+        return chunks_ == inline_chunks_;
+    }
+
+    /**
+     * @brief Grows ring storage to hold at least `count` chunks.
+     */
+    void reserve(size_type count) {
+        if (count <= capacity_) {
+            return;
+        }
+
+        size_type new_capacity = capacity_ * 2;
+        while (new_capacity < count) {
+            new_capacity *= 2;
+        }
+
+        chunk* storage = static_cast<chunk*>(::operator new(new_capacity * sizeof(chunk)));
+        for (size_type i = 0; i < count_; ++i) {
+            storage[i] = at(i);
+        }
+        release_storage();
+
+        chunks_ = storage;
+        capacity_ = new_capacity;
+        head_ = 0;
+    }
+
+    void push_back_chunk(const chunk& c) {
+        reserve(count_ + 1);
+        chunks_[(head_ + count_) & (capacity_ - 1)] = c;
+        ++count_;
+    }
+
+    void push_front_chunk(const chunk& c) {
+        reserve(count_ + 1);
+        head_ = (head_ + capacity_ - 1) & (capacity_ - 1);
+        chunks_[head_] = c;
+        ++count_;
+    }
+
+    void release_storage() noexcept {
+        if (!is_inline()) {
+            ::operator delete(static_cast<void*>(chunks_));
+            chunks_ = inline_chunks_;
+            capacity_ = kInlineChunks;
+            head_ = 0;
+        }
+    }
+
+    /**
+     * @brief Steals other's state, other must be empty afterwards.
+     */
+    void take(cord&& other) noexcept {
+        if (other.is_inline()) {
+            for (size_type i = 0; i < other.count_; ++i) {
+                inline_chunks_[i] = other.at(i);
+            }
+            chunks_ = inline_chunks_;
+            capacity_ = kInlineChunks;
+            head_ = 0;
+        } else {
+            chunks_ = other.chunks_;
+            capacity_ = other.capacity_;
+            head_ = other.head_;
+            other.chunks_ = other.inline_chunks_;
+            other.capacity_ = kInlineChunks;
+        }
+
+        count_ = other.count_;
+        size_ = other.size_;
+        tail_ = other.tail_;
+        tail_used_ = other.tail_used_;
+
+        other.head_ = 0;
+        other.count_ = 0;
+        other.size_ = 0;
+        other.tail_ = nullptr;
+        other.tail_used_ = 0;
+    }
+
+    chunk inline_chunks_[kInlineChunks];
+    chunk* chunks_ = inline_chunks_;
+    size_type capacity_ = kInlineChunks;
+    size_type head_ = 0;
+    size_type count_ = 0;
+    size_type size_ = 0;
+
+    // Owned tail buffer for append_copy(), never shared as writable, so
+    // copies of this cord only reference bytes already written.
+    cord_buffer* tail_ = nullptr;
+    size_type tail_used_ = 0;
+};
+
+} // namespace mystic
@@ -0,0 +1,505 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/cuckoo_filter.hpp
+ * @file cuckoo_filter.hpp
+ * @brief Defines a cuckoo filter, an approximate set that supports removal.
+ *
+ * @details
+ * `cuckoo_filter<K>` stores a 16-bit fingerprint of each key in one of
+ * two candidate buckets of four slots. A bucket is one 64-bit word, and
+ * is searched for a fingerprint with a single SWAR zero-lane test, so a
+ * query reads two words. The false positive rate is at most about
+ * 0.012% (8 / 65536), and the filter fills to about 95% before an
+ * insertion fails.
+ *
+ * Unlike a Bloom filter, keys can be removed; removing a key that was
+ * never inserted may remove another key with the same fingerprint, so
+ * only remove keys known to be present.
+ *
+ * Filters serialize to a flat byte buffer (a 32-byte header, then the
+ * buckets), which `attach()` can use in place, e.g. from a `MappedFile`.
+ * The buffer is in host byte order, and the key hash must be stable
+ * across processes, as `mystic::hash::Hasher` is.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/cuckoo_filter.hpp"
+ *
+ * mystic::cuckoo_filter<std::uint64_t> live(1'000'000);
+ * live.insert(session_id);
+ * ...
+ * if (live.may_contain(session_id)) {
+ *     // Probably live; confirm with the session store.
+ * }
+ * live.remove(session_id);
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "mystic/attributes/forceinline.hpp"
+#include "mystic/attributes/no_unique_address.hpp"
+#include "mystic/hash/fast_hash.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+#include "mystic/utility/bit.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/**
+ * @brief Leading bytes of a serialized `cuckoo_filter`.
+ */
+struct CuckooHeader {
+    ::mystic::types::uint32_t magic;
+    ::mystic::types::uint32_t version;
+    ::mystic::types::uint64_t bucket_count;
+    ::mystic::types::uint64_t size;
+    ::mystic::types::uint32_t victim_index;
+    ::mystic::types::uint16_t victim_fingerprint;
+    ::mystic::types::uint16_t has_victim;
+};
+
+static_assert(sizeof(CuckooHeader) == 32, "serialized layout changed");
+
+constexpr inline ::mystic::types::uint32_t kCuckooMagic = 0x46435543u; // "CUCF"
+constexpr inline ::mystic::types::uint32_t kCuckooVersion = 1;
+
+/// Lowest bit of each 16-bit lane.
+constexpr inline ::mystic::types::uint64_t kCuckooLaneLow = 0x0001000100010001ull;
+
+/// Highest bit of each 16-bit lane.
+constexpr inline ::mystic::types::uint64_t kCuckooLaneHigh = 0x8000800080008000ull;
+
+/**
+ * @brief True if any 16-bit lane of `bucket` equals `fingerprint`.
+ */
+MYSTIC_FORCEINLINE inline bool cuckoo_bucket_has(::mystic::types::uint64_t bucket,
+                                                 ::mystic::types::uint16_t fingerprint) noexcept {
+    // Lanes equal to the fingerprint become zero; the borrow trick flags any zero lane.
+    const ::mystic::types::uint64_t diff = bucket ^ (kCuckooLaneLow * fingerprint);
+    return ((diff - kCuckooLaneLow) & ~diff & kCuckooLaneHigh) != 0;
+}
+
+} // namespace internal
+
+/**
+ * @brief Cuckoo filter with 16-bit fingerprints in 4-slot buckets.
+ *
+ * @tparam Key Key type.
+ * @tparam Hash Hasher of `Key`; must give the same hash in every process that shares a serialized filter.
+ */
+template <typename Key, typename Hash = ::mystic::hash::Hasher<Key>>
+class cuckoo_filter {
+public:
+    using key_type  = Key;
+    using hasher    = Hash;
+    using size_type = ::mystic::types::size_t;
+
+    static constexpr size_type kSlotsPerBucket = 4;
+
+    /**
+     * @brief Empty filter (no buckets); the target of `load()`, or `attach()`.
+     */
+    cuckoo_filter() noexcept = default;
+
+    /**
+     * @brief Sizes the filter to hold at least `capacity` keys.
+     */
+    explicit cuckoo_filter(size_type capacity, const Hash& hash = Hash()) : hash_(hash) {
+        // Four slots per bucket, filled to 95%: capacity / 3.8 buckets.
+        const size_type buckets = ::std::max<size_type>(1, ((capacity * 5) + 18) / 19);
+        storage_.assign(static_cast<size_type>(::mystic::bit::bit_ceil(buckets)), 0);
+        buckets_ = storage_.data();
+        bucket_count_ = storage_.size();
+    }
+
+    cuckoo_filter(const cuckoo_filter& other)
+        : hash_(other.hash_), storage_(other.storage_), buckets_(other.buckets_), bucket_count_(other.bucket_count_),
+          size_(other.size_), victim_(other.victim_), kick_state_(other.kick_state_) {
+        if (!storage_.empty()) {
+            buckets_ = storage_.data();
+        }
+    }
+
+    cuckoo_filter(cuckoo_filter&& other) noexcept
+        : hash_(::std::move(other.hash_)), storage_(::std::move(other.storage_)),
+          buckets_(::std::exchange(other.buckets_, nullptr)), bucket_count_(::std::exchange(other.bucket_count_, 0)),
+          size_(::std::exchange(other.size_, 0)), victim_(::std::exchange(other.victim_, Victim{})),
+          kick_state_(other.kick_state_) {}
+
+    cuckoo_filter& operator=(cuckoo_filter other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /* =============================================
+        Queries
+       --------------------------------------------- */
+
+    /**
+     * @brief False if `key` is absent; true if it is (probably) present.
+     */
+    bool may_contain(const Key& key) const noexcept(noexcept(::std::declval<const Hash&>()(key))) {
+        return may_contain_hash(static_cast<::mystic::types::uint64_t>(hash_(key)));
+    }
+
+    bool may_contain_hash(::mystic::types::uint64_t hash) const noexcept {
+        if (bucket_count_ == 0) {
+            return false;
+        }
+        const ::mystic::types::uint16_t fingerprint = fingerprint_of(hash);
+        const size_type first = first_index(hash);
+        const size_type second = alternate_index(first, fingerprint);
+        return internal::cuckoo_bucket_has(buckets_[first], fingerprint) ||
+               internal::cuckoo_bucket_has(buckets_[second], fingerprint) ||
+               (victim_.used && (victim_.fingerprint == fingerprint) &&
+                ((victim_.index == first) || (victim_.index == second)));
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    size_type bucket_count() const noexcept {
+        return bucket_count_;
+    }
+
+    /**
+     * @brief Fraction of slots in use.
+     */
+    double load_factor() const noexcept {
+        return (bucket_count_ == 0) ? 0.0
+                                    : static_cast<double>(size_) / static_cast<double>(bucket_count_ * kSlotsPerBucket);
+    }
+
+    /**
+     * @brief True if the filter reads a buffer passed to `attach()`, and cannot be modified.
+     */
+    bool is_attached() const noexcept {
+        return (buckets_ != nullptr) && storage_.empty();
+    }
+
+    /* =============================================
+        Modifiers
+       --------------------------------------------- */
+
+    /**
+     * @brief Inserts `key` into an owned, sized filter.
+     *
+     * @returns `OK`, `RESOURCE_EXHAUSTED` if the filter is full (it is left
+     * unchanged), or `FAILED_PRECONDITION` if it has no buckets, or is attached.
+     */
+    ::mystic::status::StatusCode insert(const Key& key) noexcept(noexcept(::std::declval<const Hash&>()(key))) {
+        return insert_hash(static_cast<::mystic::types::uint64_t>(hash_(key)));
+    }
+
+    ::mystic::status::StatusCode insert_hash(::mystic::types::uint64_t hash) noexcept {
+        // Attached filters have no owned storage either; their buckets are read-only.
+        if (storage_.empty()) {
+            return ::mystic::status::StatusCode::FAILED_PRECONDITION;
+        }
+        // The victim holds the fingerprint the last failed kick chain could not place.
+        if (victim_.used) {
+            return ::mystic::status::StatusCode::RESOURCE_EXHAUSTED;
+        }
+        ::mystic::types::uint16_t fingerprint = fingerprint_of(hash);
+        size_type index = first_index(hash);
+        if (try_place(index, fingerprint) || try_place(alternate_index(index, fingerprint), fingerprint)) {
+            ++size_;
+            return ::mystic::status::StatusCode::OK;
+        }
+        if ((next_random() & 1) != 0) {
+            index = alternate_index(index, fingerprint);
+        }
+        for (size_type kick = 0; kick < kMaxKicks; ++kick) {
+            const unsigned int shift = static_cast<unsigned int>(next_random() % kSlotsPerBucket) * 16;
+            ::mystic::types::uint64_t& bucket = storage_[index];
+            const ::mystic::types::uint16_t evicted = static_cast<::mystic::types::uint16_t>(bucket >> shift);
+            bucket = (bucket & ~(::mystic::types::uint64_t{0xFFFF} << shift)) |
+                     (static_cast<::mystic::types::uint64_t>(fingerprint) << shift);
+            fingerprint = evicted;
+            index = alternate_index(index, fingerprint);
+            if (try_place(index, fingerprint)) {
+                ++size_;
+                return ::mystic::status::StatusCode::OK;
+            }
+        }
+        // Nothing is lost: the last evicted fingerprint waits in the victim slot.
+        victim_ = Victim{static_cast<::mystic::types::uint32_t>(index), fingerprint, true};
+        ++size_;
+        return ::mystic::status::StatusCode::OK;
+    }
+
+    /**
+     * @brief Removes one copy of `key` from an owned filter.
+     *
+     * @returns `OK`, `NOT_FOUND` if no matching fingerprint was present, or
+     * `FAILED_PRECONDITION` if the filter has no buckets, or is attached.
+     */
+    ::mystic::status::StatusCode remove(const Key& key) noexcept(noexcept(::std::declval<const Hash&>()(key))) {
+        return remove_hash(static_cast<::mystic::types::uint64_t>(hash_(key)));
+    }
+
+    ::mystic::status::StatusCode remove_hash(::mystic::types::uint64_t hash) noexcept {
+        if (storage_.empty()) {
+            return ::mystic::status::StatusCode::FAILED_PRECONDITION;
+        }
+        const ::mystic::types::uint16_t fingerprint = fingerprint_of(hash);
+        const size_type first = first_index(hash);
+        const size_type second = alternate_index(first, fingerprint);
+        if (try_clear(first, fingerprint) || try_clear(second, fingerprint)) {
+            --size_;
+            // A slot just opened; give the victim another chance at its buckets.
+            if (victim_.used && (try_place(victim_.index, victim_.fingerprint) ||
+                                 try_place(alternate_index(victim_.index, victim_.fingerprint), victim_.fingerprint))) {
+                victim_ = Victim{};
+            }
+            return ::mystic::status::StatusCode::OK;
+        }
+        if (victim_.used && (victim_.fingerprint == fingerprint) &&
+            ((victim_.index == first) || (victim_.index == second))) {
+            victim_ = Victim{};
+            --size_;
+            return ::mystic::status::StatusCode::OK;
+        }
+        return ::mystic::status::StatusCode::NOT_FOUND;
+    }
+
+    /**
+     * @brief Removes every key (owned filters only).
+     */
+    void clear() noexcept {
+        ::std::fill(storage_.begin(), storage_.end(), ::mystic::types::uint64_t{0});
+        size_ = 0;
+        victim_ = Victim{};
+    }
+
+    void swap(cuckoo_filter& other) noexcept {
+        using ::std::swap;
+        swap(hash_, other.hash_);
+        storage_.swap(other.storage_);
+        swap(buckets_, other.buckets_);
+        swap(bucket_count_, other.bucket_count_);
+        swap(size_, other.size_);
+        swap(victim_, other.victim_);
+        swap(kick_state_, other.kick_state_);
+    }
+
+    /* =============================================
+        Serialization
+       --------------------------------------------- */
+
+    size_type serialized_size() const noexcept {
+        return sizeof(internal::CuckooHeader) + (bucket_count_ * sizeof(::mystic::types::uint64_t));
+    }
+
+    /**
+     * @brief Writes the filter to `out`.
+     *
+     * @returns `OK`, or `OUT_OF_RANGE` if `size < serialized_size()`.
+     */
+    ::mystic::status::StatusCode serialize(void* out, size_type size) const noexcept {
+        if (size < serialized_size()) {
+            return ::mystic::status::StatusCode::OUT_OF_RANGE;
+        }
+        const internal::CuckooHeader header{internal::kCuckooMagic,
+                                            internal::kCuckooVersion,
+                                            bucket_count_,
+                                            size_,
+                                            victim_.index,
+                                            victim_.fingerprint,
+                                            static_cast<::mystic::types::uint16_t>(victim_.used ? 1 : 0)};
+        ::std::memcpy(out, &header, sizeof(header));
+        if (bucket_count_ != 0) {
+            ::std::memcpy(static_cast<::mystic::types::byte*>(out) + sizeof(header), buckets_,
+                          bucket_count_ * sizeof(::mystic::types::uint64_t));
+        }
+        return ::mystic::status::StatusCode::OK;
+    }
+
+    /**
+     * @brief Replaces the filter with a copy of a serialized one.
+     *
+     * @returns `OK`, `INVALID_ARGUMENT` if `data` is not a serialized filter,
+     * or `DATA_LOSS` if it is truncated.
+     */
+    ::mystic::status::StatusCode load(const void* data, size_type size) {
+        internal::CuckooHeader header;
+        const ::mystic::status::StatusCode status = read_header(data, size, header);
+        if (status != ::mystic::status::StatusCode::OK) {
+            return status;
+        }
+        ::std::vector<::mystic::types::uint64_t> storage(static_cast<size_type>(header.bucket_count));
+        if (!storage.empty()) {
+            ::std::memcpy(storage.data(), static_cast<const ::mystic::types::byte*>(data) + sizeof(header),
+                          storage.size() * sizeof(::mystic::types::uint64_t));
+        }
+        storage_.swap(storage);
+        adopt(header, storage_.data());
+        return ::mystic::status::StatusCode::OK;
+    }
+
+    /**
+     * @brief Queries a serialized filter in place; `data` must outlive the filter.
+     *
+     * @returns `OK`, `INVALID_ARGUMENT` if `data` is not a serialized filter,
+     * or is not 8-byte aligned, or `DATA_LOSS` if it is truncated.
+     */
+    ::mystic::status::StatusCode attach(const void* data, size_type size) noexcept {
+        if ((reinterpret_cast<::mystic::types::uintptr_t>(data) % alignof(::mystic::types::uint64_t)) != 0) {
+            return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+        }
+        internal::CuckooHeader header;
+        const ::mystic::status::StatusCode status = read_header(data, size, header);
+        if (status != ::mystic::status::StatusCode::OK) {
+            return status;
+        }
+        storage_.clear();
+        storage_.shrink_to_fit();
+        adopt(header, reinterpret_cast<const ::mystic::types::uint64_t*>(static_cast<const ::mystic::types::byte*>(data) +
+                                                                          sizeof(header)));
+        return ::mystic::status::StatusCode::OK;
+    }
+
+private:
+    /// Evictions tried before an insertion parks its last fingerprint in the victim slot.
+    static constexpr size_type kMaxKicks = 500;
+
+    struct Victim {
+        ::mystic::types::uint32_t index = 0;
+        ::mystic::types::uint16_t fingerprint = 0;
+        bool used = false;
+    };
+
+    /// Top 16 hash bits; zero marks an empty slot, so it is remapped.
+    static ::mystic::types::uint16_t fingerprint_of(::mystic::types::uint64_t hash) noexcept {
+        const ::mystic::types::uint16_t fingerprint = static_cast<::mystic::types::uint16_t>(hash >> 48);
+        return (fingerprint == 0) ? 1 : fingerprint;
+    }
+
+    size_type first_index(::mystic::types::uint64_t hash) const noexcept {
+        return static_cast<size_type>(hash) & (bucket_count_ - 1);
+    }
+
+    /// The other bucket of `fingerprint`; applying it twice gives back `index`.
+    size_type alternate_index(size_type index, ::mystic::types::uint16_t fingerprint) const noexcept {
+        return (index ^ (static_cast<size_type>(fingerprint) * 0x5BD1E995u)) & (bucket_count_ - 1);
+    }
+
+    bool try_place(size_type index, ::mystic::types::uint16_t fingerprint) noexcept {
+        ::mystic::types::uint64_t& bucket = storage_[index];
+        for (unsigned int shift = 0; shift < 64; shift += 16) {
+            if (((bucket >> shift) & 0xFFFF) == 0) {
+                bucket |= static_cast<::mystic::types::uint64_t>(fingerprint) << shift;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool try_clear(size_type index, ::mystic::types::uint16_t fingerprint) noexcept {
+        ::mystic::types::uint64_t& bucket = storage_[index];
+        for (unsigned int shift = 0; shift < 64; shift += 16) {
+            if (((bucket >> shift) & 0xFFFF) == fingerprint) {
+                bucket &= ~(::mystic::types::uint64_t{0xFFFF} << shift);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// xorshift64; picks the kicked slot, and the starting bucket.
+    ::mystic::types::uint64_t next_random() noexcept {
+        kick_state_ ^= kick_state_ << 13;
+        kick_state_ ^= kick_state_ >> 7;
+        kick_state_ ^= kick_state_ << 17;
+        return kick_state_;
+    }
+
+    static ::mystic::status::StatusCode read_header(const void* data, size_type size,
+                                                    internal::CuckooHeader& header) noexcept {
+        if ((data == nullptr) || (size < sizeof(header))) {
+            return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+        }
+        ::std::memcpy(&header, data, sizeof(header));
+        if ((header.magic != internal::kCuckooMagic) || (header.version != internal::kCuckooVersion)) {
+            return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+        }
+        if (header.bucket_count == 0) {
+            // A default-constructed filter: valid, and empty.
+            if ((header.size != 0) || (header.has_victim != 0) || (header.victim_index != 0)) {
+                return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+            }
+            return ::mystic::status::StatusCode::OK;
+        }
+        if (!::mystic::bit::has_single_bit(header.bucket_count) || (header.bucket_count > 0xFFFFFFFFu) ||
+            (header.victim_index >= header.bucket_count)) {
+            return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+        }
+        if (((size - sizeof(header)) / sizeof(::mystic::types::uint64_t)) < header.bucket_count) {
+            return ::mystic::status::StatusCode::DATA_LOSS;
+        }
+        return ::mystic::status::StatusCode::OK;
+    }
+
+    void adopt(const internal::CuckooHeader& header, const ::mystic::types::uint64_t* buckets) noexcept {
+        buckets_ = buckets;
+        bucket_count_ = static_cast<size_type>(header.bucket_count);
+        size_ = static_cast<size_type>(header.size);
+        victim_ = Victim{header.victim_index, header.victim_fingerprint, header.has_victim != 0};
+    }
+
+    MYSTIC_NO_UNIQUE_ADDRESS Hash hash_;
+    ::std::vector<::mystic::types::uint64_t> storage_;
+    const ::mystic::types::uint64_t* buckets_ = nullptr;
+    size_type bucket_count_ = 0;
+    size_type size_ = 0;
+    Victim victim_;
+    ::mystic::types::uint64_t kick_state_ = 0x9E3779B97F4A7C15ull;
+};
+
+template <typename Key, typename Hash>
+inline void swap(cuckoo_filter<Key, Hash>& lhs, cuckoo_filter<Key, Hash>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mystic
@@ -0,0 +1,524 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/dynamic_bitset.hpp
+ * @file dynamic_bitset.hpp
+ * @brief Defines a runtime sized bitset with SIMD word kernels.
+ *
+ * @details
+ * `dynamic_bitset` packs bits into 64-bit words, and runs its bulk
+ * operations (and, or, xor, and-not, population count) through word
+ * kernels that process a whole vector register per step: AVX-512, AVX2,
+ * SSE2, or NEON, as selected by `MYSTIC_ARCH_SIMD`, with a scalar tail.
+ *
+ * This header file provides,
+ * 1. internal::bitset_apply(), and internal::bitset_count(), the word kernels.
+ * 2. dynamic_bitset, the container.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/dynamic_bitset.hpp"
+ *
+ * mystic::dynamic_bitset active(user_count);
+ * mystic::dynamic_bitset premium(user_count);
+ * ...
+ * active &= premium;
+ * for (auto id = active.find_first(); id != active.npos; id = active.find_next(id)) {
+ *     notify(id);
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/architecture/simd_detection.hpp"
+#include "mystic/attributes/forceinline.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+#include "mystic/utility/bit.hpp"
+
+#if MYSTIC_ARCH_SIMD_HAS_AVX2 || MYSTIC_ARCH_SIMD_HAS_SSE2
+# include <immintrin.h>
+#elif MYSTIC_ARCH_SIMD_HAS_NEON
+# include <arm_neon.h>
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/**
+ * @brief Word operation applied by `bitset_apply()`.
+ */
+enum class BitsetOp : ::mystic::types::uint8_t {
+    And,
+    Or,
+    Xor,
+    AndNot, ///< `dst & ~src`.
+};
+
+template <BitsetOp Op>
+MYSTIC_FORCEINLINE inline ::mystic::types::uint64_t bitset_word(::mystic::types::uint64_t dst,
+                                                              ::mystic::types::uint64_t src) noexcept {
+    if constexpr (Op == BitsetOp::And) {
+        return dst & src;
+    } else if constexpr (Op == BitsetOp::Or) {
+        return dst | src;
+    } else if constexpr (Op == BitsetOp::Xor) {
+        return dst ^ src;
+    } else {
+        return dst & ~src;
+    }
+}
+
+/**
+ * @brief Computes `dst[i] = dst[i] Op src[i]` for `words` words.
+ */
+template <BitsetOp Op>
+inline void bitset_apply(::mystic::types::uint64_t* dst, const ::mystic::types::uint64_t* src,
+                         ::mystic::types::size_t words) noexcept {
+    ::mystic::types::size_t i = 0;
+#if (MYSTIC_ARCH_SIMD == MYSTIC_ARCH_SIMD_AVX512)
+    for (; i + 8 <= words; i += 8) {
+        const __m512i a = _mm512_loadu_si512(dst + i);
+        const __m512i b = _mm512_loadu_si512(src + i);
+        __m512i result;
+        if constexpr (Op == BitsetOp::And) {
+            result = _mm512_and_si512(a, b);
+        } else if constexpr (Op == BitsetOp::Or) {
+            result = _mm512_or_si512(a, b);
+        } else if constexpr (Op == BitsetOp::Xor) {
+            result = _mm512_xor_si512(a, b);
+        } else {
+            result = _mm512_andnot_si512(b, a);
+        }
+        _mm512_storeu_si512(dst + i, result);
+    }
+#elif MYSTIC_ARCH_SIMD_HAS_AVX2
+    for (; i + 4 <= words; i += 4) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i result;
+        if constexpr (Op == BitsetOp::And) {
+            result = _mm256_and_si256(a, b);
+        } else if constexpr (Op == BitsetOp::Or) {
+            result = _mm256_or_si256(a, b);
+        } else if constexpr (Op == BitsetOp::Xor) {
+            result = _mm256_xor_si256(a, b);
+        } else {
+            result = _mm256_andnot_si256(b, a);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), result);
+    }
+#elif MYSTIC_ARCH_SIMD_HAS_SSE2
+    for (; i + 2 <= words; i += 2) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i result;
+        if constexpr (Op == BitsetOp::And) {
+            result = _mm_and_si128(a, b);
+        } else if constexpr (Op == BitsetOp::Or) {
+            result = _mm_or_si128(a, b);
+        } else if constexpr (Op == BitsetOp::Xor) {
+            result = _mm_xor_si128(a, b);
+        } else {
+            result = _mm_andnot_si128(b, a);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), result);
+    }
+#elif MYSTIC_ARCH_SIMD_HAS_NEON
+    for (; i + 2 <= words; i += 2) {
+        const uint64x2_t a = vld1q_u64(dst + i);
+        const uint64x2_t b = vld1q_u64(src + i);
+        uint64x2_t result;
+        if constexpr (Op == BitsetOp::And) {
+            result = vandq_u64(a, b);
+        } else if constexpr (Op == BitsetOp::Or) {
+            result = vorrq_u64(a, b);
+        } else if constexpr (Op == BitsetOp::Xor) {
+            result = veorq_u64(a, b);
+        } else {
+            result = vbicq_u64(a, b);
+        }
+        vst1q_u64(dst + i, result);
+    }
+#endif
+    for (; i < words; ++i) {
+        dst[i] = bitset_word<Op>(dst[i], src[i]);
+    }
+}
+
+/**
+ * @brief Counts the set bits of `a` (or, with `Intersect`, of `a & b`) over `words` words.
+ *
+ * @details
+ * AVX2 uses the nibble lookup population count (`pshufb`, then `psadbw`),
+ * which outruns scalar `popcnt` once a few hundred bytes are counted.
+ */
+template <bool Intersect>
+inline ::mystic::types::size_t bitset_count(const ::mystic::types::uint64_t* a, const ::mystic::types::uint64_t* b,
+                                            ::mystic::types::size_t words) noexcept {
+    ::mystic::types::size_t i = 0;
+    ::mystic::types::size_t total = 0;
+#if MYSTIC_ARCH_SIMD_HAS_AVX512VPOPCNTDQ
+    __m512i sums = _mm512_setzero_si512();
+    for (; i + 8 <= words; i += 8) {
+        __m512i block = _mm512_loadu_si512(a + i);
+        if constexpr (Intersect) {
+            block = _mm512_and_si512(block, _mm512_loadu_si512(b + i));
+        }
+        sums = _mm512_add_epi64(sums, _mm512_popcnt_epi64(block));
+    }
+    total = static_cast<::mystic::types::size_t>(_mm512_reduce_add_epi64(sums));
+#elif MYSTIC_ARCH_SIMD_HAS_AVX2
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0F);
+    __m256i sums = _mm256_setzero_si256();
+    for (; i + 4 <= words; i += 4) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        if constexpr (Intersect) {
+            block = _mm256_and_si256(block, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+        }
+        const __m256i low = _mm256_and_si256(block, low_mask);
+        const __m256i high = _mm256_and_si256(_mm256_srli_epi16(block, 4), low_mask);
+        const __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high));
+        sums = _mm256_add_epi64(sums, _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+    }
+    alignas(32) ::mystic::types::uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), sums);
+    total = static_cast<::mystic::types::size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+#elif MYSTIC_ARCH_SIMD_HAS_NEON && (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM64)
+    for (; i + 2 <= words; i += 2) {
+        uint64x2_t block = vld1q_u64(a + i);
+        if constexpr (Intersect) {
+            block = vandq_u64(block, vld1q_u64(b + i));
+        }
+        total += vaddlvq_u8(vcntq_u8(vreinterpretq_u8_u64(block)));
+    }
+#endif
+    for (; i < words; ++i) {
+        total += static_cast<::mystic::types::size_t>(::mystic::bit::popcount(Intersect ? (a[i] & b[i]) : a[i]));
+    }
+    return total;
+}
+
+} // namespace internal
+
+/**
+ * @brief Runtime sized sequence of bits.
+ *
+ * @details
+ * Binary operations between bitsets of different sizes treat the shorter
+ * one as zero-extended, and keep the size of the left operand.
+ */
+class dynamic_bitset {
+public:
+    using word_type = ::mystic::types::uint64_t;
+    using size_type = ::mystic::types::size_t;
+
+    static constexpr size_type kWordBits = 64;
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+    dynamic_bitset() noexcept = default;
+
+    /**
+     * @brief Constructs `count` bits, all set to `value`.
+     */
+    explicit dynamic_bitset(size_type count, bool value = false)
+        : words_(word_count_for(count), value ? ~word_type{0} : word_type{0}), size_(count) {
+        trim();
+    }
+
+    /* =============================================
+        Capacity
+       --------------------------------------------- */
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    size_type word_count() const noexcept {
+        return words_.size();
+    }
+
+    /**
+     * @brief Backing words; bits past `size()` in the last word are always zero.
+     */
+    const word_type* data() const noexcept {
+        return words_.data();
+    }
+
+    /**
+     * @brief Resizes to `count` bits, setting any new bits to `value`.
+     */
+    void resize(size_type count, bool value = false) {
+        const size_type old_size = size_;
+        words_.resize(word_count_for(count), value ? ~word_type{0} : word_type{0});
+        size_ = count;
+        if (value && (count > old_size) && ((old_size % kWordBits) != 0)) {
+            words_[old_size / kWordBits] |= ~word_type{0} << (old_size % kWordBits);
+        }
+        trim();
+    }
+
+    void reserve(size_type count) {
+        words_.reserve(word_count_for(count));
+    }
+
+    void push_back(bool value) {
+        if ((size_ % kWordBits) == 0) {
+            words_.push_back(0);
+        }
+        ++size_;
+        set(size_ - 1, value);
+    }
+
+    void clear() noexcept {
+        words_.clear();
+        size_ = 0;
+    }
+
+    /* =============================================
+        Bit Access
+       --------------------------------------------- */
+
+    bool test(size_type pos) const noexcept {
+        return ((words_[pos / kWordBits] >> (pos % kWordBits)) & 1) != 0;
+    }
+
+    bool operator[](size_type pos) const noexcept {
+        return test(pos);
+    }
+
+    dynamic_bitset& set(size_type pos) noexcept {
+        words_[pos / kWordBits] |= word_type{1} << (pos % kWordBits);
+        return *this;
+    }
+
+    dynamic_bitset& set(size_type pos, bool value) noexcept {
+        const word_type mask = word_type{1} << (pos % kWordBits);
+        word_type& word = words_[pos / kWordBits];
+        word = value ? (word | mask) : (word & ~mask);
+        return *this;
+    }
+
+    dynamic_bitset& reset(size_type pos) noexcept {
+        words_[pos / kWordBits] &= ~(word_type{1} << (pos % kWordBits));
+        return *this;
+    }
+
+    dynamic_bitset& flip(size_type pos) noexcept {
+        words_[pos / kWordBits] ^= word_type{1} << (pos % kWordBits);
+        return *this;
+    }
+
+    /**
+     * @brief Sets every bit.
+     */
+    dynamic_bitset& set() noexcept {
+        ::std::fill(words_.begin(), words_.end(), ~word_type{0});
+        trim();
+        return *this;
+    }
+
+    /**
+     * @brief Clears every bit.
+     */
+    dynamic_bitset& reset() noexcept {
+        ::std::fill(words_.begin(), words_.end(), word_type{0});
+        return *this;
+    }
+
+    /**
+     * @brief Flips every bit.
+     */
+    dynamic_bitset& flip() noexcept {
+        for (word_type& word : words_) {
+            word = ~word;
+        }
+        trim();
+        return *this;
+    }
+
+    /* =============================================
+        Queries
+       --------------------------------------------- */
+
+    /**
+     * @brief Number of set bits.
+     */
+    size_type count() const noexcept {
+        return internal::bitset_count<false>(words_.data(), nullptr, words_.size());
+    }
+
+    /**
+     * @brief Number of bits set in both `*this`, and `other`, without materializing the intersection.
+     */
+    size_type count_and(const dynamic_bitset& other) const noexcept {
+        return internal::bitset_count<true>(words_.data(), other.words_.data(),
+                                            ::std::min(words_.size(), other.words_.size()));
+    }
+
+    bool any() const noexcept {
+        return ::std::any_of(words_.begin(), words_.end(), [](word_type word) { return word != 0; });
+    }
+
+    bool none() const noexcept {
+        return !any();
+    }
+
+    bool all() const noexcept {
+        return count() == size_;
+    }
+
+    /**
+     * @brief Position of the first set bit, or `npos`.
+     */
+    size_type find_first() const noexcept {
+        return find_from_word(0);
+    }
+
+    /**
+     * @brief Position of the first set bit after `pos`, or `npos`.
+     */
+    size_type find_next(size_type pos) const noexcept {
+        ++pos;
+        if (pos >= size_) {
+            return npos;
+        }
+        const size_type index = pos / kWordBits;
+        const word_type word = words_[index] & (~word_type{0} << (pos % kWordBits));
+        if (word != 0) {
+            return (index * kWordBits) + static_cast<size_type>(::mystic::bit::countr_zero(word));
+        }
+        return find_from_word(index + 1);
+    }
+
+    /* =============================================
+        Set Operations
+       --------------------------------------------- */
+
+    dynamic_bitset& operator&=(const dynamic_bitset& other) noexcept {
+        const size_type shared = ::std::min(words_.size(), other.words_.size());
+        internal::bitset_apply<internal::BitsetOp::And>(words_.data(), other.words_.data(), shared);
+        ::std::fill(words_.begin() + static_cast<::mystic::types::ptrdiff_t>(shared), words_.end(), word_type{0});
+        return *this;
+    }
+
+    dynamic_bitset& operator|=(const dynamic_bitset& other) noexcept {
+        internal::bitset_apply<internal::BitsetOp::Or>(words_.data(), other.words_.data(),
+                                                       ::std::min(words_.size(), other.words_.size()));
+        trim();
+        return *this;
+    }
+
+    dynamic_bitset& operator^=(const dynamic_bitset& other) noexcept {
+        internal::bitset_apply<internal::BitsetOp::Xor>(words_.data(), other.words_.data(),
+                                                        ::std::min(words_.size(), other.words_.size()));
+        trim();
+        return *this;
+    }
+
+    /**
+     * @brief Clears every bit that is set in `other`.
+     */
+    dynamic_bitset& and_not(const dynamic_bitset& other) noexcept {
+        internal::bitset_apply<internal::BitsetOp::AndNot>(words_.data(), other.words_.data(),
+                                                           ::std::min(words_.size(), other.words_.size()));
+        return *this;
+    }
+
+    friend bool operator==(const dynamic_bitset& lhs, const dynamic_bitset& rhs) noexcept {
+        return (lhs.size_ == rhs.size_) && (lhs.words_ == rhs.words_);
+    }
+
+    friend bool operator!=(const dynamic_bitset& lhs, const dynamic_bitset& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+    void swap(dynamic_bitset& other) noexcept {
+        words_.swap(other.words_);
+        ::std::swap(size_, other.size_);
+    }
+
+private:
+    static constexpr size_type word_count_for(size_type bits) noexcept {
+        return (bits + kWordBits - 1) / kWordBits;
+    }
+
+    /// Clears the bits past `size_` in the last word.
+    void trim() noexcept {
+        if ((size_ % kWordBits) != 0) {
+            words_.back() &= ~(~word_type{0} << (size_ % kWordBits));
+        }
+    }
+
+    size_type find_from_word(size_type index) const noexcept {
+        for (; index < words_.size(); ++index) {
+            if (words_[index] != 0) {
+                return (index * kWordBits) + static_cast<size_type>(::mystic::bit::countr_zero(words_[index]));
+            }
+        }
+        return npos;
+    }
+
+    ::std::vector<word_type> words_;
+    size_type size_ = 0;
+};
+
+inline dynamic_bitset operator&(dynamic_bitset lhs, const dynamic_bitset& rhs) noexcept {
+    lhs &= rhs;
+    return lhs;
+}
+
+inline dynamic_bitset operator|(dynamic_bitset lhs, const dynamic_bitset& rhs) noexcept {
+    lhs |= rhs;
+    return lhs;
+}
+
+inline dynamic_bitset operator^(dynamic_bitset lhs, const dynamic_bitset& rhs) noexcept {
+    lhs ^= rhs;
+    return lhs;
+}
+
+inline void swap(dynamic_bitset& lhs, dynamic_bitset& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mystic
@@ -0,0 +1,398 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/flat_hash_map.hpp
+ * @file flat_hash_map.hpp
+ * @brief Defines an open-addressing hash map with SIMD probing.
+ *
+ * @details
+ * `flat_hash_map<K, V>` stores its elements inline in one flat array
+ * (see `flat_hash_table.hpp`), so lookups touch one control group, and
+ * typically one slot, instead of chasing `std::unordered_map` nodes.
+ *
+ * Differences from `std::unordered_map`:
+ * 1. References, and iterators are invalidated by any rehash.
+ * 2. Keys with a transparent hasher (e.g. `std::string`, with the default
+ *    `hash::Hasher`) are looked up by `std::string_view`, or C string
+ *    without building a temporary key.
+ * 3. Storage may come from a `std::pmr::memory_resource`.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/flat_hash_map.hpp"
+ *
+ * mystic::flat_hash_map<std::string, int> counts;
+ * counts["alpha"] += 1;
+ * counts.try_emplace("beta", 2);
+ *
+ * std::string_view word = "alpha";
+ * if (auto it = counts.find(word); it != counts.end()) {
+ *     // it->second == 1
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstring>
+#include <initializer_list>
+#include <memory_resource>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "mystic/containers/flat_hash_table.hpp"
+#include "mystic/hash/fast_hash.hpp"
+#include "mystic/traits/is_trivially_relocatable.hpp"
+#include "mystic/types/standard_def.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/**
+ * @brief Slot policy of flat_hash_map.
+ */
+template <typename Key, typename Value>
+struct hash_map_policy {
+    using key_type  = Key;
+    using slot_type = ::std::pair<const Key, Value>;
+
+    static const Key& key(const slot_type& slot) noexcept {
+        return slot.first;
+    }
+
+    /**
+     * @brief Moves a slot; the const key is moved from just before the source is destroyed.
+     *
+     * @details
+     * The cast is the one `std::map` node handles rely on for `key()`:
+     * the slot was built in raw storage (so it is no const object as a
+     * whole), only its own destructor runs on the moved-from key, and no
+     * other code can observe it in between. Copying instead would make
+     * every rehash of string keys allocate, and could throw here.
+     */
+    static void relocate(slot_type* dest, slot_type* source) noexcept {
+        if constexpr (::mystic::traits::is_trivially_relocatable_v<slot_type>) {
+            ::std::memcpy(static_cast<void*>(dest), static_cast<const void*>(source), sizeof(slot_type));
+        } else {
+            ::new (static_cast<void*>(dest)) slot_type(::std::piecewise_construct,
+                                                       ::std::forward_as_tuple(::std::move(const_cast<Key&>(source->first))),
+                                                       ::std::forward_as_tuple(::std::move(source->second)));
+            source->~slot_type();
+        }
+    }
+};
+
+} // namespace internal
+
+/**
+ * @brief Open-addressing hash map.
+ *
+ * @tparam Key Key type.
+ * @tparam Value Mapped type.
+ * @tparam Hash Hasher (`hash::Hasher<Key>` by default).
+ * @tparam Equal Key equality (transparent when `Hash` is).
+ */
+template <typename Key, typename Value, typename Hash = ::mystic::hash::Hasher<Key>,
+          typename Equal = typename internal::hash_default_equal<Key, Hash>::type>
+class flat_hash_map {
+    using table_type = internal::hash_table<internal::hash_map_policy<Key, Value>, Hash, Equal>;
+
+    template <typename Lookup>
+    using key_arg = typename table_type::template key_arg<Lookup>;
+
+public:
+    using key_type        = Key;
+    using mapped_type     = Value;
+    using value_type      = ::std::pair<const Key, Value>;
+    using size_type       = ::mystic::types::size_t;
+    using hasher          = Hash;
+    using key_equal       = Equal;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using iterator        = typename table_type::iterator;
+    using const_iterator  = typename table_type::const_iterator;
+
+    flat_hash_map() noexcept = default;
+
+    /**
+     * @brief Empty map allocating from `upstream` (null for `operator new`).
+     */
+    explicit flat_hash_map(::std::pmr::memory_resource* upstream, const Hash& hash = Hash(),
+                           const Equal& equal = Equal()) noexcept
+        : table_(upstream, hash, equal) {}
+
+    explicit flat_hash_map(size_type capacity, ::std::pmr::memory_resource* upstream = nullptr)
+        : table_(upstream) {
+        table_.reserve(capacity);
+    }
+
+    flat_hash_map(::std::initializer_list<value_type> values, ::std::pmr::memory_resource* upstream = nullptr)
+        : table_(upstream) {
+        insert(values.begin(), values.end());
+    }
+
+    template <typename Iterator>
+    flat_hash_map(Iterator first, Iterator last, ::std::pmr::memory_resource* upstream = nullptr)
+        : table_(upstream) {
+        insert(first, last);
+    }
+
+    /* =============================================
+        Iteration, and Capacity
+       --------------------------------------------- */
+
+    iterator begin() noexcept {
+        return table_.begin();
+    }
+
+    const_iterator begin() const noexcept {
+        return table_.begin();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return table_.begin();
+    }
+
+    iterator end() noexcept {
+        return table_.end();
+    }
+
+    const_iterator end() const noexcept {
+        return table_.end();
+    }
+
+    const_iterator cend() const noexcept {
+        return table_.end();
+    }
+
+    size_type size() const noexcept {
+        return table_.size();
+    }
+
+    bool empty() const noexcept {
+        return table_.empty();
+    }
+
+    /**
+     * @brief Returns the number of slots.
+     */
+    size_type capacity() const noexcept {
+        return table_.capacity();
+    }
+
+    float load_factor() const noexcept {
+        return table_.load_factor();
+    }
+
+    void reserve(size_type count) {
+        table_.reserve(count);
+    }
+
+    ::std::pmr::memory_resource* upstream() const noexcept {
+        return table_.upstream();
+    }
+
+    /* =============================================
+        Lookup
+       --------------------------------------------- */
+
+    template <typename Lookup = key_type>
+    iterator find(const key_arg<Lookup>& key) noexcept {
+        return table_.find(key);
+    }
+
+    template <typename Lookup = key_type>
+    const_iterator find(const key_arg<Lookup>& key) const noexcept {
+        return table_.find(key);
+    }
+
+    template <typename Lookup = key_type>
+    bool contains(const key_arg<Lookup>& key) const noexcept {
+        return table_.contains(key);
+    }
+
+    template <typename Lookup = key_type>
+    size_type count(const key_arg<Lookup>& key) const noexcept {
+        return table_.contains(key) ? 1 : 0;
+    }
+
+    /**
+     * @brief Returns the mapped value, inserting a value-initialized one if absent.
+     */
+    template <typename Lookup = key_type>
+    mapped_type& operator[](const key_arg<Lookup>& key) {
+        return try_emplace(key).first->second;
+    }
+
+    mapped_type& operator[](key_type&& key) {
+        return try_emplace(::std::move(key)).first->second;
+    }
+
+    /* =============================================
+        Modifiers
+       --------------------------------------------- */
+
+    ::std::pair<iterator, bool> insert(const value_type& value) {
+        return try_emplace(value.first, value.second);
+    }
+
+    ::std::pair<iterator, bool> insert(value_type&& value) {
+        return try_emplace(::std::move(const_cast<key_type&>(value.first)), ::std::move(value.second));
+    }
+
+    template <typename Iterator>
+    void insert(Iterator first, Iterator last) {
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    void insert(::std::initializer_list<value_type> values) {
+        insert(values.begin(), values.end());
+    }
+
+    /**
+     * @brief Inserts `value_type(args...)` unless its key exists.
+     */
+    template <typename... Args>
+    ::std::pair<iterator, bool> emplace(Args&&... args) {
+        value_type value(::std::forward<Args>(args)...);
+        return insert(::std::move(value));
+    }
+
+    /**
+     * @brief Constructs the mapped value from `args` only if `key` is absent.
+     */
+    template <typename Lookup = key_type, typename... Args>
+    ::std::pair<iterator, bool> try_emplace(const key_arg<Lookup>& key, Args&&... args) {
+        return emplace_at(key, key, ::std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    ::std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+        return emplace_at(key, ::std::move(key), ::std::forward<Args>(args)...);
+    }
+
+    template <typename Mapped>
+    ::std::pair<iterator, bool> insert_or_assign(const key_type& key, Mapped&& value) {
+        ::std::pair<iterator, bool> result = try_emplace(key, ::std::forward<Mapped>(value));
+        if (!result.second) {
+            result.first->second = ::std::forward<Mapped>(value);
+        }
+        return result;
+    }
+
+    template <typename Mapped>
+    ::std::pair<iterator, bool> insert_or_assign(key_type&& key, Mapped&& value) {
+        ::std::pair<iterator, bool> result = try_emplace(::std::move(key), ::std::forward<Mapped>(value));
+        if (!result.second) {
+            result.first->second = ::std::forward<Mapped>(value);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Erases the element at `pos`, returning the next one.
+     */
+    iterator erase(const_iterator pos) noexcept {
+        iterator next = table_.to_mutable(pos);
+        ++next;
+        table_.erase(pos);
+        return next;
+    }
+
+    iterator erase(iterator pos) noexcept {
+        return erase(const_iterator(pos));
+    }
+
+    template <typename Lookup = key_type>
+    size_type erase(const key_arg<Lookup>& key) noexcept {
+        return table_.erase_key(key);
+    }
+
+    void clear() noexcept {
+        table_.clear();
+    }
+
+    void swap(flat_hash_map& other) noexcept {
+        table_.swap(other.table_);
+    }
+
+    friend bool operator==(const flat_hash_map& lhs, const flat_hash_map& rhs) {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (const value_type& value : lhs) {
+            const const_iterator it = rhs.find(value.first);
+            if ((it == rhs.end()) || !(it->second == value.second)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    friend bool operator!=(const flat_hash_map& lhs, const flat_hash_map& rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    template <typename Lookup, typename KeyArg, typename... Args>
+    ::std::pair<iterator, bool> emplace_at(const Lookup& lookup, KeyArg&& key, Args&&... args) {
+        const ::std::pair<size_type, bool> found = table_.find_or_prepare_insert(lookup);
+        if (found.second) {
+#if defined(__cpp_exceptions)
+            try {
+                ::new (static_cast<void*>(table_.slot(found.first)))
+                    value_type(::std::piecewise_construct, ::std::forward_as_tuple(::std::forward<KeyArg>(key)),
+                               ::std::forward_as_tuple(::std::forward<Args>(args)...));
+            } catch (...) {
+                table_.abandon_insert(found.first);
+                throw;
+            }
+#else
+            ::new (static_cast<void*>(table_.slot(found.first)))
+                value_type(::std::piecewise_construct, ::std::forward_as_tuple(::std::forward<KeyArg>(key)),
+                           ::std::forward_as_tuple(::std::forward<Args>(args)...));
+#endif
+        }
+        return {table_.iterator_at(found.first), found.second};
+    }
+
+    table_type table_;
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+inline void swap(flat_hash_map<Key, Value, Hash, Equal>& lhs, flat_hash_map<Key, Value, Hash, Equal>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mystic
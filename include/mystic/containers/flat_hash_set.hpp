@@ -0,0 +1,301 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/flat_hash_set.hpp
+ * @file flat_hash_set.hpp
+ * @brief Defines an open-addressing hash set with SIMD probing.
+ *
+ * @details
+ * `flat_hash_set<K>` is the set counterpart of `flat_hash_map`, sharing
+ * its table (see `flat_hash_table.hpp`). Elements are immutable through
+ * the set; every iterator is a const iterator.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/flat_hash_set.hpp"
+ *
+ * mystic::flat_hash_set<std::string> seen;
+ * if (seen.insert(name).second) {
+ *     // First time `name` was seen.
+ * }
+ * bool known = seen.contains(std::string_view("alpha"));
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <initializer_list>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+#include "mystic/containers/flat_hash_table.hpp"
+#include "mystic/hash/fast_hash.hpp"
+#include "mystic/memory/relocate.hpp"
+#include "mystic/types/standard_def.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/**
+ * @brief Slot policy of flat_hash_set.
+ */
+template <typename Key>
+struct hash_set_policy {
+    using key_type  = Key;
+    using slot_type = Key;
+
+    static const Key& key(const slot_type& slot) noexcept {
+        return slot;
+    }
+
+    static void relocate(slot_type* dest, slot_type* source) noexcept {
+        ::mystic::memory::relocate_n(source, 1, dest);
+    }
+};
+
+} // namespace internal
+
+/**
+ * @brief Open-addressing hash set.
+ *
+ * @tparam Key Element type.
+ * @tparam Hash Hasher (`hash::Hasher<Key>` by default).
+ * @tparam Equal Key equality (transparent when `Hash` is).
+ */
+template <typename Key, typename Hash = ::mystic::hash::Hasher<Key>,
+          typename Equal = typename internal::hash_default_equal<Key, Hash>::type>
+class flat_hash_set {
+    using table_type = internal::hash_table<internal::hash_set_policy<Key>, Hash, Equal>;
+
+    template <typename Lookup>
+    using key_arg = typename table_type::template key_arg<Lookup>;
+
+public:
+    using key_type        = Key;
+    using value_type      = Key;
+    using size_type       = ::mystic::types::size_t;
+    using hasher          = Hash;
+    using key_equal       = Equal;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using iterator        = typename table_type::const_iterator;
+    using const_iterator  = typename table_type::const_iterator;
+
+    flat_hash_set() noexcept = default;
+
+    /**
+     * @brief Empty set allocating from `upstream` (null for `operator new`).
+     */
+    explicit flat_hash_set(::std::pmr::memory_resource* upstream, const Hash& hash = Hash(),
+                           const Equal& equal = Equal()) noexcept
+        : table_(upstream, hash, equal) {}
+
+    explicit flat_hash_set(size_type capacity, ::std::pmr::memory_resource* upstream = nullptr)
+        : table_(upstream) {
+        table_.reserve(capacity);
+    }
+
+    flat_hash_set(::std::initializer_list<value_type> values, ::std::pmr::memory_resource* upstream = nullptr)
+        : table_(upstream) {
+        insert(values.begin(), values.end());
+    }
+
+    template <typename Iterator>
+    flat_hash_set(Iterator first, Iterator last, ::std::pmr::memory_resource* upstream = nullptr)
+        : table_(upstream) {
+        insert(first, last);
+    }
+
+    /* =============================================
+        Iteration, and Capacity
+       --------------------------------------------- */
+
+    const_iterator begin() const noexcept {
+        return table_.begin();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return table_.begin();
+    }
+
+    const_iterator end() const noexcept {
+        return table_.end();
+    }
+
+    const_iterator cend() const noexcept {
+        return table_.end();
+    }
+
+    size_type size() const noexcept {
+        return table_.size();
+    }
+
+    bool empty() const noexcept {
+        return table_.empty();
+    }
+
+    /**
+     * @brief Returns the number of slots.
+     */
+    size_type capacity() const noexcept {
+        return table_.capacity();
+    }
+
+    float load_factor() const noexcept {
+        return table_.load_factor();
+    }
+
+    void reserve(size_type count) {
+        table_.reserve(count);
+    }
+
+    ::std::pmr::memory_resource* upstream() const noexcept {
+        return table_.upstream();
+    }
+
+    /* =============================================
+        Lookup
+       --------------------------------------------- */
+
+    template <typename Lookup = key_type>
+    const_iterator find(const key_arg<Lookup>& key) const noexcept {
+        return table_.find(key);
+    }
+
+    template <typename Lookup = key_type>
+    bool contains(const key_arg<Lookup>& key) const noexcept {
+        return table_.contains(key);
+    }
+
+    template <typename Lookup = key_type>
+    size_type count(const key_arg<Lookup>& key) const noexcept {
+        return table_.contains(key) ? 1 : 0;
+    }
+
+    /* =============================================
+        Modifiers
+       --------------------------------------------- */
+
+    ::std::pair<const_iterator, bool> insert(const value_type& value) {
+        return emplace_at(value, value);
+    }
+
+    ::std::pair<const_iterator, bool> insert(value_type&& value) {
+        return emplace_at(value, ::std::move(value));
+    }
+
+    template <typename Iterator>
+    void insert(Iterator first, Iterator last) {
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    void insert(::std::initializer_list<value_type> values) {
+        insert(values.begin(), values.end());
+    }
+
+    /**
+     * @brief Inserts `value_type(args...)` unless it is present.
+     */
+    template <typename... Args>
+    ::std::pair<const_iterator, bool> emplace(Args&&... args) {
+        value_type value(::std::forward<Args>(args)...);
+        return insert(::std::move(value));
+    }
+
+    /**
+     * @brief Erases the element at `pos`, returning the next one.
+     */
+    const_iterator erase(const_iterator pos) noexcept {
+        const_iterator next = pos;
+        ++next;
+        table_.erase(pos);
+        return next;
+    }
+
+    template <typename Lookup = key_type>
+    size_type erase(const key_arg<Lookup>& key) noexcept {
+        return table_.erase_key(key);
+    }
+
+    void clear() noexcept {
+        table_.clear();
+    }
+
+    void swap(flat_hash_set& other) noexcept {
+        table_.swap(other.table_);
+    }
+
+    friend bool operator==(const flat_hash_set& lhs, const flat_hash_set& rhs) {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (const value_type& value : lhs) {
+            if (!rhs.contains(value)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    friend bool operator!=(const flat_hash_set& lhs, const flat_hash_set& rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    template <typename Value>
+    ::std::pair<const_iterator, bool> emplace_at(const key_type& key, Value&& value) {
+        const ::std::pair<size_type, bool> found = table_.find_or_prepare_insert(key);
+        if (found.second) {
+#if defined(__cpp_exceptions)
+            try {
+                ::new (static_cast<void*>(table_.slot(found.first))) value_type(::std::forward<Value>(value));
+            } catch (...) {
+                table_.abandon_insert(found.first);
+                throw;
+            }
+#else
+            ::new (static_cast<void*>(table_.slot(found.first))) value_type(::std::forward<Value>(value));
+#endif
+        }
+        return {table_.iterator_at(found.first), found.second};
+    }
+
+    table_type table_;
+};
+
+template <typename Key, typename Hash, typename Equal>
+inline void swap(flat_hash_set<Key, Hash, Equal>& lhs, flat_hash_set<Key, Hash, Equal>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mystic
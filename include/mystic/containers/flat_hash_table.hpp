@@ -0,0 +1,867 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/flat_hash_table.hpp
+ * @file flat_hash_table.hpp
+ * @brief Defines the open-addressing table behind flat_hash_map, and flat_hash_set.
+ *
+ * @details
+ * The table follows the Swiss-table layout: one control byte per slot,
+ * holding either 7 bits of the hash (full), or a marker (empty, deleted,
+ * sentinel), followed by a flat slot array. Lookups probe a group of
+ * control bytes at a time, comparing all of them against the 7-bit tag
+ * with one SIMD compare, and only touch slots whose tag matched.
+ *
+ * Groups are 16 bytes wide with SSE2, or NEON, and 8 bytes wide with the
+ * portable SWAR fallback. Erasing leaves the slot empty, not deleted,
+ * whenever no probe sequence could have passed over it, so tombstones
+ * only accumulate in fully packed regions.
+ *
+ * This header is an implementation detail; include `flat_hash_map.hpp`,
+ * or `flat_hash_set.hpp` instead.
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "mystic/architecture/endianness_detection.hpp"
+#include "mystic/architecture/simd_detection.hpp"
+#include "mystic/attributes/no_unique_address.hpp"
+#include "mystic/attributes/noinline.hpp"
+#include "mystic/hash/fast_hash.hpp"
+#include "mystic/memory/upstream.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+#include "mystic/utility/bit.hpp"
+
+#if MYSTIC_ARCH_SIMD_HAS_SSE2
+# include <emmintrin.h>
+#elif MYSTIC_ARCH_SIMD_HAS_NEON
+# include <arm_neon.h>
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/* =============================================
+    Control Bytes
+   --------------------------------------------- */
+
+using hash_ctrl_t = ::mystic::types::int8_t;
+
+/// Never used slot; probing stops here.
+constexpr inline hash_ctrl_t kCtrlEmpty = -128;
+
+/// Erased slot that a probe sequence may pass over.
+constexpr inline hash_ctrl_t kCtrlDeleted = -2;
+
+/// End marker read by iterators.
+constexpr inline hash_ctrl_t kCtrlSentinel = -1;
+
+/**
+ * @brief Control bytes of the capacity 0 table (never written).
+ */
+alignas(16) constexpr inline hash_ctrl_t kEmptyGroup[32] = {
+    kCtrlSentinel, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty,
+    kCtrlEmpty,    kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty,
+    kCtrlEmpty,    kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty,
+    kCtrlEmpty,    kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty,
+};
+
+/**
+ * @brief Set of group positions, `Shift` bits per position.
+ */
+template <::mystic::types::size_t Width, int Shift>
+class HashBitMask {
+public:
+    explicit HashBitMask(::mystic::types::uint64_t mask) noexcept
+        : mask_(mask) {}
+
+    explicit operator bool() const noexcept {
+        return mask_ != 0;
+    }
+
+    /**
+     * @brief Lowest position, mask must be non-empty.
+     */
+    ::mystic::types::size_t lowest() const noexcept {
+        return static_cast<::mystic::types::size_t>(::mystic::bit::countr_zero(mask_)) >> Shift;
+    }
+
+    /**
+     * @brief Positions before the lowest set one, mask must be non-empty.
+     */
+    ::mystic::types::size_t trailing_zeros() const noexcept {
+        return lowest();
+    }
+
+    /**
+     * @brief Positions after the highest set one, mask must be non-empty.
+     */
+    ::mystic::types::size_t leading_zeros() const noexcept {
+        constexpr int kExtra = 64 - static_cast<int>(Width << Shift);
+        return static_cast<::mystic::types::size_t>(::mystic::bit::countl_zero(mask_ << kExtra)) >> Shift;
+    }
+
+    // Range-for support.
+    HashBitMask begin() const noexcept {
+        return *this;
+    }
+
+    HashBitMask end() const noexcept {
+        return HashBitMask(0);
+    }
+
+    ::mystic::types::size_t operator*() const noexcept {
+        return lowest();
+    }
+
+    HashBitMask& operator++() noexcept {
+        mask_ &= mask_ - 1;
+        return *this;
+    }
+
+    bool operator!=(const HashBitMask& other) const noexcept {
+        return mask_ != other.mask_;
+    }
+
+private:
+    ::mystic::types::uint64_t mask_;
+};
+
+#if MYSTIC_ARCH_SIMD_HAS_SSE2
+/**
+ * @brief 16 control bytes probed with SSE2.
+ */
+struct HashGroup {
+    static constexpr ::mystic::types::size_t kWidth = 16;
+    using Mask = HashBitMask<kWidth, 0>;
+
+    explicit HashGroup(const hash_ctrl_t* ctrl) noexcept
+        : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+    Mask match(::mystic::types::uint8_t tag) const noexcept {
+        const __m128i eq = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(tag)), ctrl_);
+        return Mask(static_cast<::mystic::types::uint32_t>(_mm_movemask_epi8(eq)));
+    }
+
+    Mask match_empty() const noexcept {
+        const __m128i eq = _mm_cmpeq_epi8(_mm_set1_epi8(kCtrlEmpty), ctrl_);
+        return Mask(static_cast<::mystic::types::uint32_t>(_mm_movemask_epi8(eq)));
+    }
+
+    Mask match_empty_or_deleted() const noexcept {
+        const __m128i special = _mm_cmpgt_epi8(_mm_set1_epi8(kCtrlSentinel), ctrl_);
+        return Mask(static_cast<::mystic::types::uint32_t>(_mm_movemask_epi8(special)));
+    }
+
+    ::mystic::types::size_t count_leading_empty_or_deleted() const noexcept {
+        const __m128i special = _mm_cmpgt_epi8(_mm_set1_epi8(kCtrlSentinel), ctrl_);
+        const ::mystic::types::uint32_t mask = static_cast<::mystic::types::uint32_t>(_mm_movemask_epi8(special));
+        return static_cast<::mystic::types::size_t>(::mystic::bit::countr_zero(mask + 1));
+    }
+
+    __m128i ctrl_;
+};
+#elif MYSTIC_ARCH_SIMD_HAS_NEON
+/**
+ * @brief 16 control bytes probed with NEON (4 mask bits per byte).
+ */
+struct HashGroup {
+    static constexpr ::mystic::types::size_t kWidth = 16;
+    using Mask = HashBitMask<kWidth, 2>;
+
+    explicit HashGroup(const hash_ctrl_t* ctrl) noexcept
+        : ctrl_(vld1q_s8(ctrl)) {}
+
+    /// Narrows a 0x00 / 0xFF byte vector to one nibble per byte.
+    static ::mystic::types::uint64_t nibbles(uint8x16_t bytes) noexcept {
+        return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(bytes), 4)), 0);
+    }
+
+    Mask match(::mystic::types::uint8_t tag) const noexcept {
+        return Mask(nibbles(vceqq_s8(ctrl_, vdupq_n_s8(static_cast<::mystic::types::int8_t>(tag)))) &
+                    0x8888888888888888ull);
+    }
+
+    Mask match_empty() const noexcept {
+        return Mask(nibbles(vceqq_s8(ctrl_, vdupq_n_s8(kCtrlEmpty))) & 0x8888888888888888ull);
+    }
+
+    Mask match_empty_or_deleted() const noexcept {
+        return Mask(nibbles(vcltq_s8(ctrl_, vdupq_n_s8(kCtrlSentinel))) & 0x8888888888888888ull);
+    }
+
+    ::mystic::types::size_t count_leading_empty_or_deleted() const noexcept {
+        const ::mystic::types::uint64_t rest = ~nibbles(vcltq_s8(ctrl_, vdupq_n_s8(kCtrlSentinel)));
+        return (rest == 0) ? kWidth : static_cast<::mystic::types::size_t>(::mystic::bit::countr_zero(rest)) >> 2;
+    }
+
+    int8x16_t ctrl_;
+};
+#else
+/**
+ * @brief 8 control bytes probed with SWAR arithmetic.
+ */
+struct HashGroup {
+    static constexpr ::mystic::types::size_t kWidth = 8;
+    using Mask = HashBitMask<kWidth, 3>;
+
+    static constexpr ::mystic::types::uint64_t kLsbs = 0x0101010101010101ull;
+    static constexpr ::mystic::types::uint64_t kMsbs = 0x8080808080808080ull;
+
+    explicit HashGroup(const hash_ctrl_t* ctrl) noexcept {
+        ::std::memcpy(&ctrl_, ctrl, sizeof(ctrl_));
+#if (MYSTIC_ARCH_ENDIANNESS == MYSTIC_ARCH_ENDIANNESS_BIG)
+        ctrl_ = __builtin_bswap64(ctrl_);
+#endif
+    }
+
+    /// May report false positives after a true one; callers compare keys anyway.
+    Mask match(::mystic::types::uint8_t tag) const noexcept {
+        const ::mystic::types::uint64_t x = ctrl_ ^ (kLsbs * tag);
+        return Mask((x - kLsbs) & ~x & kMsbs);
+    }
+
+    Mask match_empty() const noexcept {
+        return Mask((ctrl_ & ~(ctrl_ << 6)) & kMsbs);
+    }
+
+    Mask match_empty_or_deleted() const noexcept {
+        return Mask((ctrl_ & ~(ctrl_ << 7)) & kMsbs);
+    }
+
+    ::mystic::types::size_t count_leading_empty_or_deleted() const noexcept {
+        const ::mystic::types::uint64_t stops = (ctrl_ | ~(ctrl_ >> 7)) & kLsbs;
+        return (stops == 0) ? kWidth : static_cast<::mystic::types::size_t>(::mystic::bit::countr_zero(stops)) >> 3;
+    }
+
+    ::mystic::types::uint64_t ctrl_;
+};
+#endif
+
+/**
+ * @brief Triangular probe over groups; visits every group of a power of two table.
+ */
+class HashProbe {
+public:
+    HashProbe(::mystic::types::size_t hash, ::mystic::types::size_t mask) noexcept
+        : mask_(mask), offset_(hash & mask) {}
+
+    ::mystic::types::size_t offset() const noexcept {
+        return offset_;
+    }
+
+    ::mystic::types::size_t offset(::mystic::types::size_t i) const noexcept {
+        return (offset_ + i) & mask_;
+    }
+
+    void next() noexcept {
+        index_ += HashGroup::kWidth;
+        offset_ = (offset_ + index_) & mask_;
+    }
+
+private:
+    ::mystic::types::size_t mask_;
+    ::mystic::types::size_t offset_;
+    ::mystic::types::size_t index_ = 0;
+};
+
+/**
+ * @brief Default key equality: transparent when the hasher is.
+ */
+template <typename Key, typename Hash, typename = void>
+struct hash_default_equal {
+    using type = ::std::equal_to<Key>;
+};
+
+template <typename Key, typename Hash>
+struct hash_default_equal<Key, Hash, ::std::void_t<typename Hash::is_transparent>> {
+    using type = ::std::equal_to<>;
+};
+
+template <typename Type, typename = void>
+struct hash_is_transparent : ::std::false_type {};
+
+template <typename Type>
+struct hash_is_transparent<Type, ::std::void_t<typename Type::is_transparent>> : ::std::true_type {};
+
+/**
+ * @brief Lookup argument type: the caller's type when transparent, else the key.
+ *
+ * @details
+ * A member alias of a non-dependent class, so `Lookup` stays deducible.
+ */
+template <bool Transparent>
+struct hash_key_arg {
+    template <typename Lookup, typename Key>
+    using type = Lookup;
+};
+
+template <>
+struct hash_key_arg<false> {
+    template <typename Lookup, typename Key>
+    using type = Key;
+};
+
+/* =============================================
+    Table
+   --------------------------------------------- */
+
+/**
+ * @brief Open-addressing table of `Policy::slot_type`.
+ *
+ * @details
+ * `Policy` provides `slot_type`, `key_type`, `key(const slot_type&)`, and
+ * `relocate(slot_type* dest, slot_type* source)`. Capacities are
+ * `2^k - 1`; the control array holds `capacity` bytes, the sentinel, and
+ * `kWidth - 1` clones of the first bytes, so any group load starting at
+ * a slot stays in bounds.
+ */
+template <typename Policy, typename Hash, typename Equal>
+class hash_table {
+public:
+    using slot_type = typename Policy::slot_type;
+    using key_type  = typename Policy::key_type;
+    using size_type = ::mystic::types::size_t;
+
+    static constexpr size_type kWidth = HashGroup::kWidth;
+
+    /// Heterogeneous lookup is enabled when both functors are transparent.
+    template <typename Lookup>
+    using key_arg = typename hash_key_arg<hash_is_transparent<Hash>::value &&
+                                          hash_is_transparent<Equal>::value>::template type<Lookup, key_type>;
+
+    /**
+     * @brief Forward iterator over full slots.
+     */
+    template <bool Const>
+    class basic_iterator {
+    public:
+        using iterator_category = ::std::forward_iterator_tag;
+        using value_type        = slot_type;
+        using difference_type   = ::mystic::types::ptrdiff_t;
+        using pointer           = ::std::conditional_t<Const, const slot_type*, slot_type*>;
+        using reference         = ::std::conditional_t<Const, const slot_type&, slot_type&>;
+
+        basic_iterator() noexcept = default;
+
+        template <bool OtherConst, typename = ::std::enable_if_t<Const && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst>& other) noexcept
+            : ctrl_(other.ctrl_), slot_(other.slot_) {}
+
+        reference operator*() const noexcept {
+            return *slot_;
+        }
+
+        pointer operator->() const noexcept {
+            return slot_;
+        }
+
+        basic_iterator& operator++() noexcept {
+            ++ctrl_;
+            ++slot_;
+            skip_empty_or_deleted();
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept {
+            basic_iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+            return lhs.ctrl_ == rhs.ctrl_;
+        }
+
+        friend bool operator!=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+            return lhs.ctrl_ != rhs.ctrl_;
+        }
+
+    private:
+        friend class hash_table;
+
+        template <bool>
+        friend class basic_iterator;
+
+        basic_iterator(const hash_ctrl_t* ctrl, slot_type* slot) noexcept
+            : ctrl_(ctrl), slot_(slot) {}
+
+        void skip_empty_or_deleted() noexcept {
+            while (*ctrl_ < kCtrlSentinel) {
+                const size_type shift = HashGroup(ctrl_).count_leading_empty_or_deleted();
+                ctrl_ += shift;
+                slot_ += shift;
+            }
+            if (*ctrl_ == kCtrlSentinel) {
+                ctrl_ = nullptr;
+                slot_ = nullptr;
+            }
+        }
+
+        const hash_ctrl_t* ctrl_ = nullptr;
+        slot_type* slot_ = nullptr;
+    };
+
+    using iterator       = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    explicit hash_table(::std::pmr::memory_resource* upstream = nullptr, const Hash& hash = Hash(),
+                        const Equal& equal = Equal()) noexcept
+        : upstream_(upstream), hash_(hash), equal_(equal) {}
+
+    hash_table(const hash_table& other)
+        : upstream_(other.upstream_), hash_(other.hash_), equal_(other.equal_) {
+        reserve(other.size_);
+#if defined(__cpp_exceptions)
+        try {
+            copy_slots(other);
+        } catch (...) {
+            // A slot is only marked full once constructed, so this destroys exactly those.
+            destroy_slots();
+            release();
+            throw;
+        }
+#else
+        copy_slots(other);
+#endif
+    }
+
+    hash_table(hash_table&& other) noexcept
+        : ctrl_(::std::exchange(other.ctrl_, empty_ctrl())), slots_(::std::exchange(other.slots_, nullptr)),
+          capacity_(::std::exchange(other.capacity_, 0)), size_(::std::exchange(other.size_, 0)),
+          growth_left_(::std::exchange(other.growth_left_, 0)), upstream_(other.upstream_),
+          hash_(::std::move(other.hash_)), equal_(::std::move(other.equal_)) {}
+
+    hash_table& operator=(const hash_table& other) {
+        if (this != &other) {
+            hash_table copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    hash_table& operator=(hash_table&& other) noexcept {
+        if (this != &other) {
+            destroy_slots();
+            release();
+            ctrl_ = ::std::exchange(other.ctrl_, empty_ctrl());
+            slots_ = ::std::exchange(other.slots_, nullptr);
+            capacity_ = ::std::exchange(other.capacity_, 0);
+            size_ = ::std::exchange(other.size_, 0);
+            growth_left_ = ::std::exchange(other.growth_left_, 0);
+            upstream_ = other.upstream_;
+            hash_ = ::std::move(other.hash_);
+            equal_ = ::std::move(other.equal_);
+        }
+        return *this;
+    }
+
+    ~hash_table() {
+        destroy_slots();
+        release();
+    }
+
+    /* ---------------- Iteration, and Capacity ---------------- */
+
+    iterator begin() noexcept {
+        iterator it(ctrl_, slots_);
+        it.skip_empty_or_deleted();
+        return it;
+    }
+
+    const_iterator begin() const noexcept {
+        return const_cast<hash_table*>(this)->begin();
+    }
+
+    iterator end() noexcept {
+        return iterator();
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator();
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    size_type capacity() const noexcept {
+        return capacity_;
+    }
+
+    float load_factor() const noexcept {
+        return (capacity_ != 0) ? static_cast<float>(size_) / static_cast<float>(capacity_) : 0.0f;
+    }
+
+    ::std::pmr::memory_resource* upstream() const noexcept {
+        return upstream_;
+    }
+
+    /**
+     * @brief Ensures room for `count` elements without rehashing.
+     */
+    void reserve(size_type count) {
+        if (count > size_ + growth_left_) {
+            resize(normalize_capacity(growth_to_capacity(count)));
+        }
+    }
+
+    /**
+     * @brief Destroys every element, keeping the capacity.
+     */
+    void clear() noexcept {
+        destroy_slots();
+        if (capacity_ != 0) {
+            reset_ctrl();
+        }
+        size_ = 0;
+        growth_left_ = capacity_to_growth(capacity_);
+    }
+
+    void swap(hash_table& other) noexcept {
+        using ::std::swap;
+        swap(ctrl_, other.ctrl_);
+        swap(slots_, other.slots_);
+        swap(capacity_, other.capacity_);
+        swap(size_, other.size_);
+        swap(growth_left_, other.growth_left_);
+        swap(upstream_, other.upstream_);
+        swap(hash_, other.hash_);
+        swap(equal_, other.equal_);
+    }
+
+    /* ---------------- Lookup ---------------- */
+
+    template <typename Lookup>
+    iterator find(const Lookup& key) noexcept {
+        const size_type index = find_index(key, hash_(key));
+        return (index != kNotFound) ? iterator(ctrl_ + index, slots_ + index) : end();
+    }
+
+    template <typename Lookup>
+    const_iterator find(const Lookup& key) const noexcept {
+        return const_cast<hash_table*>(this)->find(key);
+    }
+
+    template <typename Lookup>
+    bool contains(const Lookup& key) const noexcept {
+        return const_cast<hash_table*>(this)->find_index(key, hash_(key)) != kNotFound;
+    }
+
+    /* ---------------- Modifiers ---------------- */
+
+    /**
+     * @brief Finds `key`, or claims a slot for it.
+     *
+     * @returns The slot index, and true if the slot is new (and must be
+     * constructed by the caller before any other table operation).
+     */
+    template <typename Lookup>
+    ::std::pair<size_type, bool> find_or_prepare_insert(const Lookup& key) {
+        const size_type hash = hash_(key);
+        const size_type found = find_index(key, hash);
+        if (found != kNotFound) {
+            return {found, false};
+        }
+        return {prepare_insert(hash), true};
+    }
+
+    /**
+     * @brief Marks a claimed slot as unused again (its construction threw).
+     */
+    void abandon_insert(size_type index) noexcept {
+        erase_meta(index);
+    }
+
+    slot_type* slot(size_type index) noexcept {
+        return slots_ + index;
+    }
+
+    iterator iterator_at(size_type index) noexcept {
+        return iterator(ctrl_ + index, slots_ + index);
+    }
+
+    iterator to_mutable(const_iterator it) noexcept {
+        return iterator(it.ctrl_, it.slot_);
+    }
+
+    /**
+     * @brief Erases the element at `it`.
+     */
+    void erase(const_iterator it) noexcept {
+        const size_type index = static_cast<size_type>(it.ctrl_ - ctrl_);
+        slots_[index].~slot_type();
+        erase_meta(index);
+    }
+
+    template <typename Lookup>
+    size_type erase_key(const Lookup& key) noexcept {
+        const size_type index = find_index(key, hash_(key));
+        if (index == kNotFound) {
+            return 0;
+        }
+        slots_[index].~slot_type();
+        erase_meta(index);
+        return 1;
+    }
+
+private:
+    static constexpr size_type kNotFound = static_cast<size_type>(-1);
+
+    static constexpr bool kOverAligned = alignof(slot_type) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    static hash_ctrl_t* empty_ctrl() noexcept {
+        return const_cast<hash_ctrl_t*>(kEmptyGroup);
+    }
+
+    /// Maximum elements before growing, at a 7/8 load factor.
+    static constexpr size_type capacity_to_growth(size_type capacity) noexcept {
+        return ((kWidth == 8) && (capacity == 7)) ? 6 : capacity - capacity / 8;
+    }
+
+    static constexpr size_type growth_to_capacity(size_type growth) noexcept {
+        return ((kWidth == 8) && (growth == 7)) ? 8 : growth + (growth - 1) / 7;
+    }
+
+    static size_type normalize_capacity(size_type count) noexcept {
+        return (count != 0) ? static_cast<size_type>(::mystic::bit::bit_ceil(count + 1)) - 1 : 1;
+    }
+
+    static size_type ctrl_bytes(size_type capacity) noexcept {
+        return capacity + kWidth;
+    }
+
+    static size_type slot_offset(size_type capacity) noexcept {
+        return (ctrl_bytes(capacity) + alignof(slot_type) - 1) & ~(alignof(slot_type) - 1);
+    }
+
+    static size_type alloc_size(size_type capacity) noexcept {
+        return slot_offset(capacity) + capacity * sizeof(slot_type);
+    }
+
+    static constexpr size_type kAllocAlign = (alignof(slot_type) > 16) ? alignof(slot_type) : 16;
+
+    /// Salts the probe start with the table address, so copying one table
+    /// into another in iteration order does not cluster.
+    size_type probe_start(size_type hash) const noexcept {
+        return (hash >> 7) ^ (reinterpret_cast<::mystic::types::uintptr_t>(ctrl_) >> 12);
+    }
+
+    static ::mystic::types::uint8_t tag_of(size_type hash) noexcept {
+        return static_cast<::mystic::types::uint8_t>(hash & 0x7F);
+    }
+
+    void set_ctrl(size_type index, ::mystic::types::uint8_t tag) noexcept {
+        set_ctrl_raw(index, static_cast<hash_ctrl_t>(tag));
+    }
+
+    void set_ctrl_raw(size_type index, hash_ctrl_t value) noexcept {
+        ctrl_[index] = value;
+        ctrl_[((index - (kWidth - 1)) & capacity_) + ((kWidth - 1) & capacity_)] = value;
+    }
+
+    template <typename Lookup>
+    size_type find_index(const Lookup& key, size_type hash) const noexcept {
+        HashProbe probe(probe_start(hash), capacity_);
+        const ::mystic::types::uint8_t tag = tag_of(hash);
+        while (true) {
+            const HashGroup group(ctrl_ + probe.offset());
+            for (const size_type i : group.match(tag)) {
+                const size_type index = probe.offset(i);
+                if (equal_(Policy::key(slots_[index]), key)) {
+                    return index;
+                }
+            }
+            if (group.match_empty()) {
+                return kNotFound;
+            }
+            probe.next();
+        }
+    }
+
+    size_type find_first_non_full(size_type hash) const noexcept {
+        HashProbe probe(probe_start(hash), capacity_);
+        while (true) {
+            const typename HashGroup::Mask mask = HashGroup(ctrl_ + probe.offset()).match_empty_or_deleted();
+            if (mask) {
+                return probe.offset(mask.lowest());
+            }
+            probe.next();
+        }
+    }
+
+    size_type prepare_insert(size_type hash) {
+        size_type index = find_first_non_full(hash);
+        if ((growth_left_ == 0) && (ctrl_[index] != kCtrlDeleted)) {
+            grow();
+            index = find_first_non_full(hash);
+        }
+        growth_left_ -= (ctrl_[index] == kCtrlEmpty) ? 1 : 0;
+        set_ctrl(index, tag_of(hash));
+        ++size_;
+        return index;
+    }
+
+    /**
+     * @brief Frees a slot's control byte; empty if no probe can have passed it.
+     */
+    void erase_meta(size_type index) noexcept {
+        --size_;
+        const size_type before = (index - kWidth) & capacity_;
+        const typename HashGroup::Mask empty_after = HashGroup(ctrl_ + index).match_empty();
+        const typename HashGroup::Mask empty_before = HashGroup(ctrl_ + before).match_empty();
+
+        // A probe window covering this slot always saw an empty slot first.
+        const bool was_never_full = empty_before && empty_after &&
+                                    (empty_after.trailing_zeros() + empty_before.leading_zeros() < kWidth);
+        set_ctrl_raw(index, was_never_full ? kCtrlEmpty : kCtrlDeleted);
+        growth_left_ += was_never_full ? 1 : 0;
+    }
+
+    /**
+     * @brief Doubles, or rebuilds in place when tombstones fill the table.
+     */
+    MYSTIC_NOINLINE void grow() {
+        if ((capacity_ > kWidth) && (size_ * 32 <= capacity_ * 25)) {
+            resize(capacity_);
+        } else {
+            resize(capacity_ * 2 + 1);
+        }
+    }
+
+    void reset_ctrl() noexcept {
+        ::std::memset(ctrl_, static_cast<unsigned char>(kCtrlEmpty), ctrl_bytes(capacity_));
+        ctrl_[capacity_] = kCtrlSentinel;
+    }
+
+    MYSTIC_NOINLINE void resize(size_type capacity) {
+        hash_ctrl_t* old_ctrl = ctrl_;
+        slot_type* old_slots = slots_;
+        const size_type old_capacity = capacity_;
+
+        void* block = allocate_block(alloc_size(capacity));
+        ctrl_ = static_cast<hash_ctrl_t*>(block);
+        slots_ = reinterpret_cast<slot_type*>(static_cast<char*>(block) + slot_offset(capacity));
+        capacity_ = capacity;
+        reset_ctrl();
+        growth_left_ = capacity_to_growth(capacity) - size_;
+
+        for (size_type i = 0; i < old_capacity; ++i) {
+            if (old_ctrl[i] >= 0) {
+                const size_type hash = hash_(Policy::key(old_slots[i]));
+                const size_type index = find_first_non_full(hash);
+                set_ctrl(index, tag_of(hash));
+                Policy::relocate(slots_ + index, old_slots + i);
+            }
+        }
+        if (old_capacity != 0) {
+            deallocate_block(old_ctrl, alloc_size(old_capacity));
+        }
+    }
+
+    void* allocate_block(size_type bytes) {
+        if (upstream_ != nullptr) {
+            return upstream_->allocate(bytes, kAllocAlign);
+        }
+        if constexpr (kAllocAlign > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            return ::operator new(bytes, ::std::align_val_t(kAllocAlign));
+        } else {
+            return ::operator new(bytes);
+        }
+    }
+
+    void deallocate_block(void* block, size_type bytes) noexcept {
+        if (upstream_ != nullptr) {
+            upstream_->deallocate(block, bytes, kAllocAlign);
+        } else if constexpr (kAllocAlign > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            ::operator delete(block, bytes, ::std::align_val_t(kAllocAlign));
+        } else {
+            ::operator delete(block, bytes);
+        }
+    }
+
+    /// Copies every slot of `other` into this table, which has room for them.
+    void copy_slots(const hash_table& other) {
+        for (const_iterator it = other.begin(); it != other.end(); ++it) {
+            const size_type hash = hash_(Policy::key(*it));
+            const size_type index = find_first_non_full(hash);
+            ::new (static_cast<void*>(slots_ + index)) slot_type(*it);
+            set_ctrl(index, tag_of(hash));
+            --growth_left_;
+            ++size_;
+        }
+    }
+
+    void destroy_slots() noexcept {
+        if constexpr (!::std::is_trivially_destructible_v<slot_type>) {
+            for (size_type i = 0; i < capacity_; ++i) {
+                if (ctrl_[i] >= 0) {
+                    slots_[i].~slot_type();
+                }
+            }
+        }
+    }
+
+    void release() noexcept {
+        if (capacity_ != 0) {
+            deallocate_block(ctrl_, alloc_size(capacity_));
+        }
+        ctrl_ = empty_ctrl();
+        slots_ = nullptr;
+        capacity_ = 0;
+        size_ = 0;
+        growth_left_ = 0;
+    }
+
+    hash_ctrl_t* ctrl_ = empty_ctrl();
+    slot_type* slots_ = nullptr;
+    size_type capacity_ = 0;
+    size_type size_ = 0;
+    size_type growth_left_ = 0;
+    ::std::pmr::memory_resource* upstream_ = nullptr;
+    MYSTIC_NO_UNIQUE_ADDRESS Hash hash_;
+    MYSTIC_NO_UNIQUE_ADDRESS Equal equal_;
+};
+
+} // namespace internal
+} // namespace mystic
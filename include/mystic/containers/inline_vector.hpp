@@ -0,0 +1,449 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/inline_vector.hpp
+ * @file inline_vector.hpp
+ * @brief Defines a fixed-capacity vector with inline storage.
+ *
+ * @details
+ * `inline_vector<T, N>` holds at most `N` elements inside the object and
+ * never allocates. `try_push_back()`, and `try_emplace_back()` report a
+ * full vector by returning null; the plain forms treat it as an
+ * allocation failure (`std::bad_alloc`, or abort without exceptions).
+ *
+ * Insertion, and erasure use `memmove` when `traits::is_trivially_relocatable`
+ * holds for `T`, and the vector itself is trivially relocatable whenever
+ * `T` is. Inserting, or erasing before the end shifts elements in place,
+ * so it requires `T` to be trivially relocatable, or nothrow move
+ * constructible.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/inline_vector.hpp"
+ *
+ * mystic::inline_vector<Frame, 16> frames;
+ * if (frames.try_push_back(frame) == nullptr) {
+ *     // Drop frames past the sixteenth.
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "mystic/memory/relocate.hpp"
+#include "mystic/memory/upstream.hpp"
+#include "mystic/traits/is_trivially_relocatable.hpp"
+#include "mystic/types/standard_def.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @brief Vector with a fixed inline capacity of `N` elements.
+ *
+ * @tparam Type Element type.
+ * @tparam N Capacity.
+ */
+template <typename Type, ::mystic::types::size_t N>
+class inline_vector {
+public:
+    using value_type             = Type;
+    using size_type              = ::mystic::types::size_t;
+    using difference_type        = ::mystic::types::ptrdiff_t;
+    using reference              = Type&;
+    using const_reference        = const Type&;
+    using pointer                = Type*;
+    using const_pointer          = const Type*;
+    using iterator               = Type*;
+    using const_iterator         = const Type*;
+    using reverse_iterator       = ::std::reverse_iterator<iterator>;
+    using const_reverse_iterator = ::std::reverse_iterator<const_iterator>;
+
+    inline_vector() noexcept = default;
+
+    explicit inline_vector(size_type count) {
+        resize(count);
+    }
+
+    inline_vector(size_type count, const Type& value) {
+        resize(count, value);
+    }
+
+    template <typename Iterator,
+              typename = ::std::enable_if_t<!::std::is_integral_v<Iterator>>>
+    inline_vector(Iterator first, Iterator last) {
+        append(first, last);
+    }
+
+    inline_vector(::std::initializer_list<Type> values) {
+        append(values.begin(), values.end());
+    }
+
+    inline_vector(const inline_vector& other) {
+        append(other.begin(), other.end());
+    }
+
+    /**
+     * @brief Relocates the elements; `other` is left empty.
+     */
+    inline_vector(inline_vector&& other) noexcept(kNothrowRelocate) {
+        ::mystic::memory::relocate_n(other.data(), other.size_, data());
+        size_ = ::std::exchange(other.size_, 0);
+    }
+
+    inline_vector& operator=(const inline_vector& other) {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    inline_vector& operator=(inline_vector&& other) noexcept(kNothrowRelocate) {
+        if (this != &other) {
+            clear();
+            ::mystic::memory::relocate_n(other.data(), other.size_, data());
+            size_ = ::std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    inline_vector& operator=(::std::initializer_list<Type> values) {
+        assign(values.begin(), values.end());
+        return *this;
+    }
+
+    ~inline_vector() {
+        ::std::destroy_n(data(), size_);
+    }
+
+    /* =============================================
+        Access
+       --------------------------------------------- */
+
+    reference operator[](size_type index) noexcept {
+        return data()[index];
+    }
+
+    const_reference operator[](size_type index) const noexcept {
+        return data()[index];
+    }
+
+    reference front() noexcept {
+        return data()[0];
+    }
+
+    const_reference front() const noexcept {
+        return data()[0];
+    }
+
+    reference back() noexcept {
+        return data()[size_ - 1];
+    }
+
+    const_reference back() const noexcept {
+        return data()[size_ - 1];
+    }
+
+    pointer data() noexcept {
+        return reinterpret_cast<Type*>(storage_);
+    }
+
+    const_pointer data() const noexcept {
+        return reinterpret_cast<const Type*>(storage_);
+    }
+
+    iterator begin() noexcept {
+        return data();
+    }
+
+    const_iterator begin() const noexcept {
+        return data();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return data();
+    }
+
+    iterator end() noexcept {
+        return data() + size_;
+    }
+
+    const_iterator end() const noexcept {
+        return data() + size_;
+    }
+
+    const_iterator cend() const noexcept {
+        return data() + size_;
+    }
+
+    reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    /* =============================================
+        Capacity
+       --------------------------------------------- */
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    static constexpr size_type capacity() noexcept {
+        return N;
+    }
+
+    static constexpr size_type max_size() noexcept {
+        return N;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    bool full() const noexcept {
+        return size_ == N;
+    }
+
+    /* =============================================
+        Modifiers
+       --------------------------------------------- */
+
+    void clear() noexcept {
+        ::std::destroy_n(data(), size_);
+        size_ = 0;
+    }
+
+    void push_back(const Type& value) {
+        emplace_back(value);
+    }
+
+    void push_back(Type&& value) {
+        emplace_back(::std::move(value));
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        if (size_ == N) {
+            ::mystic::memory::internal::throw_bad_alloc();
+        }
+        Type* slot = ::new (static_cast<void*>(data() + size_)) Type(::std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    /**
+     * @brief Appends a copy unless full.
+     *
+     * @returns The new element, or null if the vector is full.
+     */
+    Type* try_push_back(const Type& value) {
+        return try_emplace_back(value);
+    }
+
+    Type* try_push_back(Type&& value) {
+        return try_emplace_back(::std::move(value));
+    }
+
+    template <typename... Args>
+    Type* try_emplace_back(Args&&... args) {
+        if (size_ == N) {
+            return nullptr;
+        }
+        Type* slot = ::new (static_cast<void*>(data() + size_)) Type(::std::forward<Args>(args)...);
+        ++size_;
+        return slot;
+    }
+
+    void pop_back() noexcept {
+        --size_;
+        data()[size_].~Type();
+    }
+
+    iterator insert(const_iterator pos, const Type& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, Type&& value) {
+        return emplace(pos, ::std::move(value));
+    }
+
+    /**
+     * @brief Constructs an element before `pos`, shifting the tail right.
+     */
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        const size_type index = static_cast<size_type>(pos - data());
+        if (index == size_) {
+            emplace_back(::std::forward<Args>(args)...);
+            return data() + index;
+        }
+        if (size_ == N) {
+            ::mystic::memory::internal::throw_bad_alloc();
+        }
+
+        // Built first, as the arguments may refer to elements about to move.
+        Type value(::std::forward<Args>(args)...);
+        ::mystic::memory::shift_right(data() + index, data() + size_, 1);
+        ::new (static_cast<void*>(data() + index)) Type(::std::move(value));
+        ++size_;
+        return data() + index;
+    }
+
+    iterator erase(const_iterator pos) noexcept {
+        return erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) noexcept {
+        Type* begin = data() + (first - data());
+        const size_type count = static_cast<size_type>(last - first);
+        if (count != 0) {
+            ::std::destroy_n(begin, count);
+            ::mystic::memory::shift_left(begin, data() + size_, count);
+            size_ -= count;
+        }
+        return begin;
+    }
+
+    void resize(size_type count) {
+        if (count > N) {
+            ::mystic::memory::internal::throw_bad_alloc();
+        }
+        if (count <= size_) {
+            ::std::destroy_n(data() + count, size_ - count);
+        } else {
+            ::std::uninitialized_value_construct_n(data() + size_, count - size_);
+        }
+        size_ = count;
+    }
+
+    void resize(size_type count, const Type& value) {
+        if (count > N) {
+            ::mystic::memory::internal::throw_bad_alloc();
+        }
+        if (count <= size_) {
+            ::std::destroy_n(data() + count, size_ - count);
+        } else {
+            ::std::uninitialized_fill_n(data() + size_, count - size_, value);
+        }
+        size_ = count;
+    }
+
+    void assign(size_type count, const Type& value) {
+        const Type copy(value);
+        clear();
+        resize(count, copy);
+    }
+
+    template <typename Iterator,
+              typename = ::std::enable_if_t<!::std::is_integral_v<Iterator>>>
+    void assign(Iterator first, Iterator last) {
+        clear();
+        append(first, last);
+    }
+
+    void assign(::std::initializer_list<Type> values) {
+        assign(values.begin(), values.end());
+    }
+
+    /**
+     * @brief Appends a range (the range must not alias this vector).
+     */
+    template <typename Iterator>
+    void append(Iterator first, Iterator last) {
+        using category = typename ::std::iterator_traits<Iterator>::iterator_category;
+        if constexpr (::std::is_base_of_v<::std::forward_iterator_tag, category>) {
+            const size_type count = static_cast<size_type>(::std::distance(first, last));
+            if (count > N - size_) {
+                ::mystic::memory::internal::throw_bad_alloc();
+            }
+            ::std::uninitialized_copy(first, last, data() + size_);
+            size_ += count;
+        } else {
+            for (; first != last; ++first) {
+                emplace_back(*first);
+            }
+        }
+    }
+
+    void swap(inline_vector& other) noexcept(kNothrowRelocate) {
+        inline_vector temp(::std::move(other));
+        other = ::std::move(*this);
+        *this = ::std::move(temp);
+    }
+
+    friend bool operator==(const inline_vector& lhs, const inline_vector& rhs) {
+        return (lhs.size_ == rhs.size_) && ::std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    friend bool operator!=(const inline_vector& lhs, const inline_vector& rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    static constexpr bool kNothrowRelocate = ::mystic::memory::is_nothrow_relocatable_v<Type>;
+
+    size_type size_ = 0;
+    alignas(Type) unsigned char storage_[sizeof(Type) * ((N != 0) ? N : 1)];
+};
+
+template <typename Type, ::mystic::types::size_t N>
+inline void swap(inline_vector<Type, N>& lhs, inline_vector<Type, N>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+    lhs.swap(rhs);
+}
+
+/**
+ * @namespace mystic::traits
+ * @ingroup Traits
+ * @brief This namespace defines type traits.
+ */
+namespace traits {
+
+/**
+ * @brief Inline vectors hold no self references, so they relocate like their elements.
+ */
+template <typename Type, ::mystic::types::size_t N>
+struct is_trivially_relocatable<::mystic::inline_vector<Type, N>> : is_trivially_relocatable<Type> {};
+
+} // namespace traits
+} // namespace mystic
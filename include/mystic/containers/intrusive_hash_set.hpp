@@ -0,0 +1,365 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/intrusive_hash_set.hpp
+ * @file intrusive_hash_set.hpp
+ * @brief Defines a chained hash set of objects carrying their own links.
+ *
+ * @details
+ * `intrusive_hash_set<T, Offset, KeyOf>` chains objects through the
+ * `HashHook` at byte `Offset` of `T`, keyed by `KeyOf()(object)`. The
+ * hook caches the hash, so chains are walked without rehashing, and
+ * most mismatches skip the key compare.
+ *
+ * The bucket array is allocated by the constructor, and by `rehash`
+ * only: insertion, and erasure never allocate, and never rehash. Size
+ * the set for its expected load (or call `rehash` off the hot path);
+ * lookups stay correct at any load, just slower past about one element
+ * per bucket.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/intrusive_hash_set.hpp"
+ *
+ * struct Connection {
+ *     mystic::types::uint64_t id;
+ *     mystic::HashHook by_id;
+ * };
+ *
+ * struct ConnectionId {
+ *     mystic::types::uint64_t operator()(const Connection& c) const noexcept { return c.id; }
+ * };
+ *
+ * mystic::intrusive_hash_set<Connection, MYSTIC_OFFSETOF(Connection, by_id), ConnectionId> live(1024);
+ *
+ * live.insert(connection);
+ * Connection* found = live.find(42);
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mystic/attributes/no_unique_address.hpp"
+#include "mystic/containers/intrusive_hook.hpp"
+#include "mystic/hash/fast_hash.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+#include "mystic/utility/bit.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @brief Separate-chaining hash set through a `HashHook` member.
+ *
+ * @details
+ * Keys are unique. Not copyable; movable (a moved-from set is empty,
+ * and falls back to two inline buckets, so it stays usable, and moving
+ * never allocates).
+ *
+ * @tparam Type Element type (standard layout, for the hook offset).
+ * @tparam HookOffset Byte offset of the `HashHook` in `Type`.
+ * @tparam KeyOf Functor returning the key of an element.
+ * @tparam Hash Key hasher (`hash::Hasher<Key>` by default).
+ * @tparam Equal Key equality.
+ */
+template <typename Type, ::mystic::types::size_t HookOffset, typename KeyOf,
+          typename Key = ::std::decay_t<::std::invoke_result_t<const KeyOf&, const Type&>>,
+          typename Hash = ::mystic::hash::Hasher<Key>, typename Equal = ::std::equal_to<Key>>
+class intrusive_hash_set {
+public:
+    using key_type   = Key;
+    using value_type = Type;
+    using size_type  = ::mystic::types::size_t;
+    using hasher     = Hash;
+    using key_equal  = Equal;
+
+    /**
+     * @brief Empty set with `bucket_count` buckets (rounded up to a power of two).
+     */
+    explicit intrusive_hash_set(size_type bucket_count = 16, const KeyOf& key_of = KeyOf(),
+                                const Hash& hash = Hash(), const Equal& equal = Equal())
+        : key_of_(key_of), hash_(hash), equal_(equal) {
+        rehash(bucket_count);
+    }
+
+    intrusive_hash_set(const intrusive_hash_set&) = delete;
+    intrusive_hash_set& operator=(const intrusive_hash_set&) = delete;
+
+    intrusive_hash_set(intrusive_hash_set&& other) noexcept
+        : key_of_(::std::move(other.key_of_)), hash_(::std::move(other.hash_)), equal_(::std::move(other.equal_)),
+          storage_(::std::move(other.storage_)), shift_(other.shift_), size_(other.size_) {
+        // Chains never point into the bucket array, so inline heads move by copy.
+        for (size_type i = 0; i < kInlineBuckets; ++i) {
+            inline_buckets_[i] = other.inline_buckets_[i];
+            other.inline_buckets_[i] = nullptr;
+        }
+        other.storage_.clear();
+        other.shift_ = kInlineShift;
+        other.size_ = 0;
+    }
+
+    intrusive_hash_set& operator=(intrusive_hash_set&& other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Unlinks every element.
+     */
+    ~intrusive_hash_set() {
+        clear();
+    }
+
+    /* =============================================
+        Capacity
+       --------------------------------------------- */
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    size_type bucket_count() const noexcept {
+        return storage_.empty() ? kInlineBuckets : storage_.size();
+    }
+
+    float load_factor() const noexcept {
+        return static_cast<float>(size_) / static_cast<float>(bucket_count());
+    }
+
+    /**
+     * @brief Relinks every element into `bucket_count` buckets (a power of two, at least 2).
+     *
+     * @details
+     * The only operation besides construction that allocates; on
+     * allocation failure the set is unchanged.
+     */
+    void rehash(size_type bucket_count) {
+        if (bucket_count < 2) {
+            bucket_count = 2;
+        }
+        bucket_count = ::mystic::bit::bit_ceil(bucket_count);
+        if (bucket_count == this->bucket_count()) {
+            return;
+        }
+        ::std::vector<HashHook*> buckets(bucket_count, nullptr);
+        const unsigned int shift = 64 - static_cast<unsigned int>(
+                                            ::mystic::bit::countr_zero(static_cast<::mystic::types::uint64_t>(bucket_count)));
+        HashHook** heads = this->buckets();
+        for (size_type i = 0, n = this->bucket_count(); i < n; ++i) {
+            while (heads[i] != nullptr) {
+                HashHook* hook = heads[i];
+                heads[i] = hook->next;
+                HashHook*& target = buckets[bucket_index(hook->hash, shift)];
+                hook->next = target;
+                target = hook;
+            }
+        }
+        storage_.swap(buckets);
+        shift_ = shift;
+    }
+
+    /* =============================================
+        Lookup
+       --------------------------------------------- */
+
+    Type* find(const Key& key) noexcept {
+        if (size_ == 0) {
+            return nullptr;
+        }
+        const size_type hash = hash_(key);
+        for (HashHook* hook = buckets()[bucket_index(hash, shift_)]; hook != nullptr; hook = hook->next) {
+            if ((hook->hash == hash) && equal_(key_of_(*owner(hook)), key)) {
+                return owner(hook);
+            }
+        }
+        return nullptr;
+    }
+
+    const Type* find(const Key& key) const noexcept {
+        return const_cast<intrusive_hash_set*>(this)->find(key);
+    }
+
+    bool contains(const Key& key) const noexcept {
+        return find(key) != nullptr;
+    }
+
+    /**
+     * @brief Calls `fn(element)` for every element, in no particular order.
+     */
+    template <typename Fn>
+    void for_each(Fn&& fn) {
+        HashHook** heads = buckets();
+        for (size_type i = 0, n = bucket_count(); i < n; ++i) {
+            for (HashHook* hook = heads[i]; hook != nullptr;) {
+                // Read the link first, so `fn` may erase the element.
+                HashHook* next = hook->next;
+                fn(*owner(hook));
+                hook = next;
+            }
+        }
+    }
+
+    /* =============================================
+        Modifiers
+       --------------------------------------------- */
+
+    /**
+     * @brief Links `value` (which must not be in this set) unless its key is present.
+     *
+     * @returns The element with that key, and true if it is `value`.
+     */
+    ::std::pair<Type*, bool> insert(Type& value) noexcept {
+        const Key& key = key_of_(value);
+        if (Type* existing = find(key)) {
+            return {existing, false};
+        }
+        HashHook* hook = internal::owner_hook<HashHook, HookOffset>(value);
+        hook->hash = hash_(key);
+        HashHook*& head = buckets()[bucket_index(hook->hash, shift_)];
+        hook->next = head;
+        head = hook;
+        ++size_;
+        return {&value, true};
+    }
+
+    /**
+     * @brief Unlinks `value`; returns false if it is not in this set.
+     */
+    bool erase(Type& value) noexcept {
+        if (size_ == 0) {
+            return false;
+        }
+        HashHook* target = internal::owner_hook<HashHook, HookOffset>(value);
+        HashHook** link = &buckets()[bucket_index(target->hash, shift_)];
+        while (*link != nullptr) {
+            if (*link == target) {
+                *link = target->next;
+                target->next = nullptr;
+                --size_;
+                return true;
+            }
+            link = &(*link)->next;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Unlinks the element with `key`.
+     *
+     * @returns The unlinked element, or null if `key` is absent.
+     */
+    Type* erase_key(const Key& key) noexcept {
+        if (size_ == 0) {
+            return nullptr;
+        }
+        const size_type hash = hash_(key);
+        HashHook** link = &buckets()[bucket_index(hash, shift_)];
+        while (*link != nullptr) {
+            HashHook* hook = *link;
+            if ((hook->hash == hash) && equal_(key_of_(*owner(hook)), key)) {
+                *link = hook->next;
+                hook->next = nullptr;
+                --size_;
+                return owner(hook);
+            }
+            link = &hook->next;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Unlinks every element, in O(size + bucket count).
+     */
+    void clear() noexcept {
+        HashHook** heads = buckets();
+        for (size_type i = 0, n = bucket_count(); i < n; ++i) {
+            while (heads[i] != nullptr) {
+                HashHook* hook = heads[i];
+                heads[i] = hook->next;
+                hook->next = nullptr;
+            }
+        }
+        size_ = 0;
+    }
+
+    void swap(intrusive_hash_set& other) noexcept {
+        using ::std::swap;
+        swap(key_of_, other.key_of_);
+        swap(hash_, other.hash_);
+        swap(equal_, other.equal_);
+        storage_.swap(other.storage_);
+        for (size_type i = 0; i < kInlineBuckets; ++i) {
+            swap(inline_buckets_[i], other.inline_buckets_[i]);
+        }
+        swap(shift_, other.shift_);
+        swap(size_, other.size_);
+    }
+
+private:
+    /// Buckets of a set without a heap array (only ever moved-from).
+    static constexpr size_type kInlineBuckets = 2;
+    static constexpr unsigned int kInlineShift = 63;
+
+    HashHook** buckets() noexcept {
+        return storage_.empty() ? inline_buckets_ : storage_.data();
+    }
+
+    static Type* owner(HashHook* hook) noexcept {
+        return internal::hook_owner<Type, HookOffset>(hook);
+    }
+
+    /// Fibonacci hashing: the top bits of the product pick the bucket.
+    static size_type bucket_index(size_type hash, unsigned int shift) noexcept {
+        return static_cast<size_type>((static_cast<::mystic::types::uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> shift);
+    }
+
+    MYSTIC_NO_UNIQUE_ADDRESS KeyOf key_of_;
+    MYSTIC_NO_UNIQUE_ADDRESS Hash hash_;
+    MYSTIC_NO_UNIQUE_ADDRESS Equal equal_;
+    ::std::vector<HashHook*> storage_;
+    HashHook* inline_buckets_[kInlineBuckets] = {nullptr, nullptr};
+    unsigned int shift_ = kInlineShift;
+    size_type size_ = 0;
+};
+
+template <typename Type, ::mystic::types::size_t HookOffset, typename KeyOf, typename Key, typename Hash, typename Equal>
+inline void swap(intrusive_hash_set<Type, HookOffset, KeyOf, Key, Hash, Equal>& lhs,
+                 intrusive_hash_set<Type, HookOffset, KeyOf, Key, Hash, Equal>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mystic
@@ -0,0 +1,335 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/intrusive_heap.hpp
+ * @file intrusive_heap.hpp
+ * @brief Defines a pairing heap of objects carrying their own links.
+ *
+ * @details
+ * `intrusive_heap<T, Offset, Compare>` is a pairing heap threaded
+ * through the `HeapHook` at byte `Offset` of `T`. The least element
+ * under `Compare` is on top.
+ *
+ * Push, merge, and decrease-key are O(1); pop, and erasing any linked
+ * element are O(log n) amortized. Nothing allocates, which suits timer
+ * queues where entries are cancelled as often as they fire.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/intrusive_heap.hpp"
+ *
+ * struct Timer {
+ *     mystic::types::uint64_t deadline;
+ *     mystic::HeapHook hook;
+ * };
+ *
+ * struct EarlierDeadline {
+ *     bool operator()(const Timer& a, const Timer& b) const noexcept { return a.deadline < b.deadline; }
+ * };
+ *
+ * mystic::intrusive_heap<Timer, MYSTIC_OFFSETOF(Timer, hook), EarlierDeadline> timers;
+ *
+ * timers.push(timer);
+ * timers.erase(timer);        // Cancelled.
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <functional>
+#include <utility>
+
+#include "mystic/attributes/no_unique_address.hpp"
+#include "mystic/containers/intrusive_hook.hpp"
+#include "mystic/types/standard_def.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @brief Min pairing heap through a `HeapHook` member.
+ *
+ * @details
+ * Not copyable; movable.
+ *
+ * @tparam Type Element type (standard layout, for the hook offset).
+ * @tparam HookOffset Byte offset of the `HeapHook` in `Type`.
+ * @tparam Compare Strict weak order; the least element is on top.
+ */
+template <typename Type, ::mystic::types::size_t HookOffset, typename Compare = ::std::less<Type>>
+class intrusive_heap {
+public:
+    using value_type = Type;
+    using size_type  = ::mystic::types::size_t;
+
+    intrusive_heap() noexcept = default;
+
+    explicit intrusive_heap(const Compare& compare) noexcept
+        : compare_(compare) {}
+
+    intrusive_heap(const intrusive_heap&) = delete;
+    intrusive_heap& operator=(const intrusive_heap&) = delete;
+
+    intrusive_heap(intrusive_heap&& other) noexcept
+        : compare_(::std::move(other.compare_)), root_(other.root_), size_(other.size_) {
+        other.root_ = nullptr;
+        other.size_ = 0;
+    }
+
+    intrusive_heap& operator=(intrusive_heap&& other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Unlinks every element.
+     */
+    ~intrusive_heap() {
+        clear();
+    }
+
+    /* =============================================
+        Access
+       --------------------------------------------- */
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    /// Precondition: not empty.
+    Type& top() noexcept {
+        return *owner(root_);
+    }
+
+    const Type& top() const noexcept {
+        return *owner(root_);
+    }
+
+    /* =============================================
+        Modifiers
+       --------------------------------------------- */
+
+    /**
+     * @brief Links `value`, whose hook must be unlinked.
+     */
+    void push(Type& value) noexcept {
+        HeapHook* hook = internal::owner_hook<HeapHook, HookOffset>(value);
+        hook->child = nullptr;
+        hook->next = nullptr;
+        hook->prev = nullptr;
+        root_ = (root_ == nullptr) ? hook : meld(root_, hook);
+        ++size_;
+    }
+
+    /**
+     * @brief Unlinks, and returns the top element. Precondition: not empty.
+     */
+    Type& pop() noexcept {
+        HeapHook* old_root = root_;
+        root_ = merge_pairs(old_root->child);
+        old_root->child = nullptr;
+        --size_;
+        return *owner(old_root);
+    }
+
+    /**
+     * @brief Unlinks `value`, which must be linked in this heap.
+     */
+    void erase(Type& value) noexcept {
+        HeapHook* hook = internal::owner_hook<HeapHook, HookOffset>(value);
+        if (hook == root_) {
+            pop();
+            return;
+        }
+        detach(hook);
+        HeapHook* children = merge_pairs(hook->child);
+        hook->child = nullptr;
+        if (children != nullptr) {
+            root_ = meld(root_, children);
+        }
+        --size_;
+    }
+
+    /**
+     * @brief Restores the order after the key of linked `value` decreased.
+     */
+    void decrease(Type& value) noexcept {
+        HeapHook* hook = internal::owner_hook<HeapHook, HookOffset>(value);
+        if (hook != root_) {
+            detach(hook);
+            root_ = meld(root_, hook);
+        }
+    }
+
+    /**
+     * @brief Restores the order after the key of linked `value` changed either way.
+     */
+    void update(Type& value) noexcept {
+        erase(value);
+        push(value);
+    }
+
+    /**
+     * @brief Moves every element of `other` into this heap, in O(1).
+     */
+    void merge(intrusive_heap& other) noexcept {
+        if ((&other == this) || (other.root_ == nullptr)) {
+            return;
+        }
+        root_ = (root_ == nullptr) ? other.root_ : meld(root_, other.root_);
+        size_ += other.size_;
+        other.root_ = nullptr;
+        other.size_ = 0;
+    }
+
+    /**
+     * @brief Unlinks every element, in O(size).
+     */
+    void clear() noexcept {
+        // Depth-first, with the `next` links reused as the stack.
+        HeapHook* stack = root_;
+        if (stack != nullptr) {
+            stack->next = nullptr;
+        }
+        while (stack != nullptr) {
+            HeapHook* hook = stack;
+            stack = hook->next;
+            for (HeapHook* child = hook->child; child != nullptr;) {
+                HeapHook* sibling = child->next;
+                child->next = stack;
+                stack = child;
+                child = sibling;
+            }
+            hook->child = nullptr;
+            hook->next = nullptr;
+            hook->prev = nullptr;
+        }
+        root_ = nullptr;
+        size_ = 0;
+    }
+
+    void swap(intrusive_heap& other) noexcept {
+        using ::std::swap;
+        swap(compare_, other.compare_);
+        swap(root_, other.root_);
+        swap(size_, other.size_);
+    }
+
+private:
+    static Type* owner(HeapHook* hook) noexcept {
+        return internal::hook_owner<Type, HookOffset>(hook);
+    }
+
+    static const Type* owner(const HeapHook* hook) noexcept {
+        return internal::hook_owner<Type, HookOffset>(hook);
+    }
+
+    /// Links two sibling-free roots; the greater becomes the first child of the lesser.
+    HeapHook* meld(HeapHook* a, HeapHook* b) noexcept {
+        if (compare_(*owner(b), *owner(a))) {
+            ::std::swap(a, b);
+        }
+        b->prev = a;
+        b->next = a->child;
+        if (a->child != nullptr) {
+            a->child->prev = b;
+        }
+        a->child = b;
+        return a;
+    }
+
+    /**
+     * @brief Two-pass merge of the sibling list starting at `first`.
+     *
+     * @details
+     * Melds adjacent pairs left to right, then the pairs right to left.
+     * Iterative, so long sibling lists cannot exhaust the stack.
+     */
+    HeapHook* merge_pairs(HeapHook* first) noexcept {
+        if (first == nullptr) {
+            return nullptr;
+        }
+        HeapHook* pairs = nullptr; // Melded pairs, last pair first, through `next`.
+        while (first != nullptr) {
+            HeapHook* a = first;
+            HeapHook* b = a->next;
+            a->prev = nullptr;
+            if (b == nullptr) {
+                a->next = pairs;
+                pairs = a;
+                break;
+            }
+            first = b->next;
+            a->next = nullptr;
+            b->next = nullptr;
+            b->prev = nullptr;
+            HeapHook* melded = meld(a, b);
+            melded->next = pairs;
+            pairs = melded;
+        }
+        HeapHook* root = pairs;
+        pairs = pairs->next;
+        root->next = nullptr;
+        while (pairs != nullptr) {
+            HeapHook* next = pairs->next;
+            pairs->next = nullptr;
+            root = meld(root, pairs);
+            pairs = next;
+        }
+        root->prev = nullptr;
+        return root;
+    }
+
+    /// Unlinks non-root `hook` (with its subtree) from its parent's children.
+    static void detach(HeapHook* hook) noexcept {
+        if (hook->prev->child == hook) {
+            hook->prev->child = hook->next;
+        } else {
+            hook->prev->next = hook->next;
+        }
+        if (hook->next != nullptr) {
+            hook->next->prev = hook->prev;
+        }
+        hook->next = nullptr;
+        hook->prev = nullptr;
+    }
+
+    MYSTIC_NO_UNIQUE_ADDRESS Compare compare_;
+    HeapHook* root_ = nullptr;
+    size_type size_ = 0;
+};
+
+template <typename Type, ::mystic::types::size_t HookOffset, typename Compare>
+inline void swap(intrusive_heap<Type, HookOffset, Compare>& lhs, intrusive_heap<Type, HookOffset, Compare>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mystic
@@ -0,0 +1,148 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/intrusive_hook.hpp
+ * @file intrusive_hook.hpp
+ * @brief Defines the hooks embedded in objects held by intrusive containers.
+ *
+ * @details
+ * An intrusive container stores no nodes of its own: the links live in
+ * a hook member of the user object, and the container finds the object
+ * from its hook by a fixed byte offset (`MYSTIC_OFFSETOF(T, hook)`, or
+ * `offsetof` without `MYSTIC_ALLOW_MACRO_USAGE`). Linking, and
+ * unlinking never allocate, and an object with several hooks can be
+ * in several containers at once.
+ *
+ * Hooks are not copied: copying an object yields unlinked hooks, and
+ * assigning one leaves the target's links as they are.
+ *
+ * This header file provides,
+ * 1. ListHook - Hook for `intrusive_list`.
+ * 2. HashHook - Hook for `intrusive_hash_set`.
+ * 3. HeapHook - Hook for `intrusive_heap`.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/intrusive_hook.hpp"
+ *
+ * struct Timer {
+ *     mystic::types::uint64_t deadline;
+ *     mystic::ListHook pending;   // In a pending list...
+ *     mystic::HeapHook by_time;   // ...and in a deadline heap.
+ * };
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "mystic/types/standard_def.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @brief Doubly-linked list hook; both links are null while unlinked.
+ */
+struct ListHook {
+    ListHook* prev = nullptr;
+    ListHook* next = nullptr;
+
+    ListHook() noexcept = default;
+
+    ListHook(const ListHook&) noexcept {}
+
+    ListHook& operator=(const ListHook&) noexcept {
+        return *this;
+    }
+
+    bool is_linked() const noexcept {
+        return next != nullptr;
+    }
+};
+
+/**
+ * @brief Hash chain hook, with the cached hash of its object.
+ */
+struct HashHook {
+    HashHook* next = nullptr;
+    ::mystic::types::size_t hash = 0;
+
+    HashHook() noexcept = default;
+
+    HashHook(const HashHook&) noexcept {}
+
+    HashHook& operator=(const HashHook&) noexcept {
+        return *this;
+    }
+};
+
+/**
+ * @brief Pairing heap hook.
+ *
+ * @details
+ * `prev` is the previous sibling, or the parent for a first child.
+ */
+struct HeapHook {
+    HeapHook* child = nullptr;
+    HeapHook* next = nullptr;
+    HeapHook* prev = nullptr;
+
+    HeapHook() noexcept = default;
+
+    HeapHook(const HeapHook&) noexcept {}
+
+    HeapHook& operator=(const HeapHook&) noexcept {
+        return *this;
+    }
+};
+
+/**
+ * @namespace mystic::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/**
+ * @brief The object whose hook at byte `Offset` is `hook`.
+ */
+template <typename Type, ::mystic::types::size_t Offset, typename Hook>
+inline Type* hook_owner(Hook* hook) noexcept {
+    return reinterpret_cast<Type*>(reinterpret_cast<char*>(hook) - Offset);
+}
+
+template <typename Type, ::mystic::types::size_t Offset, typename Hook>
+inline const Type* hook_owner(const Hook* hook) noexcept {
+    return reinterpret_cast<const Type*>(reinterpret_cast<const char*>(hook) - Offset);
+}
+
+/**
+ * @brief The hook at byte `Offset` of `value`.
+ */
+template <typename Hook, ::mystic::types::size_t Offset, typename Type>
+inline Hook* owner_hook(Type& value) noexcept {
+    return reinterpret_cast<Hook*>(reinterpret_cast<char*>(&value) + Offset);
+}
+
+} // namespace internal
+} // namespace mystic
@@ -0,0 +1,363 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/intrusive_list.hpp
+ * @file intrusive_list.hpp
+ * @brief Defines a doubly-linked list of objects carrying their own links.
+ *
+ * @details
+ * `intrusive_list<T, Offset>` links objects through the `ListHook` at
+ * byte `Offset` of `T`. The list never allocates, or copies objects;
+ * it does not own them either, so an object must be unlinked (or the
+ * list cleared) before it is destroyed.
+ *
+ * Any linked object is unlinked in O(1) through the list, without
+ * searching for it.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/intrusive_list.hpp"
+ *
+ * struct Request {
+ *     int id;
+ *     mystic::ListHook hook;
+ * };
+ *
+ * mystic::intrusive_list<Request, MYSTIC_OFFSETOF(Request, hook)> pending;
+ *
+ * Request request{7};
+ * pending.push_back(request);
+ * pending.erase(request);     // O(1), no allocation either way
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <iterator>
+#include <type_traits>
+
+#include "mystic/containers/intrusive_hook.hpp"
+#include "mystic/types/standard_def.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @brief Circular doubly-linked list through a `ListHook` member.
+ *
+ * @details
+ * Not copyable; moving transfers the elements.
+ *
+ * @tparam Type Element type (standard layout, for the hook offset).
+ * @tparam HookOffset Byte offset of the `ListHook` in `Type`.
+ */
+template <typename Type, ::mystic::types::size_t HookOffset>
+class intrusive_list {
+public:
+    using value_type      = Type;
+    using size_type       = ::mystic::types::size_t;
+    using reference       = Type&;
+    using const_reference = const Type&;
+
+    /**
+     * @brief Bidirectional iterator over the linked objects.
+     */
+    template <bool Const>
+    class basic_iterator {
+        using hook_pointer = ::std::conditional_t<Const, const ListHook*, ListHook*>;
+
+    public:
+        using iterator_category = ::std::bidirectional_iterator_tag;
+        using value_type        = Type;
+        using difference_type   = ::mystic::types::ptrdiff_t;
+        using reference         = ::std::conditional_t<Const, const Type&, Type&>;
+        using pointer           = ::std::conditional_t<Const, const Type*, Type*>;
+
+        basic_iterator() noexcept = default;
+
+        template <bool OtherConst, typename = ::std::enable_if_t<Const && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst>& other) noexcept
+            : hook_(other.hook_) {}
+
+        reference operator*() const noexcept {
+            return *internal::hook_owner<Type, HookOffset>(hook_);
+        }
+
+        pointer operator->() const noexcept {
+            return internal::hook_owner<Type, HookOffset>(hook_);
+        }
+
+        basic_iterator& operator++() noexcept {
+            hook_ = hook_->next;
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept {
+            basic_iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        basic_iterator& operator--() noexcept {
+            hook_ = hook_->prev;
+            return *this;
+        }
+
+        basic_iterator operator--(int) noexcept {
+            basic_iterator copy = *this;
+            --*this;
+            return copy;
+        }
+
+        friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+            return lhs.hook_ == rhs.hook_;
+        }
+
+        friend bool operator!=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+
+    private:
+        friend class intrusive_list;
+
+        template <bool>
+        friend class basic_iterator;
+
+        explicit basic_iterator(hook_pointer hook) noexcept
+            : hook_(hook) {}
+
+        hook_pointer hook_ = nullptr;
+    };
+
+    using iterator       = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    intrusive_list() noexcept {
+        head_.prev = &head_;
+        head_.next = &head_;
+    }
+
+    intrusive_list(const intrusive_list&) = delete;
+    intrusive_list& operator=(const intrusive_list&) = delete;
+
+    intrusive_list(intrusive_list&& other) noexcept
+        : intrusive_list() {
+        swap(other);
+    }
+
+    intrusive_list& operator=(intrusive_list&& other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Unlinks every element (the objects are not touched otherwise).
+     */
+    ~intrusive_list() {
+        clear();
+    }
+
+    /* =============================================
+        Iterators
+       --------------------------------------------- */
+
+    iterator begin() noexcept {
+        return iterator(head_.next);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(head_.next);
+    }
+
+    iterator end() noexcept {
+        return iterator(&head_);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(&head_);
+    }
+
+    /**
+     * @brief Iterator to `value`, which must be linked in this list.
+     */
+    iterator iterator_to(Type& value) noexcept {
+        return iterator(hook_of(value));
+    }
+
+    /* =============================================
+        Access
+       --------------------------------------------- */
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    /// Precondition: not empty (as for `back`).
+    Type& front() noexcept {
+        return *internal::hook_owner<Type, HookOffset>(head_.next);
+    }
+
+    Type& back() noexcept {
+        return *internal::hook_owner<Type, HookOffset>(head_.prev);
+    }
+
+    /* =============================================
+        Modifiers
+       --------------------------------------------- */
+
+    /**
+     * @brief Links `value` (whose hook must be unlinked) before `position`.
+     */
+    iterator insert(iterator position, Type& value) noexcept {
+        ListHook* hook = hook_of(value);
+        ListHook* next = position.hook_;
+        hook->prev = next->prev;
+        hook->next = next;
+        next->prev->next = hook;
+        next->prev = hook;
+        ++size_;
+        return iterator(hook);
+    }
+
+    void push_front(Type& value) noexcept {
+        insert(begin(), value);
+    }
+
+    void push_back(Type& value) noexcept {
+        insert(end(), value);
+    }
+
+    /**
+     * @brief Unlinks `value`, which must be linked in this list.
+     *
+     * @returns Iterator to the element after it.
+     */
+    iterator erase(Type& value) noexcept {
+        ListHook* hook = hook_of(value);
+        ListHook* next = hook->next;
+        hook->prev->next = next;
+        next->prev = hook->prev;
+        hook->prev = nullptr;
+        hook->next = nullptr;
+        --size_;
+        return iterator(next);
+    }
+
+    iterator erase(iterator position) noexcept {
+        return erase(*position);
+    }
+
+    /// Precondition: not empty (as for `pop_back`).
+    Type& pop_front() noexcept {
+        Type& value = front();
+        erase(value);
+        return value;
+    }
+
+    Type& pop_back() noexcept {
+        Type& value = back();
+        erase(value);
+        return value;
+    }
+
+    /**
+     * @brief Moves every element of `other` before `position`, in O(1).
+     */
+    void splice(iterator position, intrusive_list& other) noexcept {
+        if ((&other == this) || other.empty()) {
+            return;
+        }
+        ListHook* next = position.hook_;
+        ListHook* first = other.head_.next;
+        ListHook* last = other.head_.prev;
+        first->prev = next->prev;
+        last->next = next;
+        next->prev->next = first;
+        next->prev = last;
+        size_ += other.size_;
+        other.head_.prev = &other.head_;
+        other.head_.next = &other.head_;
+        other.size_ = 0;
+    }
+
+    /**
+     * @brief Unlinks every element, in O(size).
+     */
+    void clear() noexcept {
+        ListHook* hook = head_.next;
+        while (hook != &head_) {
+            ListHook* next = hook->next;
+            hook->prev = nullptr;
+            hook->next = nullptr;
+            hook = next;
+        }
+        head_.prev = &head_;
+        head_.next = &head_;
+        size_ = 0;
+    }
+
+    void swap(intrusive_list& other) noexcept {
+        // The sentinels stay put; only the element chains trade places.
+        ListHook* chain = empty() ? nullptr : head_.next;
+        ListHook* chain_last = head_.prev;
+        const size_type count = size_;
+        adopt(other.empty() ? nullptr : other.head_.next, other.head_.prev, other.size_);
+        other.adopt(chain, chain_last, count);
+    }
+
+private:
+    static ListHook* hook_of(Type& value) noexcept {
+        return internal::owner_hook<ListHook, HookOffset>(value);
+    }
+
+    void adopt(ListHook* first, ListHook* last, size_type count) noexcept {
+        if (first == nullptr) {
+            head_.prev = &head_;
+            head_.next = &head_;
+        } else {
+            head_.next = first;
+            head_.prev = last;
+            first->prev = &head_;
+            last->next = &head_;
+        }
+        size_ = count;
+    }
+
+    ListHook head_;
+    size_type size_ = 0;
+};
+
+template <typename Type, ::mystic::types::size_t HookOffset>
+inline void swap(intrusive_list<Type, HookOffset>& lhs, intrusive_list<Type, HookOffset>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mystic
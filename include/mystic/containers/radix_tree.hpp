@@ -0,0 +1,1063 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/radix_tree.hpp
+ * @file radix_tree.hpp
+ * @brief Defines an adaptive radix tree keyed by byte strings.
+ *
+ * @details
+ * `radix_tree<V>` is an adaptive radix tree (ART): one tree level per
+ * key byte, with inner nodes sized to their fan-out (4, 16, 48, or 256
+ * children), and single-child chains compressed into node prefixes.
+ * Lookups cost O(key length), independent of the number of keys, and
+ * keys sharing a prefix share a subtree, so prefix scans, and
+ * longest-prefix matches walk only the matching part of the tree.
+ *
+ * Node16 children are found with one SSE2, or NEON byte compare. A key
+ * that ends inside the tree (a prefix of other keys) is held by the
+ * node where it ends, so no terminator byte is needed, and keys may
+ * contain any byte, including zero.
+ *
+ * Nodes, and leaves are carved from a `memory::Arena`; freed ones go to
+ * per-size free lists, and are reused by later insertions.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/radix_tree.hpp"
+ *
+ * mystic::radix_tree<RouteId> routes;
+ * routes.insert_or_assign("/api/", kApi);
+ * routes.insert_or_assign("/api/users/", kUsers);
+ *
+ * auto match = routes.longest_prefix_match("/api/users/42");  // {"/api/users/", &kUsers}
+ *
+ * routes.for_each_prefix("/api/", [](std::string_view path, RouteId& id) {
+ *     register_route(path, id);
+ * });
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory_resource>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "mystic/architecture/simd_detection.hpp"
+#include "mystic/memory/arena.hpp"
+#include "mystic/memory/upstream.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+#include "mystic/utility/bit.hpp"
+
+#if MYSTIC_ARCH_SIMD_HAS_SSE2
+# include <immintrin.h>
+#elif MYSTIC_ARCH_SIMD_HAS_NEON
+# include <arm_neon.h>
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/**
+ * @brief Index of `byte` among the first `count` of 16 `keys`, or -1.
+ */
+inline int radix_find16(const ::mystic::types::uint8_t* keys, unsigned int count,
+                        ::mystic::types::uint8_t byte) noexcept {
+#if MYSTIC_ARCH_SIMD_HAS_SSE2
+    const __m128i matches = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)),
+                                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys)));
+    const unsigned int bits = static_cast<unsigned int>(_mm_movemask_epi8(matches)) & ((1u << count) - 1);
+    return (bits != 0) ? ::mystic::bit::countr_zero(static_cast<::mystic::types::uint32_t>(bits)) : -1;
+#elif MYSTIC_ARCH_SIMD_HAS_NEON
+    // Narrowing shift packs the byte mask into 4 bits per key.
+    const uint8x16_t matches = vceqq_u8(vdupq_n_u8(byte), vld1q_u8(keys));
+    ::mystic::types::uint64_t bits =
+        vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+    if (count < 16) {
+        bits &= (::mystic::types::uint64_t{1} << (count * 4)) - 1;
+    }
+    return (bits != 0) ? (::mystic::bit::countr_zero(bits) / 4) : -1;
+#else
+    for (unsigned int i = 0; i < count; ++i) {
+        if (keys[i] == byte) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+#endif
+}
+
+} // namespace internal
+
+/**
+ * @brief Adaptive radix tree from byte strings to `Value`.
+ *
+ * @details
+ * Not copyable, or movable (the node arena is not).
+ *
+ * @tparam Value Mapped type.
+ */
+template <typename Value>
+class radix_tree {
+public:
+    using key_type    = ::std::string_view;
+    using mapped_type = Value;
+    using size_type   = ::mystic::types::size_t;
+
+    /**
+     * @brief Constructs an empty tree.
+     *
+     * @param upstream Source of arena chunks, or null for `std::malloc`.
+     */
+    explicit radix_tree(::std::pmr::memory_resource* upstream = nullptr) noexcept
+        : arena_(kArenaChunkSize, upstream) {}
+
+    radix_tree(const radix_tree&) = delete;
+    radix_tree& operator=(const radix_tree&) = delete;
+
+    ~radix_tree() {
+        destroy_values(root_);
+    }
+
+    /* =============================================
+        Capacity
+       --------------------------------------------- */
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    /* =============================================
+        Lookup
+       --------------------------------------------- */
+
+    Value* find(::std::string_view key) noexcept {
+        return const_cast<Value*>(static_cast<const radix_tree*>(this)->find(key));
+    }
+
+    const Value* find(::std::string_view key) const noexcept {
+        Node* ref = root_;
+        size_type depth = 0;
+        while (ref != nullptr) {
+            if (is_leaf(ref)) {
+                return leaf_equals(as_leaf(ref), key) ? &as_leaf(ref)->value : nullptr;
+            }
+            // Optimistic: only the stored prefix bytes are compared; the leaf check settles the rest.
+            const size_type length = ref->prefix_length;
+            if (length != 0) {
+                if ((key.size() - depth) < length) {
+                    return nullptr;
+                }
+                const size_type stored = (length < kMaxPrefix) ? length : kMaxPrefix;
+                if (::std::memcmp(ref->prefix, key.data() + depth, stored) != 0) {
+                    return nullptr;
+                }
+                depth += length;
+            }
+            if (depth == key.size()) {
+                Leaf* terminal = ref->terminal;
+                return ((terminal != nullptr) && leaf_equals(terminal, key)) ? &terminal->value : nullptr;
+            }
+            Node* const* slot = find_child(ref, byte_at(key, depth));
+            if (slot == nullptr) {
+                return nullptr;
+            }
+            ref = *slot;
+            ++depth;
+        }
+        return nullptr;
+    }
+
+    bool contains(::std::string_view key) const noexcept {
+        return find(key) != nullptr;
+    }
+
+    /**
+     * @brief Longest stored key that is a prefix of `query`, and its value.
+     *
+     * @returns `{key, value}`, or `{{}, nullptr}` if no key is a prefix of `query`.
+     */
+    ::std::pair<::std::string_view, Value*> longest_prefix_match(::std::string_view query) noexcept {
+        Leaf* best = nullptr;
+        Node* ref = root_;
+        size_type depth = 0;
+        while (ref != nullptr) {
+            if (is_leaf(ref)) {
+                Leaf* leaf = as_leaf(ref);
+                if ((leaf->length <= query.size()) && (::std::memcmp(leaf->key(), query.data(), leaf->length) == 0)) {
+                    best = leaf;
+                }
+                break;
+            }
+            if (ref->prefix_length != 0) {
+                if (prefix_mismatch(ref, query, depth) != ref->prefix_length) {
+                    break;
+                }
+                depth += ref->prefix_length;
+            }
+            if (ref->terminal != nullptr) {
+                best = ref->terminal;
+            }
+            if (depth == query.size()) {
+                break;
+            }
+            Node* const* slot = find_child(ref, byte_at(query, depth));
+            if (slot == nullptr) {
+                break;
+            }
+            ref = *slot;
+            ++depth;
+        }
+        if (best == nullptr) {
+            return {::std::string_view(), nullptr};
+        }
+        return {::std::string_view(best->key(), best->length), &best->value};
+    }
+
+    /**
+     * @brief Calls `fn(key, value)` for every key, in byte-lexicographic order.
+     *
+     * @details
+     * If `fn` returns `bool`, returning false stops the walk.
+     */
+    template <typename Fn>
+    void for_each(Fn&& fn) {
+        walk(root_, fn);
+    }
+
+    /**
+     * @brief Calls `fn(key, value)` for every key starting with `prefix`, in order.
+     *
+     * @details
+     * If `fn` returns `bool`, returning false stops the scan.
+     */
+    template <typename Fn>
+    void for_each_prefix(::std::string_view prefix, Fn&& fn) {
+        Node* ref = root_;
+        size_type depth = 0;
+        while (ref != nullptr) {
+            if (is_leaf(ref)) {
+                Leaf* leaf = as_leaf(ref);
+                if ((leaf->length >= prefix.size()) && (::std::memcmp(leaf->key(), prefix.data(), prefix.size()) == 0)) {
+                    visit(leaf, fn);
+                }
+                return;
+            }
+            if (ref->prefix_length != 0) {
+                const size_type matched = prefix_mismatch(ref, prefix, depth);
+                if ((depth + matched) == prefix.size()) {
+                    break;
+                }
+                if (matched != ref->prefix_length) {
+                    return;
+                }
+                depth += ref->prefix_length;
+            }
+            if (depth == prefix.size()) {
+                break;
+            }
+            Node* const* slot = find_child(ref, byte_at(prefix, depth));
+            if (slot == nullptr) {
+                return;
+            }
+            ref = *slot;
+            ++depth;
+        }
+        walk(ref, fn);
+    }
+
+    /* =============================================
+        Modifiers
+       --------------------------------------------- */
+
+    /**
+     * @brief Inserts `key` with a value built from `args`, unless it is present.
+     *
+     * @returns The value of `key`, and true if it was inserted.
+     */
+    template <typename... Args>
+    ::std::pair<Value*, bool> try_emplace(::std::string_view key, Args&&... args) {
+        if (Value* existing = find(key)) {
+            return {existing, false};
+        }
+        Leaf* leaf = make_leaf(key, ::std::forward<Args>(args)...);
+#if defined(__cpp_exceptions)
+        try {
+            link(root_, leaf, 0);
+        } catch (...) {
+            destroy_leaf(leaf);
+            throw;
+        }
+#else
+        link(root_, leaf, 0);
+#endif
+        ++size_;
+        return {&leaf->value, true};
+    }
+
+    /**
+     * @brief Inserts, or replaces the value of `key`.
+     *
+     * @returns True if `key` was inserted, false if its value was replaced.
+     */
+    template <typename Arg>
+    bool insert_or_assign(::std::string_view key, Arg&& value) {
+        if (Value* existing = find(key)) {
+            *existing = ::std::forward<Arg>(value);
+            return false;
+        }
+        return try_emplace(key, ::std::forward<Arg>(value)).second;
+    }
+
+    /**
+     * @brief Erases `key`; returns false if it was absent.
+     */
+    bool erase(::std::string_view key) noexcept {
+        if (!unlink(root_, key, 0)) {
+            return false;
+        }
+        --size_;
+        return true;
+    }
+
+    /**
+     * @brief Erases every key; arena chunks are kept for reuse.
+     */
+    void clear() noexcept {
+        destroy_values(root_);
+        root_ = nullptr;
+        size_ = 0;
+        arena_.reset();
+        for (FreeBlock*& head : node_free_) {
+            head = nullptr;
+        }
+        for (FreeBlock*& head : leaf_free_) {
+            head = nullptr;
+        }
+    }
+
+private:
+    /// Prefix bytes stored in a node; longer prefixes are read back from a leaf.
+    static constexpr size_type kMaxPrefix = 8;
+
+    static constexpr size_type kArenaChunkSize = 64 * 1024;
+
+    enum NodeType : ::mystic::types::uint8_t {
+        kNode4,
+        kNode16,
+        kNode48,
+        kNode256,
+    };
+
+    struct Leaf {
+        Value value;
+        size_type length;
+
+        const char* key() const noexcept {
+            return reinterpret_cast<const char*>(this + 1);
+        }
+
+        char* key_data() noexcept {
+            return reinterpret_cast<char*>(this + 1);
+        }
+    };
+
+    static constexpr size_type kAlignment = (alignof(Leaf) > 16) ? alignof(Leaf) : 16;
+
+    /**
+     * @brief Inner node header; child pointers with the low bit set are leaves.
+     */
+    struct Node {
+        NodeType type;
+        ::mystic::types::uint16_t count = 0;
+        ::mystic::types::uint32_t prefix_length = 0;
+        char prefix[kMaxPrefix] = {};
+        Leaf* terminal = nullptr; ///< Key ending exactly after the prefix.
+
+        explicit Node(NodeType node_type) noexcept : type(node_type) {}
+    };
+
+    /// Keys, and children, sorted by key.
+    struct Node4 : Node {
+        ::mystic::types::uint8_t keys[4] = {};
+        Node* children[4] = {};
+
+        static constexpr NodeType kType = kNode4;
+
+        Node4() noexcept : Node(kType) {}
+    };
+
+    struct Node16 : Node {
+        ::mystic::types::uint8_t keys[16] = {};
+        Node* children[16] = {};
+
+        static constexpr NodeType kType = kNode16;
+
+        Node16() noexcept : Node(kType) {}
+    };
+
+    /// `index[byte]` is the child slot plus one, or zero.
+    struct Node48 : Node {
+        ::mystic::types::uint8_t index[256] = {};
+        Node* children[48] = {};
+
+        static constexpr NodeType kType = kNode48;
+
+        Node48() noexcept : Node(kType) {}
+    };
+
+    struct Node256 : Node {
+        Node* children[256] = {};
+
+        static constexpr NodeType kType = kNode256;
+
+        Node256() noexcept : Node(kType) {}
+    };
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    /* ---------------- Tagged Pointers ---------------- */
+
+    static bool is_leaf(const Node* ref) noexcept {
+        return (reinterpret_cast<::mystic::types::uintptr_t>(ref) & 1) != 0;
+    }
+
+    static Leaf* as_leaf(const Node* ref) noexcept {
+        return reinterpret_cast<Leaf*>(reinterpret_cast<::mystic::types::uintptr_t>(ref) & ~::mystic::types::uintptr_t{1});
+    }
+
+    static Node* leaf_ref(Leaf* leaf) noexcept {
+        return reinterpret_cast<Node*>(reinterpret_cast<::mystic::types::uintptr_t>(leaf) | 1);
+    }
+
+    static ::mystic::types::uint8_t byte_at(::std::string_view key, size_type index) noexcept {
+        return static_cast<::mystic::types::uint8_t>(key[index]);
+    }
+
+    static bool leaf_equals(const Leaf* leaf, ::std::string_view key) noexcept {
+        return (leaf->length == key.size()) && (::std::memcmp(leaf->key(), key.data(), key.size()) == 0);
+    }
+
+    /* ---------------- Allocation ---------------- */
+
+    void* take_block(FreeBlock*& head, size_type size) {
+        if (head != nullptr) {
+            FreeBlock* block = head;
+            head = block->next;
+            return block;
+        }
+        void* block = arena_.allocate(size, kAlignment);
+        if (block == nullptr) {
+            ::mystic::memory::internal::throw_bad_alloc();
+        }
+        return block;
+    }
+
+    static void give_block(FreeBlock*& head, void* block) noexcept {
+        head = ::new (block) FreeBlock{head};
+    }
+
+    template <typename NodeT>
+    NodeT* make_node() {
+        return ::new (take_block(node_free_[NodeT::kType], sizeof(NodeT))) NodeT();
+    }
+
+    void free_node(Node* node) noexcept {
+        const NodeType type = node->type;
+        give_block(node_free_[type], node);
+    }
+
+    /// Leaves come in power-of-two size classes.
+    static size_type leaf_class(size_type key_length) noexcept {
+        const size_type size = sizeof(Leaf) + key_length;
+        return (size <= 32) ? 5 : static_cast<size_type>(64 - ::mystic::bit::countl_zero(static_cast<::mystic::types::uint64_t>(size - 1)));
+    }
+
+    template <typename... Args>
+    Leaf* make_leaf(::std::string_view key, Args&&... args) {
+        const size_type size_class = leaf_class(key.size());
+        void* block = take_block(leaf_free_[size_class], size_type{1} << size_class);
+        Leaf* leaf = nullptr;
+#if defined(__cpp_exceptions)
+        try {
+            leaf = ::new (block) Leaf{Value(::std::forward<Args>(args)...), key.size()};
+        } catch (...) {
+            give_block(leaf_free_[size_class], block);
+            throw;
+        }
+#else
+        leaf = ::new (block) Leaf{Value(::std::forward<Args>(args)...), key.size()};
+#endif
+        if (!key.empty()) {
+            ::std::memcpy(leaf->key_data(), key.data(), key.size());
+        }
+        return leaf;
+    }
+
+    void destroy_leaf(Leaf* leaf) noexcept {
+        const size_type size_class = leaf_class(leaf->length);
+        leaf->~Leaf();
+        give_block(leaf_free_[size_class], leaf);
+    }
+
+    /// Destroys the values under `ref` (the arena still owns the memory).
+    void destroy_values(Node* ref) noexcept {
+        if constexpr (!::std::is_trivially_destructible_v<Value>) {
+            if (ref == nullptr) {
+                return;
+            }
+            if (is_leaf(ref)) {
+                as_leaf(ref)->~Leaf();
+                return;
+            }
+            if (ref->terminal != nullptr) {
+                ref->terminal->~Leaf();
+            }
+            for_each_child(ref, [this](::mystic::types::uint8_t, Node* child) {
+                destroy_values(child);
+                return true;
+            });
+        } else {
+            (void)ref;
+        }
+    }
+
+    /* ---------------- Children ---------------- */
+
+    static Node* const* find_child(const Node* node, ::mystic::types::uint8_t byte) noexcept {
+        switch (node->type) {
+            case kNode4: {
+                const Node4* n = static_cast<const Node4*>(node);
+                for (unsigned int i = 0; i < n->count; ++i) {
+                    if (n->keys[i] == byte) {
+                        return &n->children[i];
+                    }
+                }
+                return nullptr;
+            }
+            case kNode16: {
+                const Node16* n = static_cast<const Node16*>(node);
+                const int i = internal::radix_find16(n->keys, n->count, byte);
+                return (i >= 0) ? &n->children[i] : nullptr;
+            }
+            case kNode48: {
+                const Node48* n = static_cast<const Node48*>(node);
+                return (n->index[byte] != 0) ? &n->children[n->index[byte] - 1] : nullptr;
+            }
+            default: {
+                const Node256* n = static_cast<const Node256*>(node);
+                return (n->children[byte] != nullptr) ? &n->children[byte] : nullptr;
+            }
+        }
+    }
+
+    static Node** find_child(Node* node, ::mystic::types::uint8_t byte) noexcept {
+        return const_cast<Node**>(find_child(static_cast<const Node*>(node), byte));
+    }
+
+    /// Calls `fn(byte, child)` in byte order until it returns false.
+    template <typename Fn>
+    static bool for_each_child(const Node* node, Fn&& fn) {
+        switch (node->type) {
+            case kNode4: {
+                const Node4* n = static_cast<const Node4*>(node);
+                for (unsigned int i = 0; i < n->count; ++i) {
+                    if (!fn(n->keys[i], n->children[i])) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            case kNode16: {
+                const Node16* n = static_cast<const Node16*>(node);
+                for (unsigned int i = 0; i < n->count; ++i) {
+                    if (!fn(n->keys[i], n->children[i])) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            case kNode48: {
+                const Node48* n = static_cast<const Node48*>(node);
+                for (unsigned int byte = 0; byte < 256; ++byte) {
+                    if ((n->index[byte] != 0) &&
+                        !fn(static_cast<::mystic::types::uint8_t>(byte), n->children[n->index[byte] - 1])) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            default: {
+                const Node256* n = static_cast<const Node256*>(node);
+                for (unsigned int byte = 0; byte < 256; ++byte) {
+                    if ((n->children[byte] != nullptr) && !fn(static_cast<::mystic::types::uint8_t>(byte), n->children[byte])) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        }
+    }
+
+    /// Copies the header, and children of `from` into the larger `to`.
+    template <typename To>
+    To* grow(Node* from) {
+        To* to = make_node<To>();
+        copy_header(from, to);
+        for_each_child(from, [to](::mystic::types::uint8_t byte, Node* child) {
+            append_child(to, byte, child);
+            return true;
+        });
+        return to;
+    }
+
+    static void copy_header(const Node* from, Node* to) noexcept {
+        to->prefix_length = from->prefix_length;
+        ::std::memcpy(to->prefix, from->prefix, kMaxPrefix);
+        to->terminal = from->terminal;
+    }
+
+    /// Adds a child with a key larger than every existing one (or to a node48, or node256).
+    static void append_child(Node* node, ::mystic::types::uint8_t byte, Node* child) noexcept {
+        switch (node->type) {
+            case kNode4: {
+                Node4* n = static_cast<Node4*>(node);
+                n->keys[n->count] = byte;
+                n->children[n->count] = child;
+                break;
+            }
+            case kNode16: {
+                Node16* n = static_cast<Node16*>(node);
+                n->keys[n->count] = byte;
+                n->children[n->count] = child;
+                break;
+            }
+            case kNode48: {
+                Node48* n = static_cast<Node48*>(node);
+                unsigned int slot = 0;
+                while (n->children[slot] != nullptr) {
+                    ++slot;
+                }
+                n->children[slot] = child;
+                n->index[byte] = static_cast<::mystic::types::uint8_t>(slot + 1);
+                break;
+            }
+            default:
+                static_cast<Node256*>(node)->children[byte] = child;
+                break;
+        }
+        ++node->count;
+    }
+
+    /// Inserts into sorted `keys`, and `children` of a node4, or node16 with room.
+    template <typename NodeT>
+    static void insert_sorted(NodeT* n, ::mystic::types::uint8_t byte, Node* child) noexcept {
+        unsigned int pos = 0;
+        while ((pos < n->count) && (n->keys[pos] < byte)) {
+            ++pos;
+        }
+        ::std::memmove(n->keys + pos + 1, n->keys + pos, n->count - pos);
+        ::std::memmove(n->children + pos + 1, n->children + pos, (n->count - pos) * sizeof(Node*));
+        n->keys[pos] = byte;
+        n->children[pos] = child;
+        ++n->count;
+    }
+
+    /// Adds a child to `*ref`, growing the node (and updating `ref`) when full.
+    void add_child(Node*& ref, ::mystic::types::uint8_t byte, Node* child) {
+        Node* node = ref;
+        switch (node->type) {
+            case kNode4:
+                if (node->count < 4) {
+                    insert_sorted(static_cast<Node4*>(node), byte, child);
+                    return;
+                }
+                ref = grow<Node16>(node);
+                insert_sorted(static_cast<Node16*>(ref), byte, child);
+                break;
+            case kNode16:
+                if (node->count < 16) {
+                    insert_sorted(static_cast<Node16*>(node), byte, child);
+                    return;
+                }
+                ref = grow<Node48>(node);
+                append_child(ref, byte, child);
+                break;
+            case kNode48:
+                if (node->count < 48) {
+                    append_child(node, byte, child);
+                    return;
+                }
+                ref = grow<Node256>(node);
+                append_child(ref, byte, child);
+                break;
+            default:
+                append_child(node, byte, child);
+                return;
+        }
+        free_node(node);
+    }
+
+    /// Removes the child at `byte`, shrinking, or collapsing the node (and updating `ref`).
+    void remove_child(Node*& ref, ::mystic::types::uint8_t byte) noexcept {
+        Node* node = ref;
+        switch (node->type) {
+            case kNode4:
+            case kNode16: {
+                ::mystic::types::uint8_t* keys =
+                    (node->type == kNode4) ? static_cast<Node4*>(node)->keys : static_cast<Node16*>(node)->keys;
+                Node** children = (node->type == kNode4) ? static_cast<Node4*>(node)->children
+                                                         : static_cast<Node16*>(node)->children;
+                unsigned int pos = 0;
+                while (keys[pos] != byte) {
+                    ++pos;
+                }
+                ::std::memmove(keys + pos, keys + pos + 1, node->count - pos - 1);
+                ::std::memmove(children + pos, children + pos + 1, (node->count - pos - 1) * sizeof(Node*));
+                --node->count;
+                break;
+            }
+            case kNode48: {
+                Node48* n = static_cast<Node48*>(node);
+                n->children[n->index[byte] - 1] = nullptr;
+                n->index[byte] = 0;
+                --n->count;
+                break;
+            }
+            default:
+                static_cast<Node256*>(node)->children[byte] = nullptr;
+                --node->count;
+                break;
+        }
+        collapse(ref);
+    }
+
+    /**
+     * @brief Restores the node invariants after a removal.
+     *
+     * @details
+     * Shrinking allocates a smaller node; if that fails the larger node is
+     * kept, which is still a valid tree.
+     */
+    void collapse(Node*& ref) noexcept {
+        Node* node = ref;
+        if (node->count == 0) {
+            // Only a terminal can be left; an empty node never survives.
+            ref = (node->terminal != nullptr) ? leaf_ref(node->terminal) : nullptr;
+            free_node(node);
+            return;
+        }
+        if ((node->count == 1) && (node->terminal == nullptr)) {
+            merge_single_child(ref);
+            return;
+        }
+#if defined(__cpp_exceptions)
+        try {
+            shrink(ref);
+        } catch (...) {
+        }
+#else
+        shrink(ref);
+#endif
+    }
+
+    void shrink(Node*& ref) {
+        Node* node = ref;
+        if ((node->type == kNode16) && (node->count <= 3)) {
+            ref = grow<Node4>(node);
+        } else if ((node->type == kNode48) && (node->count <= 12)) {
+            ref = grow<Node16>(node);
+        } else if ((node->type == kNode256) && (node->count <= 37)) {
+            ref = grow<Node48>(node);
+        } else {
+            return;
+        }
+        free_node(node);
+    }
+
+    /// Replaces a single-child node by its child, joining the prefixes.
+    void merge_single_child(Node*& ref) noexcept {
+        Node* node = ref;
+        ::mystic::types::uint8_t byte = 0;
+        Node* child = nullptr;
+        for_each_child(node, [&](::mystic::types::uint8_t b, Node* c) {
+            byte = b;
+            child = c;
+            return false;
+        });
+        if (!is_leaf(child)) {
+            // New prefix: node prefix, the edge byte, then the child prefix.
+            char joined[kMaxPrefix];
+            size_type filled = (node->prefix_length < kMaxPrefix) ? node->prefix_length : kMaxPrefix;
+            ::std::memcpy(joined, node->prefix, filled);
+            if (filled < kMaxPrefix) {
+                joined[filled++] = static_cast<char>(byte);
+            }
+            const size_type child_stored = (child->prefix_length < kMaxPrefix) ? child->prefix_length : kMaxPrefix;
+            for (size_type i = 0; (i < child_stored) && (filled < kMaxPrefix); ++i) {
+                joined[filled++] = child->prefix[i];
+            }
+            ::std::memcpy(child->prefix, joined, filled);
+            child->prefix_length += node->prefix_length + 1;
+        }
+        ref = child;
+        free_node(node);
+    }
+
+    /* ---------------- Prefixes ---------------- */
+
+    /// Leftmost leaf under `ref` (its key carries every skipped prefix byte).
+    static const Leaf* minimum(const Node* ref) noexcept {
+        while (!is_leaf(ref)) {
+            if (ref->terminal != nullptr) {
+                return ref->terminal;
+            }
+            const Node* next = nullptr;
+            for_each_child(ref, [&](::mystic::types::uint8_t, Node* child) {
+                next = child;
+                return false;
+            });
+            ref = next;
+        }
+        return as_leaf(ref);
+    }
+
+    /**
+     * @brief Number of prefix bytes of `node` that match `key` from `depth`.
+     *
+     * @details
+     * Compares at most the bytes `key` has left; bytes past the stored
+     * prefix are read from the leftmost leaf.
+     */
+    static size_type prefix_mismatch(const Node* node, ::std::string_view key, size_type depth) noexcept {
+        const size_type limit = ::std::min<size_type>(node->prefix_length, key.size() - depth);
+        const size_type stored = ::std::min(limit, kMaxPrefix);
+        size_type i = 0;
+        for (; i < stored; ++i) {
+            if (node->prefix[i] != key[depth + i]) {
+                return i;
+            }
+        }
+        if (i < limit) {
+            const char* leaf_key = minimum(node)->key();
+            for (; i < limit; ++i) {
+                if (leaf_key[depth + i] != key[depth + i]) {
+                    return i;
+                }
+            }
+        }
+        return i;
+    }
+
+    static void set_prefix(Node* node, const char* bytes, size_type length) noexcept {
+        node->prefix_length = static_cast<::mystic::types::uint32_t>(length);
+        ::std::memcpy(node->prefix, bytes, (length < kMaxPrefix) ? length : kMaxPrefix);
+    }
+
+    /* ---------------- Insertion, and Erasure ---------------- */
+
+    /**
+     * @brief Links `leaf` (whose key is absent) under `ref`.
+     *
+     * @details
+     * Every node is allocated before anything is relinked, so a throwing
+     * allocation leaves the tree unchanged.
+     */
+    void link(Node*& ref, Leaf* leaf, size_type depth) {
+        const ::std::string_view key(leaf->key(), leaf->length);
+        Node** slot = &ref;
+        for (;;) {
+            Node* node = *slot;
+            if (node == nullptr) {
+                *slot = leaf_ref(leaf);
+                return;
+            }
+            if (is_leaf(node)) {
+                // Split: a node4 holding the common part, then both leaves.
+                Leaf* other = as_leaf(node);
+                size_type common = 0;
+                const size_type limit = ::std::min(other->length, key.size()) - depth;
+                while ((common < limit) && (other->key()[depth + common] == key[depth + common])) {
+                    ++common;
+                }
+                Node4* split = make_node<Node4>();
+                set_prefix(split, key.data() + depth, common);
+                place(split, other, depth + common);
+                place(split, leaf, depth + common);
+                *slot = split;
+                return;
+            }
+            if (node->prefix_length != 0) {
+                const size_type matched = prefix_mismatch(node, key, depth);
+                if (matched != node->prefix_length) {
+                    split_prefix(*slot, leaf, depth, matched);
+                    return;
+                }
+                depth += node->prefix_length;
+            }
+            if (depth == key.size()) {
+                node->terminal = leaf;
+                return;
+            }
+            Node** child = find_child(node, byte_at(key, depth));
+            if (child == nullptr) {
+                add_child(*slot, byte_at(key, depth), leaf_ref(leaf));
+                return;
+            }
+            slot = child;
+            ++depth;
+        }
+    }
+
+    /// Adds `leaf` to a fresh node4 whose prefix ends at `depth`.
+    static void place(Node4* node, Leaf* leaf, size_type depth) noexcept {
+        if (leaf->length == depth) {
+            node->terminal = leaf;
+        } else {
+            insert_sorted(node, static_cast<::mystic::types::uint8_t>(leaf->key()[depth]), leaf_ref(leaf));
+        }
+    }
+
+    /// Splits the prefix of `ref` after `matched` bytes, and adds `leaf` at the split.
+    void split_prefix(Node*& ref, Leaf* leaf, size_type depth, size_type matched) {
+        Node* node = ref;
+        Node4* split = make_node<Node4>();
+        set_prefix(split, leaf->key() + depth, matched);
+
+        // The node keeps the prefix bytes after the split byte.
+        const size_type old_length = node->prefix_length;
+        ::mystic::types::uint8_t byte;
+        if (old_length <= kMaxPrefix) {
+            byte = static_cast<::mystic::types::uint8_t>(node->prefix[matched]);
+            node->prefix_length = static_cast<::mystic::types::uint32_t>(old_length - matched - 1);
+            ::std::memmove(node->prefix, node->prefix + matched + 1, node->prefix_length);
+        } else {
+            const char* full = minimum(node)->key() + depth;
+            byte = static_cast<::mystic::types::uint8_t>(full[matched]);
+            set_prefix(node, full + matched + 1, old_length - matched - 1);
+        }
+        insert_sorted(split, byte, node);
+        place(split, leaf, depth + matched);
+        ref = split;
+    }
+
+    /// Unlinks, and destroys the leaf of `key` under `ref`.
+    bool unlink(Node*& ref, ::std::string_view key, size_type depth) noexcept {
+        Node* node = ref;
+        if (node == nullptr) {
+            return false;
+        }
+        if (is_leaf(node)) {
+            if (!leaf_equals(as_leaf(node), key)) {
+                return false;
+            }
+            destroy_leaf(as_leaf(node));
+            ref = nullptr;
+            return true;
+        }
+        if (node->prefix_length != 0) {
+            if (prefix_mismatch(node, key, depth) != node->prefix_length) {
+                return false;
+            }
+            depth += node->prefix_length;
+        }
+        if (depth == key.size()) {
+            if (node->terminal == nullptr) {
+                return false;
+            }
+            destroy_leaf(node->terminal);
+            node->terminal = nullptr;
+            if ((node->count == 1) || (node->count == 0)) {
+                collapse(ref);
+            }
+            return true;
+        }
+        const ::mystic::types::uint8_t byte = byte_at(key, depth);
+        Node** child = find_child(node, byte);
+        if (child == nullptr) {
+            return false;
+        }
+        if (is_leaf(*child)) {
+            if (!leaf_equals(as_leaf(*child), key)) {
+                return false;
+            }
+            destroy_leaf(as_leaf(*child));
+            remove_child(ref, byte);
+            return true;
+        }
+        return unlink(*child, key, depth + 1);
+    }
+
+    /* ---------------- Traversal ---------------- */
+
+    template <typename Fn>
+    static bool visit(Leaf* leaf, Fn& fn) {
+        const ::std::string_view key(leaf->key(), leaf->length);
+        if constexpr (::std::is_same_v<::std::invoke_result_t<Fn&, ::std::string_view, Value&>, bool>) {
+            return fn(key, leaf->value);
+        } else {
+            fn(key, leaf->value);
+            return true;
+        }
+    }
+
+    template <typename Fn>
+    static bool walk(Node* ref, Fn& fn) {
+        if (ref == nullptr) {
+            return true;
+        }
+        if (is_leaf(ref)) {
+            return visit(as_leaf(ref), fn);
+        }
+        if ((ref->terminal != nullptr) && !visit(ref->terminal, fn)) {
+            return false;
+        }
+        return for_each_child(ref, [&fn](::mystic::types::uint8_t, Node* child) { return walk(child, fn); });
+    }
+
+    ::mystic::memory::Arena arena_;
+    FreeBlock* node_free_[4] = {};
+    FreeBlock* leaf_free_[64] = {};
+    Node* root_ = nullptr;
+    size_type size_ = 0;
+};
+
+} // namespace mystic
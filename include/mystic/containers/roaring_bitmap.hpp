@@ -0,0 +1,845 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/roaring_bitmap.hpp
+ * @file roaring_bitmap.hpp
+ * @brief Defines a roaring-style compressed bitmap of 32-bit values.
+ *
+ * @details
+ * `roaring_bitmap` splits each value into a 16-bit key, and a 16-bit low
+ * part, and stores the low parts of each key in whichever container is
+ * smallest for their density:
+ * 1. Array, sorted 16-bit values (up to 4096 of them).
+ * 2. Bitmap, 65536 bits (1024 words), above 4096 values.
+ * 3. Run, sorted (start, length - 1) pairs, only after `run_optimize()`.
+ *
+ * Bitmap containers are combined with the SIMD word kernels of
+ * `dynamic_bitset.hpp`; arrays are merged, or galloped when one side
+ * is much shorter. `and_cardinality()` counts an intersection without
+ * building it.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/roaring_bitmap.hpp"
+ *
+ * mystic::roaring_bitmap in_stock = load_in_stock();
+ * mystic::roaring_bitmap on_sale = load_on_sale();
+ *
+ * auto matches = in_stock.and_cardinality(on_sale);
+ * (in_stock & on_sale).for_each([](std::uint32_t id) { show(id); });
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "mystic/containers/dynamic_bitset.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+#include "mystic/utility/bit.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/// Most values an array container holds before it becomes a bitmap.
+constexpr inline ::mystic::types::uint32_t kRoaringArrayMax = 4096;
+
+/// Words of a bitmap container.
+constexpr inline ::mystic::types::size_t kRoaringBitmapWords = 1024;
+
+/**
+ * @brief Index of the first of `data[begin, end)` not less than `target`.
+ *
+ * @details
+ * Doubles the step from `begin` until it overshoots, then binary searches
+ * the last step, so skipping `n` values costs O(log n).
+ */
+inline ::mystic::types::size_t roaring_gallop(const ::mystic::types::uint16_t* data, ::mystic::types::size_t begin,
+                                              ::mystic::types::size_t end, ::mystic::types::uint16_t target) noexcept {
+    ::mystic::types::size_t step = 1;
+    ::mystic::types::size_t low = begin;
+    ::mystic::types::size_t high = begin;
+    while ((high < end) && (data[high] < target)) {
+        low = high + 1;
+        high = begin + step;
+        step <<= 1;
+    }
+    high = ::std::min(high, end);
+    return static_cast<::mystic::types::size_t>(::std::lower_bound(data + low, data + high, target) - data);
+}
+
+/**
+ * @brief Intersects two sorted arrays, writing the result to `out` if `Store`.
+ *
+ * @returns The size of the intersection.
+ */
+template <bool Store>
+inline ::mystic::types::size_t roaring_intersect(const ::mystic::types::uint16_t* a, ::mystic::types::size_t a_size,
+                                                 const ::mystic::types::uint16_t* b, ::mystic::types::size_t b_size,
+                                                 ::mystic::types::uint16_t* out) noexcept {
+    if (a_size > b_size) {
+        ::std::swap(a, b);
+        ::std::swap(a_size, b_size);
+    }
+    ::mystic::types::size_t count = 0;
+    ::mystic::types::size_t j = 0;
+    if ((a_size * 32) < b_size) {
+        for (::mystic::types::size_t i = 0; i < a_size; ++i) {
+            j = roaring_gallop(b, j, b_size, a[i]);
+            if (j == b_size) {
+                break;
+            }
+            if (b[j] == a[i]) {
+                if constexpr (Store) {
+                    out[count] = a[i];
+                }
+                ++count;
+                ++j;
+            }
+        }
+        return count;
+    }
+    ::mystic::types::size_t i = 0;
+    while ((i < a_size) && (j < b_size)) {
+        if (a[i] < b[j]) {
+            ++i;
+        } else if (b[j] < a[i]) {
+            ++j;
+        } else {
+            if constexpr (Store) {
+                out[count] = a[i];
+            }
+            ++count;
+            ++i;
+            ++j;
+        }
+    }
+    return count;
+}
+
+} // namespace internal
+
+/**
+ * @brief Compressed set of 32-bit values.
+ */
+class roaring_bitmap {
+public:
+    using value_type = ::mystic::types::uint32_t;
+    using size_type  = ::mystic::types::size_t;
+
+    roaring_bitmap() noexcept = default;
+
+    roaring_bitmap(::std::initializer_list<value_type> values) {
+        for (const value_type value : values) {
+            add(value);
+        }
+    }
+
+    template <typename InputIt>
+    roaring_bitmap(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            add(static_cast<value_type>(*first));
+        }
+    }
+
+    /* =============================================
+        Capacity
+       --------------------------------------------- */
+
+    /**
+     * @brief Number of values; linear in the number of containers.
+     */
+    size_type cardinality() const noexcept {
+        size_type total = 0;
+        for (const Container& container : containers_) {
+            total += container.cardinality;
+        }
+        return total;
+    }
+
+    bool empty() const noexcept {
+        return containers_.empty();
+    }
+
+    /**
+     * @brief Bytes of container payload (keys, arrays, bitmaps, and runs).
+     */
+    size_type size_in_bytes() const noexcept {
+        size_type bytes = keys_.size() * sizeof(::mystic::types::uint16_t);
+        for (const Container& container : containers_) {
+            bytes += (container.values.size() * sizeof(::mystic::types::uint16_t)) +
+                     (container.words.size() * sizeof(::mystic::types::uint64_t));
+        }
+        return bytes;
+    }
+
+    /* =============================================
+        Lookup
+       --------------------------------------------- */
+
+    bool contains(value_type value) const noexcept {
+        const ::mystic::types::uint16_t key = high_bits(value);
+        const auto it = ::std::lower_bound(keys_.begin(), keys_.end(), key);
+        if ((it == keys_.end()) || (*it != key)) {
+            return false;
+        }
+        return container_contains(containers_[static_cast<size_type>(it - keys_.begin())], low_bits(value));
+    }
+
+    /**
+     * @brief Calls `fn(value)` for every value, in ascending order.
+     */
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        for (size_type i = 0; i < keys_.size(); ++i) {
+            const value_type base = static_cast<value_type>(keys_[i]) << 16;
+            const Container& container = containers_[i];
+            if (container.kind == Kind::Array) {
+                for (const ::mystic::types::uint16_t low : container.values) {
+                    fn(base | low);
+                }
+            } else if (container.kind == Kind::Bitmap) {
+                for (size_type w = 0; w < internal::kRoaringBitmapWords; ++w) {
+                    for (::mystic::types::uint64_t word = container.words[w]; word != 0; word &= word - 1) {
+                        fn(base | static_cast<value_type>((w * 64) + ::mystic::bit::countr_zero(word)));
+                    }
+                }
+            } else {
+                for (size_type r = 0; r < container.values.size(); r += 2) {
+                    const value_type first = container.values[r];
+                    const value_type last = first + container.values[r + 1];
+                    for (value_type low = first; low <= last; ++low) {
+                        fn(base | low);
+                    }
+                }
+            }
+        }
+    }
+
+    /* =============================================
+        Modifiers
+       --------------------------------------------- */
+
+    /**
+     * @brief Adds `value`; returns false if it was already present.
+     */
+    bool add(value_type value) {
+        const ::mystic::types::uint16_t key = high_bits(value);
+        const auto it = ::std::lower_bound(keys_.begin(), keys_.end(), key);
+        const size_type index = static_cast<size_type>(it - keys_.begin());
+        if ((it == keys_.end()) || (*it != key)) {
+            // Filled before insertion, so a failed allocation never leaves an empty container.
+            Container container;
+            container_add(container, low_bits(value));
+            containers_.insert(containers_.begin() + static_cast<::mystic::types::ptrdiff_t>(index),
+                               ::std::move(container));
+#if defined(__cpp_exceptions)
+            try {
+                keys_.insert(it, key);
+            } catch (...) {
+                containers_.erase(containers_.begin() + static_cast<::mystic::types::ptrdiff_t>(index));
+                throw;
+            }
+#else
+            keys_.insert(it, key);
+#endif
+            return true;
+        }
+        return container_add(containers_[index], low_bits(value));
+    }
+
+    /**
+     * @brief Removes `value`; returns false if it was absent.
+     */
+    bool remove(value_type value) {
+        const ::mystic::types::uint16_t key = high_bits(value);
+        const auto it = ::std::lower_bound(keys_.begin(), keys_.end(), key);
+        if ((it == keys_.end()) || (*it != key)) {
+            return false;
+        }
+        const size_type index = static_cast<size_type>(it - keys_.begin());
+        if (!container_remove(containers_[index], low_bits(value))) {
+            return false;
+        }
+        if (containers_[index].cardinality == 0) {
+            containers_.erase(containers_.begin() + static_cast<::mystic::types::ptrdiff_t>(index));
+            keys_.erase(it);
+        }
+        return true;
+    }
+
+    void clear() noexcept {
+        keys_.clear();
+        containers_.clear();
+    }
+
+    /**
+     * @brief Converts each container to runs where that is smaller, and back where it no longer is.
+     *
+     * @details
+     * Adding to, or removing from, a run container expands it first, and
+     * unions never produce runs, so call this again after bulk updates.
+     */
+    void run_optimize() {
+        for (Container& container : containers_) {
+            const size_type runs = count_runs(container);
+            const size_type run_bytes = runs * 4;
+            const size_type plain_bytes = (container.cardinality <= internal::kRoaringArrayMax)
+                                              ? (container.cardinality * 2)
+                                              : (internal::kRoaringBitmapWords * 8);
+            if ((container.kind != Kind::Run) && (run_bytes < plain_bytes)) {
+                to_runs(container);
+            } else if ((container.kind == Kind::Run) && (run_bytes >= plain_bytes)) {
+                expand_runs(container);
+            }
+        }
+    }
+
+    /* =============================================
+        Set Operations
+       --------------------------------------------- */
+
+    /**
+     * @brief Size of the intersection with `other`, without building it.
+     */
+    size_type and_cardinality(const roaring_bitmap& other) const noexcept {
+        size_type total = 0;
+        size_type i = 0;
+        size_type j = 0;
+        while ((i < keys_.size()) && (j < other.keys_.size())) {
+            if (keys_[i] < other.keys_[j]) {
+                ++i;
+            } else if (other.keys_[j] < keys_[i]) {
+                ++j;
+            } else {
+                total += intersect_count(containers_[i], other.containers_[j]);
+                ++i;
+                ++j;
+            }
+        }
+        return total;
+    }
+
+    friend roaring_bitmap operator&(const roaring_bitmap& lhs, const roaring_bitmap& rhs) {
+        roaring_bitmap result;
+        size_type i = 0;
+        size_type j = 0;
+        while ((i < lhs.keys_.size()) && (j < rhs.keys_.size())) {
+            if (lhs.keys_[i] < rhs.keys_[j]) {
+                ++i;
+            } else if (rhs.keys_[j] < lhs.keys_[i]) {
+                ++j;
+            } else {
+                Container container = intersect(lhs.containers_[i], rhs.containers_[j]);
+                if (container.cardinality != 0) {
+                    result.keys_.push_back(lhs.keys_[i]);
+                    result.containers_.push_back(::std::move(container));
+                }
+                ++i;
+                ++j;
+            }
+        }
+        return result;
+    }
+
+    friend roaring_bitmap operator|(const roaring_bitmap& lhs, const roaring_bitmap& rhs) {
+        roaring_bitmap result;
+        size_type i = 0;
+        size_type j = 0;
+        while ((i < lhs.keys_.size()) || (j < rhs.keys_.size())) {
+            if ((j == rhs.keys_.size()) || ((i < lhs.keys_.size()) && (lhs.keys_[i] < rhs.keys_[j]))) {
+                result.keys_.push_back(lhs.keys_[i]);
+                result.containers_.push_back(lhs.containers_[i++]);
+            } else if ((i == lhs.keys_.size()) || (rhs.keys_[j] < lhs.keys_[i])) {
+                result.keys_.push_back(rhs.keys_[j]);
+                result.containers_.push_back(rhs.containers_[j++]);
+            } else {
+                result.keys_.push_back(lhs.keys_[i]);
+                result.containers_.push_back(unite(lhs.containers_[i++], rhs.containers_[j++]));
+            }
+        }
+        return result;
+    }
+
+    roaring_bitmap& operator&=(const roaring_bitmap& other) {
+        roaring_bitmap result = *this & other;
+        swap(result);
+        return *this;
+    }
+
+    roaring_bitmap& operator|=(const roaring_bitmap& other) {
+        roaring_bitmap result = *this | other;
+        swap(result);
+        return *this;
+    }
+
+    /**
+     * @brief Compares contents; equal sets compare equal whatever their containers.
+     */
+    friend bool operator==(const roaring_bitmap& lhs, const roaring_bitmap& rhs) noexcept {
+        if (lhs.keys_ != rhs.keys_) {
+            return false;
+        }
+        for (size_type i = 0; i < lhs.containers_.size(); ++i) {
+            const Container& a = lhs.containers_[i];
+            const Container& b = rhs.containers_[i];
+            if ((a.cardinality != b.cardinality) || (intersect_count(a, b) != a.cardinality)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    friend bool operator!=(const roaring_bitmap& lhs, const roaring_bitmap& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+    void swap(roaring_bitmap& other) noexcept {
+        keys_.swap(other.keys_);
+        containers_.swap(other.containers_);
+    }
+
+private:
+    using word_type = ::mystic::types::uint64_t;
+    using low_type  = ::mystic::types::uint16_t;
+
+    /// Ordered by density, so binary operations can order their operands.
+    enum class Kind : ::mystic::types::uint8_t {
+        Array,
+        Bitmap,
+        Run,
+    };
+
+    /**
+     * @brief Low parts of one key.
+     *
+     * @details
+     * `values` holds the sorted values of an array container, or the
+     * (start, length - 1) pairs of a run container; `words` holds the
+     * bits of a bitmap container.
+     */
+    struct Container {
+        Kind kind = Kind::Array;
+        ::mystic::types::uint32_t cardinality = 0;
+        ::std::vector<low_type> values;
+        ::std::vector<word_type> words;
+    };
+
+    static low_type high_bits(value_type value) noexcept {
+        return static_cast<low_type>(value >> 16);
+    }
+
+    static low_type low_bits(value_type value) noexcept {
+        return static_cast<low_type>(value);
+    }
+
+    /* ---------------- Word Ranges ---------------- */
+
+    /// Mask of bits `[first, last]` of word `index`.
+    static word_type range_mask(size_type index, ::mystic::types::uint32_t first,
+                                ::mystic::types::uint32_t last) noexcept {
+        word_type mask = ~word_type{0};
+        if (index == (first / 64)) {
+            mask &= ~word_type{0} << (first % 64);
+        }
+        if (index == (last / 64)) {
+            mask &= ~word_type{0} >> (63 - (last % 64));
+        }
+        return mask;
+    }
+
+    static void set_range(word_type* words, ::mystic::types::uint32_t first, ::mystic::types::uint32_t last) noexcept {
+        for (size_type w = first / 64; w <= (last / 64); ++w) {
+            words[w] |= range_mask(w, first, last);
+        }
+    }
+
+    static size_type count_range(const word_type* words, ::mystic::types::uint32_t first,
+                                 ::mystic::types::uint32_t last) noexcept {
+        size_type total = 0;
+        for (size_type w = first / 64; w <= (last / 64); ++w) {
+            total += static_cast<size_type>(::mystic::bit::popcount(words[w] & range_mask(w, first, last)));
+        }
+        return total;
+    }
+
+    /// First position at, or after `pos` whose bit equals `bit`, or 65536.
+    static ::mystic::types::uint32_t next_bit(const word_type* words, ::mystic::types::uint32_t pos, bool bit) noexcept {
+        const word_type flip = bit ? word_type{0} : ~word_type{0};
+        size_type w = pos / 64;
+        word_type word = (words[w] ^ flip) & (~word_type{0} << (pos % 64));
+        while (word == 0) {
+            if (++w == internal::kRoaringBitmapWords) {
+                return 65536;
+            }
+            word = words[w] ^ flip;
+        }
+        return static_cast<::mystic::types::uint32_t>((w * 64) + ::mystic::bit::countr_zero(word));
+    }
+
+    /* ---------------- Containers ---------------- */
+
+    static bool container_contains(const Container& container, low_type low) noexcept {
+        if (container.kind == Kind::Array) {
+            return ::std::binary_search(container.values.begin(), container.values.end(), low);
+        }
+        if (container.kind == Kind::Bitmap) {
+            return ((container.words[low / 64] >> (low % 64)) & 1) != 0;
+        }
+        // Last run starting at, or before `low`.
+        size_type lo = 0;
+        size_type hi = container.values.size() / 2;
+        while (lo < hi) {
+            const size_type mid = (lo + hi) / 2;
+            if (container.values[mid * 2] <= low) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return (lo != 0) && ((low - container.values[(lo - 1) * 2]) <= container.values[((lo - 1) * 2) + 1]);
+    }
+
+    static bool container_add(Container& container, low_type low) {
+        if (container.kind == Kind::Run) {
+            expand_runs(container);
+        }
+        if (container.kind == Kind::Array) {
+            const auto it = ::std::lower_bound(container.values.begin(), container.values.end(), low);
+            if ((it != container.values.end()) && (*it == low)) {
+                return false;
+            }
+            if (container.cardinality < internal::kRoaringArrayMax) {
+                container.values.insert(it, low);
+                ++container.cardinality;
+                return true;
+            }
+            to_bitmap(container);
+        }
+        word_type& word = container.words[low / 64];
+        const word_type mask = word_type{1} << (low % 64);
+        if ((word & mask) != 0) {
+            return false;
+        }
+        word |= mask;
+        ++container.cardinality;
+        return true;
+    }
+
+    static bool container_remove(Container& container, low_type low) {
+        if (!container_contains(container, low)) {
+            return false;
+        }
+        if (container.kind == Kind::Run) {
+            expand_runs(container);
+        }
+        if (container.kind == Kind::Array) {
+            container.values.erase(::std::lower_bound(container.values.begin(), container.values.end(), low));
+            --container.cardinality;
+            return true;
+        }
+        container.words[low / 64] &= ~(word_type{1} << (low % 64));
+        if (--container.cardinality <= internal::kRoaringArrayMax) {
+            to_array(container);
+        }
+        return true;
+    }
+
+    /// Array, or run container to bitmap.
+    static void to_bitmap(Container& container) {
+        ::std::vector<word_type> words(internal::kRoaringBitmapWords, 0);
+        materialize(container, words.data());
+        container.words.swap(words);
+        ::std::vector<low_type>().swap(container.values);
+        container.kind = Kind::Bitmap;
+    }
+
+    /// Bitmap container of at most `kRoaringArrayMax` values to array.
+    static void to_array(Container& container) {
+        ::std::vector<low_type> values;
+        values.reserve(container.cardinality);
+        for (size_type w = 0; w < internal::kRoaringBitmapWords; ++w) {
+            for (word_type word = container.words[w]; word != 0; word &= word - 1) {
+                values.push_back(static_cast<low_type>((w * 64) + ::mystic::bit::countr_zero(word)));
+            }
+        }
+        container.values.swap(values);
+        ::std::vector<word_type>().swap(container.words);
+        container.kind = Kind::Array;
+    }
+
+    /// Run container to whichever of array, or bitmap fits its cardinality.
+    static void expand_runs(Container& container) {
+        if (container.cardinality > internal::kRoaringArrayMax) {
+            to_bitmap(container);
+            return;
+        }
+        ::std::vector<low_type> values;
+        values.reserve(container.cardinality);
+        for (size_type r = 0; r < container.values.size(); r += 2) {
+            const ::mystic::types::uint32_t first = container.values[r];
+            const ::mystic::types::uint32_t last = first + container.values[r + 1];
+            for (::mystic::types::uint32_t low = first; low <= last; ++low) {
+                values.push_back(static_cast<low_type>(low));
+            }
+        }
+        container.values.swap(values);
+        container.kind = Kind::Array;
+    }
+
+    static size_type count_runs(const Container& container) noexcept {
+        if (container.kind == Kind::Run) {
+            return container.values.size() / 2;
+        }
+        if (container.kind == Kind::Array) {
+            size_type runs = container.values.empty() ? 0 : 1;
+            for (size_type i = 1; i < container.values.size(); ++i) {
+                runs += (container.values[i] != (container.values[i - 1] + 1)) ? 1 : 0;
+            }
+            return runs;
+        }
+        // A run starts at every set bit whose lower neighbour is clear.
+        size_type runs = 0;
+        word_type carry = 0;
+        for (size_type w = 0; w < internal::kRoaringBitmapWords; ++w) {
+            const word_type word = container.words[w];
+            runs += static_cast<size_type>(::mystic::bit::popcount(word & ~((word << 1) | carry)));
+            carry = word >> 63;
+        }
+        return runs;
+    }
+
+    static void to_runs(Container& container) {
+        ::std::vector<low_type> runs;
+        if (container.kind == Kind::Array) {
+            for (size_type i = 0; i < container.values.size();) {
+                size_type end = i + 1;
+                while ((end < container.values.size()) && (container.values[end] == (container.values[end - 1] + 1))) {
+                    ++end;
+                }
+                runs.push_back(container.values[i]);
+                runs.push_back(static_cast<low_type>(end - i - 1));
+                i = end;
+            }
+        } else {
+            ::mystic::types::uint32_t pos = next_bit(container.words.data(), 0, true);
+            while (pos < 65536) {
+                const ::mystic::types::uint32_t end =
+                    (pos == 65535) ? 65536 : next_bit(container.words.data(), pos + 1, false);
+                runs.push_back(static_cast<low_type>(pos));
+                runs.push_back(static_cast<low_type>(end - pos - 1));
+                pos = (end >= 65535) ? 65536 : next_bit(container.words.data(), end, true);
+            }
+            ::std::vector<word_type>().swap(container.words);
+        }
+        container.values.swap(runs);
+        container.kind = Kind::Run;
+    }
+
+    /// Sets the bits of `container` in `words` (`kRoaringBitmapWords` of them).
+    static void materialize(const Container& container, word_type* words) noexcept {
+        if (container.kind == Kind::Array) {
+            for (const low_type low : container.values) {
+                words[low / 64] |= word_type{1} << (low % 64);
+            }
+        } else if (container.kind == Kind::Bitmap) {
+            internal::bitset_apply<internal::BitsetOp::Or>(words, container.words.data(),
+                                                           internal::kRoaringBitmapWords);
+        } else {
+            for (size_type r = 0; r < container.values.size(); r += 2) {
+                set_range(words, container.values[r],
+                          static_cast<::mystic::types::uint32_t>(container.values[r]) + container.values[r + 1]);
+            }
+        }
+    }
+
+    /// Converts a bitmap container to an array if that is smaller.
+    static void shrink(Container& container) {
+        if ((container.kind == Kind::Bitmap) && (container.cardinality <= internal::kRoaringArrayMax)) {
+            to_array(container);
+        }
+    }
+
+    /* ---------------- Binary Operations ---------------- */
+
+    static Container intersect(const Container& lhs, const Container& rhs) {
+        const Container& a = (lhs.kind <= rhs.kind) ? lhs : rhs;
+        const Container& b = (lhs.kind <= rhs.kind) ? rhs : lhs;
+        Container result;
+        if (a.kind == Kind::Array) {
+            if (b.kind == Kind::Array) {
+                result.values.resize(::std::min(a.values.size(), b.values.size()));
+                result.values.resize(internal::roaring_intersect<true>(a.values.data(), a.values.size(),
+                                                                       b.values.data(), b.values.size(),
+                                                                       result.values.data()));
+            } else {
+                for (const low_type low : a.values) {
+                    if (container_contains(b, low)) {
+                        result.values.push_back(low);
+                    }
+                }
+            }
+            result.cardinality = static_cast<::mystic::types::uint32_t>(result.values.size());
+        } else if (b.kind == Kind::Bitmap) {
+            const size_type count =
+                internal::bitset_count<true>(a.words.data(), b.words.data(), internal::kRoaringBitmapWords);
+            result.cardinality = static_cast<::mystic::types::uint32_t>(count);
+            if (count <= internal::kRoaringArrayMax) {
+                result.values.reserve(count);
+                for (size_type w = 0; w < internal::kRoaringBitmapWords; ++w) {
+                    for (word_type word = a.words[w] & b.words[w]; word != 0; word &= word - 1) {
+                        result.values.push_back(static_cast<low_type>((w * 64) + ::mystic::bit::countr_zero(word)));
+                    }
+                }
+            } else {
+                result.kind = Kind::Bitmap;
+                result.words = a.words;
+                internal::bitset_apply<internal::BitsetOp::And>(result.words.data(), b.words.data(),
+                                                                internal::kRoaringBitmapWords);
+            }
+        } else if (a.kind == Kind::Bitmap) {
+            result.kind = Kind::Bitmap;
+            result.words.assign(internal::kRoaringBitmapWords, 0);
+            for (size_type r = 0; r < b.values.size(); r += 2) {
+                const ::mystic::types::uint32_t first = b.values[r];
+                const ::mystic::types::uint32_t last = first + b.values[r + 1];
+                for (size_type w = first / 64; w <= (last / 64); ++w) {
+                    result.words[w] |= a.words[w] & range_mask(w, first, last);
+                }
+            }
+            result.cardinality = static_cast<::mystic::types::uint32_t>(
+                internal::bitset_count<false>(result.words.data(), nullptr, internal::kRoaringBitmapWords));
+            shrink(result);
+        } else {
+            result.kind = Kind::Run;
+            size_type i = 0;
+            size_type j = 0;
+            while ((i < a.values.size()) && (j < b.values.size())) {
+                const ::mystic::types::uint32_t a_last = static_cast<::mystic::types::uint32_t>(a.values[i]) + a.values[i + 1];
+                const ::mystic::types::uint32_t b_last = static_cast<::mystic::types::uint32_t>(b.values[j]) + b.values[j + 1];
+                const ::mystic::types::uint32_t first = ::std::max(a.values[i], b.values[j]);
+                const ::mystic::types::uint32_t last = ::std::min(a_last, b_last);
+                if (first <= last) {
+                    result.values.push_back(static_cast<low_type>(first));
+                    result.values.push_back(static_cast<low_type>(last - first));
+                    result.cardinality += last - first + 1;
+                }
+                if (a_last < b_last) {
+                    i += 2;
+                } else {
+                    j += 2;
+                }
+            }
+        }
+        return result;
+    }
+
+    static size_type intersect_count(const Container& lhs, const Container& rhs) noexcept {
+        const Container& a = (lhs.kind <= rhs.kind) ? lhs : rhs;
+        const Container& b = (lhs.kind <= rhs.kind) ? rhs : lhs;
+        if (a.kind == Kind::Array) {
+            if (b.kind == Kind::Array) {
+                return internal::roaring_intersect<false>(a.values.data(), a.values.size(), b.values.data(),
+                                                          b.values.size(), nullptr);
+            }
+            size_type count = 0;
+            for (const low_type low : a.values) {
+                count += container_contains(b, low) ? 1 : 0;
+            }
+            return count;
+        }
+        if (b.kind == Kind::Bitmap) {
+            return internal::bitset_count<true>(a.words.data(), b.words.data(), internal::kRoaringBitmapWords);
+        }
+        size_type count = 0;
+        if (a.kind == Kind::Bitmap) {
+            for (size_type r = 0; r < b.values.size(); r += 2) {
+                count += count_range(a.words.data(), b.values[r],
+                                     static_cast<::mystic::types::uint32_t>(b.values[r]) + b.values[r + 1]);
+            }
+            return count;
+        }
+        size_type i = 0;
+        size_type j = 0;
+        while ((i < a.values.size()) && (j < b.values.size())) {
+            const ::mystic::types::uint32_t a_last = static_cast<::mystic::types::uint32_t>(a.values[i]) + a.values[i + 1];
+            const ::mystic::types::uint32_t b_last = static_cast<::mystic::types::uint32_t>(b.values[j]) + b.values[j + 1];
+            const ::mystic::types::uint32_t first = ::std::max(a.values[i], b.values[j]);
+            const ::mystic::types::uint32_t last = ::std::min(a_last, b_last);
+            if (first <= last) {
+                count += last - first + 1;
+            }
+            if (a_last < b_last) {
+                i += 2;
+            } else {
+                j += 2;
+            }
+        }
+        return count;
+    }
+
+    static Container unite(const Container& a, const Container& b) {
+        Container result;
+        if ((a.kind == Kind::Array) && (b.kind == Kind::Array) &&
+            ((a.cardinality + b.cardinality) <= internal::kRoaringArrayMax)) {
+            result.values.resize(a.values.size() + b.values.size());
+            result.values.erase(::std::set_union(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(),
+                                                 result.values.begin()),
+                                result.values.end());
+            result.cardinality = static_cast<::mystic::types::uint32_t>(result.values.size());
+            return result;
+        }
+        result.kind = Kind::Bitmap;
+        if (a.kind == Kind::Bitmap) {
+            result.words = a.words;
+        } else {
+            result.words.assign(internal::kRoaringBitmapWords, 0);
+            materialize(a, result.words.data());
+        }
+        materialize(b, result.words.data());
+        result.cardinality = static_cast<::mystic::types::uint32_t>(
+            internal::bitset_count<false>(result.words.data(), nullptr, internal::kRoaringBitmapWords));
+        shrink(result);
+        return result;
+    }
+
+    ::std::vector<low_type> keys_;
+    ::std::vector<Container> containers_;
+};
+
+inline void swap(roaring_bitmap& lhs, roaring_bitmap& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mystic
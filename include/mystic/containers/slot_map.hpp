@@ -0,0 +1,320 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/slot_map.hpp
+ * @file slot_map.hpp
+ * @brief Defines a slot map with generational handles.
+ *
+ * @details
+ * `slot_map<T>` stores its values densely in one array, and hands out
+ * 64-bit handles (a 32-bit slot index, and a 32-bit generation) that stay
+ * valid however the array is reordered. Lookup is two array reads;
+ * erasure moves the last value into the hole, so iteration always walks
+ * a packed array.
+ *
+ * A slot's generation is odd while it holds a value, and is bumped on
+ * insertion, and on erasure, so a handle to an erased value, or to a value
+ * that later reused its slot, is detected, and reported as `NOT_FOUND`.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/slot_map.hpp"
+ *
+ * mystic::slot_map<Session> sessions;
+ * mystic::SlotHandle handle = sessions.emplace(peer);
+ *
+ * if (Session* session = sessions.get(handle)) {
+ *     session->touch();
+ * }
+ * sessions.erase(handle);  // StatusCode::OK
+ * sessions.erase(handle);  // StatusCode::NOT_FOUND
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "mystic/memory/upstream.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @brief Handle to a slot_map value: slot index, and generation.
+ */
+struct SlotHandle {
+    ::mystic::types::uint32_t index = 0xFFFFFFFFu;
+    ::mystic::types::uint32_t generation = 0;
+
+    /**
+     * @brief Packs the handle into 64 bits (generation high, index low).
+     */
+    constexpr ::mystic::types::uint64_t to_bits() const noexcept {
+        return (static_cast<::mystic::types::uint64_t>(generation) << 32) | index;
+    }
+
+    static constexpr SlotHandle from_bits(::mystic::types::uint64_t bits) noexcept {
+        return SlotHandle{static_cast<::mystic::types::uint32_t>(bits),
+                          static_cast<::mystic::types::uint32_t>(bits >> 32)};
+    }
+
+    /**
+     * @brief False for default constructed handles (which no map accepts).
+     */
+    constexpr explicit operator bool() const noexcept {
+        return (generation & 1) != 0;
+    }
+
+    friend constexpr bool operator==(SlotHandle lhs, SlotHandle rhs) noexcept {
+        return (lhs.index == rhs.index) && (lhs.generation == rhs.generation);
+    }
+
+    friend constexpr bool operator!=(SlotHandle lhs, SlotHandle rhs) noexcept {
+        return !(lhs == rhs);
+    }
+};
+
+/**
+ * @brief Dense value storage addressed by generational handles.
+ *
+ * @tparam Type Value type (move assignable, for swap-remove).
+ */
+template <typename Type>
+class slot_map {
+public:
+    using value_type      = Type;
+    using size_type       = ::mystic::types::size_t;
+    using reference       = Type&;
+    using const_reference = const Type&;
+    using iterator        = typename ::std::vector<Type>::iterator;
+    using const_iterator  = typename ::std::vector<Type>::const_iterator;
+
+    slot_map() noexcept = default;
+
+    /* =============================================
+        Dense Access
+       --------------------------------------------- */
+
+    iterator begin() noexcept {
+        return values_.begin();
+    }
+
+    const_iterator begin() const noexcept {
+        return values_.begin();
+    }
+
+    iterator end() noexcept {
+        return values_.end();
+    }
+
+    const_iterator end() const noexcept {
+        return values_.end();
+    }
+
+    Type* data() noexcept {
+        return values_.data();
+    }
+
+    const Type* data() const noexcept {
+        return values_.data();
+    }
+
+    /**
+     * @brief Handle of the value at dense position `position`.
+     */
+    SlotHandle handle_at(size_type position) const noexcept {
+        const ::mystic::types::uint32_t index = dense_to_slot_[position];
+        return SlotHandle{index, slots_[index].generation};
+    }
+
+    size_type size() const noexcept {
+        return values_.size();
+    }
+
+    bool empty() const noexcept {
+        return values_.empty();
+    }
+
+    /**
+     * @brief Reserves values, and slots for `count` elements.
+     */
+    void reserve(size_type count) {
+        values_.reserve(count);
+        dense_to_slot_.reserve(count);
+        slots_.reserve(count);
+    }
+
+    /* =============================================
+        Handle Access
+       --------------------------------------------- */
+
+    /**
+     * @brief Returns the value of `handle`, or null if it was erased.
+     */
+    Type* get(SlotHandle handle) noexcept {
+        return contains(handle) ? values_.data() + slots_[handle.index].position : nullptr;
+    }
+
+    const Type* get(SlotHandle handle) const noexcept {
+        return contains(handle) ? values_.data() + slots_[handle.index].position : nullptr;
+    }
+
+    /**
+     * @brief Copies the value of `handle` into `out`.
+     *
+     * @returns `OK`, or `NOT_FOUND` for a stale handle (`out` untouched).
+     */
+    ::mystic::status::StatusCode get(SlotHandle handle, Type& out) const {
+        if (!contains(handle)) {
+            return ::mystic::status::StatusCode::NOT_FOUND;
+        }
+        out = values_[slots_[handle.index].position];
+        return ::mystic::status::StatusCode::OK;
+    }
+
+    bool contains(SlotHandle handle) const noexcept {
+        return (handle.index < slots_.size()) && (slots_[handle.index].generation == handle.generation) &&
+               ((handle.generation & 1) != 0);
+    }
+
+    /* =============================================
+        Modifiers
+       --------------------------------------------- */
+
+    SlotHandle insert(const Type& value) {
+        return emplace(value);
+    }
+
+    SlotHandle insert(Type&& value) {
+        return emplace(::std::move(value));
+    }
+
+    /**
+     * @brief Constructs a value at the end of the dense array.
+     *
+     * @returns Its handle (stable until the value is erased).
+     */
+    template <typename... Args>
+    SlotHandle emplace(Args&&... args) {
+        if (free_head_ == kNoSlot) {
+            if (slots_.size() >= kMaxSlots) {
+                ::mystic::memory::internal::throw_bad_alloc();
+            }
+            slots_.push_back(Slot{kNoSlot, 0});
+            free_head_ = static_cast<::mystic::types::uint32_t>(slots_.size() - 1);
+        }
+        // Room for the index first, so nothing throws after the value exists.
+        if (dense_to_slot_.size() == dense_to_slot_.capacity()) {
+            dense_to_slot_.reserve(dense_to_slot_.size() * 2 + 8);
+        }
+        values_.emplace_back(::std::forward<Args>(args)...);
+
+        const ::mystic::types::uint32_t index = free_head_;
+        Slot& slot = slots_[index];
+        free_head_ = slot.position;
+        slot.position = static_cast<::mystic::types::uint32_t>(values_.size() - 1);
+        ++slot.generation;
+        dense_to_slot_.push_back(index);
+        return SlotHandle{index, slot.generation};
+    }
+
+    /**
+     * @brief Erases the value of `handle`, moving the last value into its place.
+     *
+     * @returns `OK`, or `NOT_FOUND` for a stale handle.
+     */
+    ::mystic::status::StatusCode erase(SlotHandle handle) {
+        if (!contains(handle)) {
+            return ::mystic::status::StatusCode::NOT_FOUND;
+        }
+        Slot& slot = slots_[handle.index];
+        const ::mystic::types::uint32_t position = slot.position;
+        const ::mystic::types::uint32_t last = static_cast<::mystic::types::uint32_t>(values_.size() - 1);
+        if (position != last) {
+            values_[position] = ::std::move(values_[last]);
+            dense_to_slot_[position] = dense_to_slot_[last];
+            slots_[dense_to_slot_[position]].position = position;
+        }
+        values_.pop_back();
+        dense_to_slot_.pop_back();
+
+        ++slot.generation;
+        slot.position = free_head_;
+        free_head_ = handle.index;
+        return ::mystic::status::StatusCode::OK;
+    }
+
+    /**
+     * @brief Erases every value; all outstanding handles become stale.
+     */
+    void clear() noexcept {
+        for (const ::mystic::types::uint32_t index : dense_to_slot_) {
+            Slot& slot = slots_[index];
+            ++slot.generation;
+            slot.position = free_head_;
+            free_head_ = index;
+        }
+        values_.clear();
+        dense_to_slot_.clear();
+    }
+
+    void swap(slot_map& other) noexcept {
+        values_.swap(other.values_);
+        dense_to_slot_.swap(other.dense_to_slot_);
+        slots_.swap(other.slots_);
+        ::std::swap(free_head_, other.free_head_);
+    }
+
+private:
+    static constexpr ::mystic::types::uint32_t kNoSlot = 0xFFFFFFFFu;
+    static constexpr size_type kMaxSlots = kNoSlot;
+
+    /**
+     * @brief Dense position while live, next free slot while free.
+     *
+     * @details
+     * The generation is odd while live; it wraps after 2^31 reuses of the slot.
+     */
+    struct Slot {
+        ::mystic::types::uint32_t position;
+        ::mystic::types::uint32_t generation;
+    };
+
+    ::std::vector<Type> values_;
+    ::std::vector<::mystic::types::uint32_t> dense_to_slot_;
+    ::std::vector<Slot> slots_;
+    ::mystic::types::uint32_t free_head_ = kNoSlot;
+};
+
+template <typename Type>
+inline void swap(slot_map<Type>& lhs, slot_map<Type>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mystic
@@ -0,0 +1,565 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/small_vector.hpp
+ * @file small_vector.hpp
+ * @brief Defines a vector storing its first N elements inline.
+ *
+ * @details
+ * `small_vector<T, N>` behaves like `std::vector<T>` but keeps up to `N`
+ * elements inside the object, so typically-small collections never touch
+ * the heap. Past `N` it grows geometrically on the heap.
+ *
+ * Growth, insertion, and erasure relocate elements with `memcpy`, or
+ * `memmove`, when `traits::is_trivially_relocatable` holds for `T`, and
+ * fall back to move construction otherwise. Inserting, or erasing before
+ * the end shifts elements in place, so it requires `T` to be trivially
+ * relocatable, or nothrow move constructible.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/small_vector.hpp"
+ *
+ * mystic::small_vector<std::string_view, 8> fields;
+ * fields.push_back("level");
+ * fields.push_back("message");
+ * // No heap allocation until the ninth field.
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "mystic/attributes/noinline.hpp"
+#include "mystic/memory/relocate.hpp"
+#include "mystic/memory/upstream.hpp"
+#include "mystic/traits/is_trivially_relocatable.hpp"
+#include "mystic/types/standard_def.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @brief Vector with inline storage for `N` elements.
+ *
+ * @tparam Type Element type.
+ * @tparam N Inline capacity (may be 0).
+ */
+template <typename Type, ::mystic::types::size_t N>
+class small_vector {
+public:
+    using value_type             = Type;
+    using size_type              = ::mystic::types::size_t;
+    using difference_type        = ::mystic::types::ptrdiff_t;
+    using reference              = Type&;
+    using const_reference        = const Type&;
+    using pointer                = Type*;
+    using const_pointer          = const Type*;
+    using iterator               = Type*;
+    using const_iterator         = const Type*;
+    using reverse_iterator       = ::std::reverse_iterator<iterator>;
+    using const_reverse_iterator = ::std::reverse_iterator<const_iterator>;
+
+    /**
+     * @brief Number of elements stored inline.
+     */
+    static constexpr size_type kInlineCapacity = N;
+
+    small_vector() noexcept
+        : data_(inline_data()), size_(0), capacity_(N) {}
+
+    explicit small_vector(size_type count)
+        : small_vector() {
+        resize(count);
+    }
+
+    small_vector(size_type count, const Type& value)
+        : small_vector() {
+        resize(count, value);
+    }
+
+    template <typename Iterator,
+              typename = ::std::enable_if_t<!::std::is_integral_v<Iterator>>>
+    small_vector(Iterator first, Iterator last)
+        : small_vector() {
+        append(first, last);
+    }
+
+    small_vector(::std::initializer_list<Type> values)
+        : small_vector() {
+        append(values.begin(), values.end());
+    }
+
+    small_vector(const small_vector& other)
+        : small_vector() {
+        append(other.begin(), other.end());
+    }
+
+    /**
+     * @brief Steals a heap buffer, or relocates inline elements; `other` is left empty.
+     */
+    small_vector(small_vector&& other) noexcept(kNothrowRelocate)
+        : small_vector() {
+        take(other);
+    }
+
+    small_vector& operator=(const small_vector& other) {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    small_vector& operator=(small_vector&& other) noexcept(kNothrowRelocate) {
+        if (this != &other) {
+            clear();
+            release_heap();
+            take(other);
+        }
+        return *this;
+    }
+
+    small_vector& operator=(::std::initializer_list<Type> values) {
+        assign(values.begin(), values.end());
+        return *this;
+    }
+
+    ~small_vector() {
+        ::std::destroy_n(data_, size_);
+        release_heap();
+    }
+
+    /* =============================================
+        Access
+       --------------------------------------------- */
+
+    reference operator[](size_type index) noexcept {
+        return data_[index];
+    }
+
+    const_reference operator[](size_type index) const noexcept {
+        return data_[index];
+    }
+
+    reference front() noexcept {
+        return data_[0];
+    }
+
+    const_reference front() const noexcept {
+        return data_[0];
+    }
+
+    reference back() noexcept {
+        return data_[size_ - 1];
+    }
+
+    const_reference back() const noexcept {
+        return data_[size_ - 1];
+    }
+
+    pointer data() noexcept {
+        return data_;
+    }
+
+    const_pointer data() const noexcept {
+        return data_;
+    }
+
+    iterator begin() noexcept {
+        return data_;
+    }
+
+    const_iterator begin() const noexcept {
+        return data_;
+    }
+
+    const_iterator cbegin() const noexcept {
+        return data_;
+    }
+
+    iterator end() noexcept {
+        return data_ + size_;
+    }
+
+    const_iterator end() const noexcept {
+        return data_ + size_;
+    }
+
+    const_iterator cend() const noexcept {
+        return data_ + size_;
+    }
+
+    reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    /* =============================================
+        Capacity
+       --------------------------------------------- */
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    size_type capacity() const noexcept {
+        return capacity_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    /**
+     * @brief Returns true while the elements live in the inline storage.
+     */
+    bool is_inline() const noexcept {
+        return data_ == inline_data();
+    }
+
+    static constexpr size_type max_size() noexcept {
+        return static_cast<size_type>(-1) / sizeof(Type);
+    }
+
+    /**
+     * @brief Ensures room for `count` elements without reallocation.
+     */
+    void reserve(size_type count) {
+        if (count > capacity_) {
+            reallocate(count);
+        }
+    }
+
+    /**
+     * @brief Returns to inline storage if the elements fit, else trims the heap buffer.
+     */
+    void shrink_to_fit() {
+        if (is_inline() || (size_ == capacity_)) {
+            return;
+        }
+        if (size_ <= N) {
+            Type* heap = data_;
+            const size_type heap_capacity = capacity_;
+            ::mystic::memory::relocate_n(heap, size_, inline_data());
+            deallocate(heap, heap_capacity);
+            data_ = inline_data();
+            capacity_ = N;
+        } else {
+            reallocate(size_);
+        }
+    }
+
+    /* =============================================
+        Modifiers
+       --------------------------------------------- */
+
+    void clear() noexcept {
+        ::std::destroy_n(data_, size_);
+        size_ = 0;
+    }
+
+    void push_back(const Type& value) {
+        emplace_back(value);
+    }
+
+    void push_back(Type&& value) {
+        emplace_back(::std::move(value));
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        if (size_ != capacity_) {
+            Type* slot = ::new (static_cast<void*>(data_ + size_)) Type(::std::forward<Args>(args)...);
+            ++size_;
+            return *slot;
+        }
+        return emplace_back_slow(::std::forward<Args>(args)...);
+    }
+
+    void pop_back() noexcept {
+        --size_;
+        data_[size_].~Type();
+    }
+
+    iterator insert(const_iterator pos, const Type& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, Type&& value) {
+        return emplace(pos, ::std::move(value));
+    }
+
+    /**
+     * @brief Constructs an element before `pos`, shifting the tail right.
+     */
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        const size_type index = static_cast<size_type>(pos - data_);
+        if (index == size_) {
+            emplace_back(::std::forward<Args>(args)...);
+            return data_ + index;
+        }
+
+        // Built first, as the arguments may refer to elements about to move.
+        Type value(::std::forward<Args>(args)...);
+        if (size_ == capacity_) {
+            reallocate(next_capacity(size_ + 1));
+        }
+        ::mystic::memory::shift_right(data_ + index, data_ + size_, 1);
+        ::new (static_cast<void*>(data_ + index)) Type(::std::move(value));
+        ++size_;
+        return data_ + index;
+    }
+
+    iterator erase(const_iterator pos) noexcept {
+        return erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) noexcept {
+        Type* begin = data_ + (first - data_);
+        const size_type count = static_cast<size_type>(last - first);
+        if (count != 0) {
+            ::std::destroy_n(begin, count);
+            ::mystic::memory::shift_left(begin, data_ + size_, count);
+            size_ -= count;
+        }
+        return begin;
+    }
+
+    void resize(size_type count) {
+        if (count <= size_) {
+            ::std::destroy_n(data_ + count, size_ - count);
+        } else {
+            reserve(count);
+            ::std::uninitialized_value_construct_n(data_ + size_, count - size_);
+        }
+        size_ = count;
+    }
+
+    void resize(size_type count, const Type& value) {
+        if (count <= size_) {
+            ::std::destroy_n(data_ + count, size_ - count);
+        } else if (count <= capacity_) {
+            ::std::uninitialized_fill_n(data_ + size_, count - size_, value);
+        } else {
+            const Type copy(value);
+            reserve(count);
+            ::std::uninitialized_fill_n(data_ + size_, count - size_, copy);
+        }
+        size_ = count;
+    }
+
+    void assign(size_type count, const Type& value) {
+        const Type copy(value);
+        clear();
+        resize(count, copy);
+    }
+
+    template <typename Iterator,
+              typename = ::std::enable_if_t<!::std::is_integral_v<Iterator>>>
+    void assign(Iterator first, Iterator last) {
+        clear();
+        append(first, last);
+    }
+
+    void assign(::std::initializer_list<Type> values) {
+        assign(values.begin(), values.end());
+    }
+
+    /**
+     * @brief Appends a range (the range must not alias this vector).
+     */
+    template <typename Iterator>
+    void append(Iterator first, Iterator last) {
+        using category = typename ::std::iterator_traits<Iterator>::iterator_category;
+        if constexpr (::std::is_base_of_v<::std::forward_iterator_tag, category>) {
+            const size_type count = static_cast<size_type>(::std::distance(first, last));
+            if (size_ + count > capacity_) {
+                reallocate(next_capacity(size_ + count));
+            }
+            ::std::uninitialized_copy(first, last, data_ + size_);
+            size_ += count;
+        } else {
+            for (; first != last; ++first) {
+                emplace_back(*first);
+            }
+        }
+    }
+
+    void swap(small_vector& other) noexcept(kNothrowRelocate) {
+        small_vector temp(::std::move(other));
+        other = ::std::move(*this);
+        *this = ::std::move(temp);
+    }
+
+    friend bool operator==(const small_vector& lhs, const small_vector& rhs) {
+        return (lhs.size_ == rhs.size_) && ::std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    friend bool operator!=(const small_vector& lhs, const small_vector& rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    static constexpr bool kNothrowRelocate = ::mystic::memory::is_nothrow_relocatable_v<Type>;
+
+    static constexpr bool kOverAligned = alignof(Type) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    Type* inline_data() noexcept {
+        return reinterpret_cast<Type*>(inline_);
+    }
+
+    const Type* inline_data() const noexcept {
+        return reinterpret_cast<const Type*>(inline_);
+    }
+
+    static Type* allocate(size_type count) {
+        if (count > max_size()) {
+            ::mystic::memory::internal::throw_bad_alloc();
+        }
+        if constexpr (kOverAligned) {
+            return static_cast<Type*>(::operator new(count * sizeof(Type), ::std::align_val_t(alignof(Type))));
+        } else {
+            return static_cast<Type*>(::operator new(count * sizeof(Type)));
+        }
+    }
+
+    static void deallocate(Type* storage, size_type count) noexcept {
+        if constexpr (kOverAligned) {
+            ::operator delete(storage, count * sizeof(Type), ::std::align_val_t(alignof(Type)));
+        } else {
+            ::operator delete(storage, count * sizeof(Type));
+        }
+    }
+
+    void release_heap() noexcept {
+        if (!is_inline()) {
+            deallocate(data_, capacity_);
+            data_ = inline_data();
+            capacity_ = N;
+        }
+    }
+
+    size_type next_capacity(size_type required) const noexcept {
+        const size_type doubled = (capacity_ > max_size() / 2) ? max_size() : capacity_ * 2;
+        return (doubled > required) ? doubled : required;
+    }
+
+    /**
+     * @brief Moves the elements to a heap buffer of `count` slots.
+     */
+    MYSTIC_NOINLINE void reallocate(size_type count) {
+        Type* storage = allocate(count);
+#if defined(__cpp_exceptions)
+        try {
+            ::mystic::memory::relocate_n(data_, size_, storage);
+        } catch (...) {
+            deallocate(storage, count);
+            throw;
+        }
+#else
+        ::mystic::memory::relocate_n(data_, size_, storage);
+#endif
+        release_heap();
+        data_ = storage;
+        capacity_ = count;
+    }
+
+    template <typename... Args>
+    MYSTIC_NOINLINE reference emplace_back_slow(Args&&... args) {
+        const size_type count = next_capacity(size_ + 1);
+        Type* storage = allocate(count);
+
+        // Built first, as the arguments may refer to existing elements.
+        Type* slot = nullptr;
+#if defined(__cpp_exceptions)
+        try {
+            slot = ::new (static_cast<void*>(storage + size_)) Type(::std::forward<Args>(args)...);
+            try {
+                ::mystic::memory::relocate_n(data_, size_, storage);
+            } catch (...) {
+                slot->~Type();
+                throw;
+            }
+        } catch (...) {
+            deallocate(storage, count);
+            throw;
+        }
+#else
+        slot = ::new (static_cast<void*>(storage + size_)) Type(::std::forward<Args>(args)...);
+        ::mystic::memory::relocate_n(data_, size_, storage);
+#endif
+        release_heap();
+        data_ = storage;
+        capacity_ = count;
+        ++size_;
+        return *slot;
+    }
+
+    /**
+     * @brief Takes the contents of `other`, which must leave `*this` empty, and inline.
+     */
+    void take(small_vector& other) noexcept(kNothrowRelocate) {
+        if (!other.is_inline()) {
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_data();
+            other.capacity_ = N;
+        } else {
+            ::mystic::memory::relocate_n(other.data_, other.size_, data_);
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+    Type* data_;
+    size_type size_;
+    size_type capacity_;
+    alignas(Type) unsigned char inline_[sizeof(Type) * ((N != 0) ? N : 1)];
+};
+
+template <typename Type, ::mystic::types::size_t N>
+inline void swap(small_vector<Type, N>& lhs, small_vector<Type, N>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+    lhs.swap(rhs);
+}
+
+} // namespace mystic
@@ -0,0 +1,563 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/containers/soa_vector.hpp
+ * @file soa_vector.hpp
+ * @brief Defines a structure-of-arrays vector.
+ *
+ * @details
+ * `soa_vector<Fields...>` stores each field in its own contiguous
+ * column, so a kernel reading one field streams only that field, and
+ * can vectorize over it. All columns live in one allocation, each one
+ * aligned to (at least) 64 bytes, and grow together.
+ *
+ * Rows are accessed through `SoaRow` proxies (which support structured
+ * bindings); columns through `ColumnSpan`, or raw pointers.
+ *
+ * This header file provides,
+ * 1. ColumnSpan - Pointer, and length view of one column.
+ * 2. SoaRow - Proxy reference to one row.
+ * 3. soa_vector - The container.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/containers/soa_vector.hpp"
+ *
+ * mystic::soa_vector<mystic::types::uint64_t, float, mystic::types::uint32_t> samples;  // time, value, host
+ * samples.push_back(ts, 0.5f, host);
+ *
+ * auto values = samples.column<1>();
+ * float sum = 0;
+ * for (float v : values) {
+ *     sum += v;           // Contiguous, 64-byte aligned floats.
+ * }
+ *
+ * auto [time, value, id] = samples[0];
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "mystic/attributes/noinline.hpp"
+#include "mystic/memory/relocate.hpp"
+#include "mystic/memory/upstream.hpp"
+#include "mystic/types/standard_def.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @brief Contiguous view of `size` elements at `data`.
+ */
+template <typename Type>
+struct ColumnSpan {
+    Type* data = nullptr;
+    ::mystic::types::size_t size = 0;
+
+    Type* begin() const noexcept {
+        return data;
+    }
+
+    Type* end() const noexcept {
+        return data + size;
+    }
+
+    Type& operator[](::mystic::types::size_t index) const noexcept {
+        return data[index];
+    }
+
+    bool empty() const noexcept {
+        return size == 0;
+    }
+};
+
+/**
+ * @brief Proxy reference to row `index` of a `soa_vector`.
+ *
+ * @details
+ * Valid until the vector reallocates. `get<I>()` returns a reference
+ * into column `I`; structured bindings bind those references.
+ */
+template <bool Const, typename... Fields>
+class SoaRow {
+    using columns_type = ::std::tuple<Fields*...>;
+
+public:
+    template <::mystic::types::size_t I>
+    using field_type = ::std::conditional_t<Const, const ::std::tuple_element_t<I, ::std::tuple<Fields...>>,
+                                            ::std::tuple_element_t<I, ::std::tuple<Fields...>>>;
+
+    SoaRow(const columns_type* columns, ::mystic::types::size_t index) noexcept
+        : columns_(columns), index_(index) {}
+
+    template <::mystic::types::size_t I>
+    field_type<I>& get() const noexcept {
+        return ::std::get<I>(*columns_)[index_];
+    }
+
+    /**
+     * @brief Copies the row out.
+     */
+    ::std::tuple<Fields...> value() const {
+        return value(::std::index_sequence_for<Fields...>{});
+    }
+
+    /**
+     * @brief Assigns every field of the row.
+     */
+    template <typename... Args, bool Mutable = !Const, typename = ::std::enable_if_t<Mutable>>
+    void assign(Args&&... args) const {
+        static_assert(sizeof...(Args) == sizeof...(Fields), "one argument per field");
+        assign(::std::index_sequence_for<Fields...>{}, ::std::forward<Args>(args)...);
+    }
+
+    ::mystic::types::size_t index() const noexcept {
+        return index_;
+    }
+
+private:
+    template <::mystic::types::size_t... I>
+    ::std::tuple<Fields...> value(::std::index_sequence<I...>) const {
+        return ::std::tuple<Fields...>(get<I>()...);
+    }
+
+    template <::mystic::types::size_t... I, typename... Args>
+    void assign(::std::index_sequence<I...>, Args&&... args) const {
+        ((get<I>() = ::std::forward<Args>(args)), ...);
+    }
+
+    const columns_type* columns_;
+    ::mystic::types::size_t index_;
+};
+
+/**
+ * @brief Vector of rows stored column by column in one allocation.
+ *
+ * @details
+ * Fields must be nothrow move constructible, so growth can move the
+ * columns without a rollback path.
+ *
+ * @tparam Fields Column types, in order.
+ */
+template <typename... Fields>
+class soa_vector {
+    static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+    static_assert((::std::is_nothrow_move_constructible_v<Fields> && ...),
+                  "soa_vector fields must be nothrow move constructible");
+
+    using columns_type = ::std::tuple<Fields*...>;
+    using indices      = ::std::index_sequence_for<Fields...>;
+
+    static constexpr bool kNothrowMoveAssign = (::std::is_nothrow_move_assignable_v<Fields> && ...);
+
+public:
+    using size_type           = ::mystic::types::size_t;
+    using row_reference       = SoaRow<false, Fields...>;
+    using const_row_reference = SoaRow<true, Fields...>;
+
+    template <size_type I>
+    using field_type = ::std::tuple_element_t<I, ::std::tuple<Fields...>>;
+
+    static constexpr size_type kColumnCount = sizeof...(Fields);
+
+    /// Alignment of every column start (a cache line, or more for over-aligned fields).
+    static constexpr size_type kColumnAlignment = ::std::max({size_type{64}, alignof(Fields)...});
+
+    soa_vector() noexcept = default;
+
+    /**
+     * @brief `count` value-initialized rows.
+     */
+    explicit soa_vector(size_type count) {
+        resize(count);
+    }
+
+    soa_vector(const soa_vector& other) {
+        reserve(other.size_);
+#if defined(__cpp_exceptions)
+        try {
+            for (size_type row = 0; row < other.size_; ++row) {
+                copy_row(other, row, indices{});
+            }
+        } catch (...) {
+            destroy_rows(0);
+            deallocate(storage_, capacity_);
+            throw;
+        }
+#else
+        for (size_type row = 0; row < other.size_; ++row) {
+            copy_row(other, row, indices{});
+        }
+#endif
+    }
+
+    soa_vector(soa_vector&& other) noexcept
+        : storage_(other.storage_), columns_(other.columns_), size_(other.size_), capacity_(other.capacity_) {
+        other.storage_ = nullptr;
+        other.columns_ = columns_type{};
+        other.size_ = 0;
+        other.capacity_ = 0;
+    }
+
+    soa_vector& operator=(const soa_vector& other) {
+        if (this != &other) {
+            soa_vector copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    soa_vector& operator=(soa_vector&& other) noexcept {
+        if (this != &other) {
+            soa_vector moved(::std::move(other));
+            swap(moved);
+        }
+        return *this;
+    }
+
+    ~soa_vector() {
+        destroy_rows(0);
+        deallocate(storage_, capacity_);
+    }
+
+    /* =============================================
+        Capacity
+       --------------------------------------------- */
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    size_type capacity() const noexcept {
+        return capacity_;
+    }
+
+    static constexpr size_type max_size() noexcept {
+        return (~size_type{0} / 2) / (sizeof(Fields) + ...) - kColumnAlignment;
+    }
+
+    void reserve(size_type count) {
+        if (count > capacity_) {
+            reallocate(count);
+        }
+    }
+
+    /**
+     * @brief Grows with value-initialized rows, or truncates, to `count` rows.
+     */
+    void resize(size_type count) {
+        if (count <= size_) {
+            destroy_rows(count);
+            return;
+        }
+        reserve(count);
+        const size_type old_size = size_;
+#if defined(__cpp_exceptions)
+        try {
+            while (size_ < count) {
+                construct_default(columns_, size_, indices{});
+                ++size_;
+            }
+        } catch (...) {
+            destroy_rows(old_size);
+            throw;
+        }
+#else
+        (void)old_size;
+        while (size_ < count) {
+            construct_default(columns_, size_, indices{});
+            ++size_;
+        }
+#endif
+    }
+
+    /* =============================================
+        Access
+       --------------------------------------------- */
+
+    row_reference operator[](size_type row) noexcept {
+        return row_reference(&columns_, row);
+    }
+
+    const_row_reference operator[](size_type row) const noexcept {
+        return const_row_reference(&columns_, row);
+    }
+
+    /**
+     * @brief Column `I` as a span of `size()` elements.
+     */
+    template <size_type I>
+    ColumnSpan<field_type<I>> column() noexcept {
+        return ColumnSpan<field_type<I>>{::std::get<I>(columns_), size_};
+    }
+
+    template <size_type I>
+    ColumnSpan<const field_type<I>> column() const noexcept {
+        return ColumnSpan<const field_type<I>>{::std::get<I>(columns_), size_};
+    }
+
+    /**
+     * @brief Start of column `I`, aligned to `kColumnAlignment` (null with no capacity).
+     */
+    template <size_type I>
+    field_type<I>* data() noexcept {
+        return ::std::get<I>(columns_);
+    }
+
+    template <size_type I>
+    const field_type<I>* data() const noexcept {
+        return ::std::get<I>(columns_);
+    }
+
+    /* =============================================
+        Modifiers
+       --------------------------------------------- */
+
+    /**
+     * @brief Appends a row built from one argument per field.
+     */
+    template <typename... Args>
+    row_reference emplace_back(Args&&... args) {
+        static_assert(sizeof...(Args) == kColumnCount, "one argument per field");
+        if (size_ == capacity_) {
+            return emplace_back_slow(::std::forward<Args>(args)...);
+        }
+        construct_row(columns_, size_, indices{}, ::std::forward<Args>(args)...);
+        return row_reference(&columns_, size_++);
+    }
+
+    void push_back(const Fields&... values) {
+        emplace_back(values...);
+    }
+
+    /// Precondition: not empty.
+    void pop_back() noexcept {
+        destroy_rows(size_ - 1);
+    }
+
+    /**
+     * @brief Erases row `row` by moving the last row into it (order is not kept).
+     *
+     * @details
+     * Move-assigns each field; if one throws, the row is left partly
+     * overwritten, and the size is unchanged.
+     */
+    void swap_remove(size_type row) noexcept(kNothrowMoveAssign) {
+        if (row != size_ - 1) {
+            move_row(size_ - 1, row, indices{});
+        }
+        pop_back();
+    }
+
+    void clear() noexcept {
+        destroy_rows(0);
+    }
+
+    void swap(soa_vector& other) noexcept {
+        ::std::swap(storage_, other.storage_);
+        ::std::swap(columns_, other.columns_);
+        ::std::swap(size_, other.size_);
+        ::std::swap(capacity_, other.capacity_);
+    }
+
+private:
+    /* ---------------- Layout ---------------- */
+
+    static constexpr size_type column_bytes(size_type capacity, size_type element_size) noexcept {
+        return (capacity * element_size + kColumnAlignment - 1) & ~(kColumnAlignment - 1);
+    }
+
+    static constexpr size_type storage_bytes(size_type capacity) noexcept {
+        return (column_bytes(capacity, sizeof(Fields)) + ...);
+    }
+
+    /// Column starts within one buffer, in field order.
+    template <size_type... I>
+    static columns_type carve(void* storage, size_type capacity, ::std::index_sequence<I...>) noexcept {
+        columns_type columns;
+        size_type offset = 0;
+        ((::std::get<I>(columns) = reinterpret_cast<field_type<I>*>(static_cast<char*>(storage) + offset),
+          offset += column_bytes(capacity, sizeof(field_type<I>))),
+         ...);
+        return columns;
+    }
+
+    static void* allocate(size_type capacity) {
+        if (capacity > max_size()) {
+            ::mystic::memory::internal::throw_bad_alloc();
+        }
+        return ::operator new(storage_bytes(capacity), ::std::align_val_t(kColumnAlignment));
+    }
+
+    static void deallocate(void* storage, size_type capacity) noexcept {
+        if (storage != nullptr) {
+            ::operator delete(storage, storage_bytes(capacity), ::std::align_val_t(kColumnAlignment));
+        }
+    }
+
+    size_type next_capacity(size_type required) const noexcept {
+        const size_type doubled = (capacity_ > max_size() / 2) ? max_size() : capacity_ * 2;
+        return (doubled > required) ? doubled : required;
+    }
+
+    /* ---------------- Rows ---------------- */
+
+    /// Argument requesting a value-initialized field.
+    struct ValueInit {};
+
+    template <size_type... I>
+    static void construct_default(const columns_type& columns, size_type row, ::std::index_sequence<I...> seq) {
+        construct_row(columns, row, seq, (static_cast<void>(I), ValueInit{})...);
+    }
+
+    /**
+     * @brief Constructs row `row` field by field; a throwing field destroys the ones before it.
+     */
+    template <size_type I, size_type... Rest, typename Arg, typename... Args>
+    static void construct_row(const columns_type& columns, size_type row, ::std::index_sequence<I, Rest...>,
+                              Arg&& arg, Args&&... args) {
+        using Field = field_type<I>;
+        Field* slot = nullptr;
+        if constexpr (::std::is_same_v<::std::decay_t<Arg>, ValueInit>) {
+            slot = ::new (static_cast<void*>(::std::get<I>(columns) + row)) Field();
+        } else {
+            slot = ::new (static_cast<void*>(::std::get<I>(columns) + row)) Field(::std::forward<Arg>(arg));
+        }
+        if constexpr (sizeof...(Rest) != 0) {
+#if defined(__cpp_exceptions)
+            try {
+                construct_row(columns, row, ::std::index_sequence<Rest...>{}, ::std::forward<Args>(args)...);
+            } catch (...) {
+                slot->~Field();
+                throw;
+            }
+#else
+            construct_row(columns, row, ::std::index_sequence<Rest...>{}, ::std::forward<Args>(args)...);
+#endif
+        }
+        (void)slot;
+    }
+
+    template <size_type... I>
+    void copy_row(const soa_vector& other, size_type row, ::std::index_sequence<I...>) {
+        emplace_back(::std::get<I>(other.columns_)[row]...);
+    }
+
+    template <size_type... I>
+    void move_row(size_type from, size_type to, ::std::index_sequence<I...>) noexcept(kNothrowMoveAssign) {
+        ((::std::get<I>(columns_)[to] = ::std::move(::std::get<I>(columns_)[from])), ...);
+    }
+
+    /// Destroys rows `[count, size)`.
+    void destroy_rows(size_type count) noexcept {
+        destroy_columns(count, indices{});
+        size_ = count;
+    }
+
+    template <size_type... I>
+    void destroy_columns(size_type count, ::std::index_sequence<I...>) noexcept {
+        (::std::destroy(::std::get<I>(columns_) + count, ::std::get<I>(columns_) + size_), ...);
+    }
+
+    template <size_type... I>
+    static void relocate_columns(const columns_type& from, const columns_type& to, size_type count,
+                                 ::std::index_sequence<I...>) noexcept {
+        (::mystic::memory::relocate_n(::std::get<I>(from), count, ::std::get<I>(to)), ...);
+    }
+
+    /* ---------------- Growth ---------------- */
+
+    MYSTIC_NOINLINE void reallocate(size_type capacity) {
+        void* storage = allocate(capacity);
+        const columns_type columns = carve(storage, capacity, indices{});
+        relocate_columns(columns_, columns, size_, indices{});
+        deallocate(storage_, capacity_);
+        storage_ = storage;
+        columns_ = columns;
+        capacity_ = capacity;
+    }
+
+    template <typename... Args>
+    MYSTIC_NOINLINE row_reference emplace_back_slow(Args&&... args) {
+        const size_type capacity = next_capacity(size_ + 1);
+        void* storage = allocate(capacity);
+        const columns_type columns = carve(storage, capacity, indices{});
+
+        // Built first, as the arguments may refer to existing rows.
+#if defined(__cpp_exceptions)
+        try {
+            construct_row(columns, size_, indices{}, ::std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(storage, capacity);
+            throw;
+        }
+#else
+        construct_row(columns, size_, indices{}, ::std::forward<Args>(args)...);
+#endif
+        relocate_columns(columns_, columns, size_, indices{});
+        deallocate(storage_, capacity_);
+        storage_ = storage;
+        columns_ = columns;
+        capacity_ = capacity;
+        return row_reference(&columns_, size_++);
+    }
+
+    void* storage_ = nullptr;
+    columns_type columns_{};
+    size_type size_ = 0;
+    size_type capacity_ = 0;
+};
+
+template <typename... Fields>
+inline void swap(soa_vector<Fields...>& lhs, soa_vector<Fields...>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // namespace mystic
+
+/**
+ * @brief Structured binding support for `SoaRow`.
+ */
+namespace std {
+
+template <bool Const, typename... Fields>
+struct tuple_size<::mystic::SoaRow<Const, Fields...>> : integral_constant<size_t, sizeof...(Fields)> {};
+
+template <size_t I, bool Const, typename... Fields>
+struct tuple_element<I, ::mystic::SoaRow<Const, Fields...>> {
+    using type = typename ::mystic::SoaRow<Const, Fields...>::template field_type<I>&;
+};
+
+} // namespace std
@@ -0,0 +1,775 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/hash/fast_hash.hpp
+ * @file fast_hash.hpp
+ * @brief Defines fast non-cryptographic hash functions.
+ *
+ * @details
+ * This header provides seeded 64-bit and 128-bit hashes over bytes and
+ * string views. They are NOT cryptographic, and must not be used where
+ * an attacker controls the input and can observe the output.
+ *
+ * Two strategies are used depending on input length,
+ * 1. Up to 256 bytes, a wyhash-style multiply-fold mix.
+ * 2. Above 256 bytes, an XXH3-style striped accumulator, which is
+ *    vectorized with AVX2 or NEON (see simd_detection.hpp).
+ *
+ * Both strategies read input as little-endian, and every SIMD path
+ * produces the exact same value as the scalar path, so hashes are
+ * stable across platforms, and between compile time and run time.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/hash/fast_hash.hpp"
+ *
+ * // Compile time key.
+ * constexpr auto key = mystic::hash::hash64("mystic.logger.level");
+ *
+ * // Run time bytes with a seed.
+ * auto h = mystic::hash::hash64(buffer, size, 0x1234);
+ *
+ * // As a hasher for std containers.
+ * std::unordered_map<std::string, int, mystic::hash::Hasher<std::string>> map;
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "mystic/architecture/endianness_detection.hpp"
+#include "mystic/architecture/simd_detection.hpp"
+#include "mystic/attributes/forceinline.hpp"
+#include "mystic/traits/is_constant_evaluated.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+#if MYSTIC_ARCH_SIMD_HAS_AVX2
+# include <immintrin.h>
+#elif MYSTIC_ARCH_SIMD_HAS_NEON
+# include <arm_neon.h>
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::hash
+ * @brief Hash functions, and hashers.
+ */
+namespace hash {
+
+/**
+ * @brief 128-bit hash value.
+ */
+struct Hash128 {
+    ::mystic::types::uint64_t low;
+    ::mystic::types::uint64_t high;
+
+    friend constexpr bool operator==(const Hash128& lhs, const Hash128& rhs) noexcept {
+        return (lhs.low == rhs.low) && (lhs.high == rhs.high);
+    }
+
+    friend constexpr bool operator!=(const Hash128& lhs, const Hash128& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+};
+
+/**
+ * @namespace mystic::hash::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+using u32 = ::mystic::types::uint32_t;
+using u64 = ::mystic::types::uint64_t;
+using size_t = ::mystic::types::size_t;
+
+#if defined(__SIZEOF_INT128__)
+/// `__extension__` keeps -Wpedantic quiet about the non-standard type.
+__extension__ typedef unsigned __int128 u128;
+#endif
+
+/* =============================================
+    Constants
+   --------------------------------------------- */
+
+/**
+ * @brief Multiplicative primes shared by both strategies.
+ */
+constexpr inline u64 kPrime32_1 = 0x9E3779B1ULL;
+constexpr inline u64 kPrime32_2 = 0x85EBCA77ULL;
+constexpr inline u64 kPrime32_3 = 0xC2B2AE3DULL;
+constexpr inline u64 kPrime64_1 = 0x9E3779B185EBCA87ULL;
+constexpr inline u64 kPrime64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr inline u64 kPrime64_3 = 0x165667B19E3779F9ULL;
+constexpr inline u64 kPrime64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr inline u64 kPrime64_5 = 0x27D4EB2F165667C5ULL;
+
+/**
+ * @brief Secret words of the short-input mix (wyhash final4 constants).
+ */
+constexpr inline u64 kShortSecret[4] = {
+    0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL,
+    0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL,
+};
+
+/**
+ * @brief Number of 64-bit words in the long-input secret.
+ */
+constexpr inline size_t kSecretWords = 24;
+
+/**
+ * @brief Secret words of the long-input accumulator (splitmix64 output).
+ */
+constexpr inline u64 kLongSecret[kSecretWords] = {
+    0x752b566a1fe6137fULL, 0xc30d9922a1fcf95fULL, 0x73d0ccb2cb2f1486ULL,
+    0xb2ce006af3bac814ULL, 0x7188aac4ec866f8bULL, 0x87f6f10e4418d6adULL,
+    0x10349fdd3a90c47bULL, 0x5ae31120cfbc3d6eULL, 0xd0c779d3f63b258aULL,
+    0x413d51c520243c7eULL, 0x8f498dc2bbce3492ULL, 0x87532f5577aee8ecULL,
+    0x570005cb2d470e9cULL, 0x4f93b572ae352502ULL, 0xf4c451e7646d46f6ULL,
+    0x4f44b047c702b025ULL, 0xbad5501ad1f58edcULL, 0xa803fba1edb7216cULL,
+    0x2030313debf10927ULL, 0x3e29cd75406ed978ULL, 0x970b78104a2c30a3ULL,
+    0x9f79c7cfa7bb448fULL, 0x9838ede5a1f62b60ULL, 0x5d7228f6681b036eULL,
+};
+
+/**
+ * @brief Seed perturbation used for the upper half of 128-bit hashes.
+ */
+constexpr inline u64 kHighSeedMask = 0x6a09e667f3bcc909ULL;
+
+/**
+ * @brief Inputs longer than this use the striped accumulator.
+ */
+constexpr inline size_t kShortMaxLength = 256;
+
+/**
+ * @brief Stripe, and block geometry of the striped accumulator.
+ */
+constexpr inline size_t kStripeLength    = 64;
+constexpr inline size_t kStripesPerBlock = kSecretWords - 8;
+constexpr inline size_t kBlockLength     = kStripeLength * kStripesPerBlock;
+constexpr inline size_t kScrambleOffset  = kSecretWords - 8;
+constexpr inline size_t kLastStripeOffset = 13;
+
+/* =============================================
+    Primitives
+   --------------------------------------------- */
+
+/**
+ * @brief Reads 8 bytes as little-endian.
+ *
+ * @details
+ * Compilers fold this pattern into a single load on little-endian
+ * targets, while keeping it usable in constant expressions.
+ */
+template <typename CharT>
+constexpr inline u64 read64(const CharT* p) noexcept {
+    return (static_cast<u64>(static_cast<unsigned char>(p[0])))       |
+           (static_cast<u64>(static_cast<unsigned char>(p[1])) << 8)  |
+           (static_cast<u64>(static_cast<unsigned char>(p[2])) << 16) |
+           (static_cast<u64>(static_cast<unsigned char>(p[3])) << 24) |
+           (static_cast<u64>(static_cast<unsigned char>(p[4])) << 32) |
+           (static_cast<u64>(static_cast<unsigned char>(p[5])) << 40) |
+           (static_cast<u64>(static_cast<unsigned char>(p[6])) << 48) |
+           (static_cast<u64>(static_cast<unsigned char>(p[7])) << 56);
+}
+
+/**
+ * @brief Reads 4 bytes as little-endian.
+ */
+template <typename CharT>
+constexpr inline u64 read32(const CharT* p) noexcept {
+    return (static_cast<u64>(static_cast<unsigned char>(p[0])))       |
+           (static_cast<u64>(static_cast<unsigned char>(p[1])) << 8)  |
+           (static_cast<u64>(static_cast<unsigned char>(p[2])) << 16) |
+           (static_cast<u64>(static_cast<unsigned char>(p[3])) << 24);
+}
+
+/**
+ * @brief Reads 1 to 3 bytes (first, middle, and last).
+ */
+template <typename CharT>
+constexpr inline u64 read_small(const CharT* p, size_t len) noexcept {
+    return (static_cast<u64>(static_cast<unsigned char>(p[0])) << 16)          |
+           (static_cast<u64>(static_cast<unsigned char>(p[len >> 1])) << 8)    |
+           (static_cast<u64>(static_cast<unsigned char>(p[len - 1])));
+}
+
+/**
+ * @brief Full 64x64 -> 128 multiply, returned as (low, high).
+ */
+constexpr inline void multiply128(u64& a, u64& b) noexcept {
+#if defined(__SIZEOF_INT128__)
+    const u128 r = static_cast<u128>(a) * b;
+    a = static_cast<u64>(r);
+    b = static_cast<u64>(r >> 64);
+#else
+    const u64 ha = a >> 32, hb = b >> 32;
+    const u64 la = static_cast<u32>(a), lb = static_cast<u32>(b);
+    const u64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    const u64 t = rl + (rm0 << 32);
+    u64 carry = (t < rl) ? 1 : 0;
+    const u64 lo = t + (rm1 << 32);
+    carry += (lo < t) ? 1 : 0;
+    a = lo;
+    b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+}
+
+/**
+ * @brief Multiplies, and folds the 128-bit product to 64 bits.
+ */
+constexpr inline u64 mix(u64 a, u64 b) noexcept {
+    multiply128(a, b);
+    return a ^ b;
+}
+
+/**
+ * @brief Final avalanche of the striped accumulator.
+ */
+constexpr inline u64 avalanche(u64 h) noexcept {
+    h ^= h >> 37;
+    h *= kPrime64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+/* =============================================
+    Short Inputs (<= 256 bytes)
+   --------------------------------------------- */
+
+/**
+ * @brief wyhash-style mix for short inputs.
+ */
+template <typename CharT>
+constexpr inline u64 hash_short(const CharT* p, size_t len, u64 seed) noexcept {
+    seed ^= mix(seed ^ kShortSecret[0], kShortSecret[1]);
+
+    u64 a = 0;
+    u64 b = 0;
+
+    if (len <= 16) {
+        if (len >= 4) {
+            const size_t shift = (len >> 3) << 2;
+            a = (read32(p) << 32) | read32(p + shift);
+            b = (read32(p + len - 4) << 32) | read32(p + len - 4 - shift);
+        } else if (len > 0) {
+            a = read_small(p, len);
+        }
+    } else {
+        size_t i = len;
+
+        if (i > 48) {
+            u64 see1 = seed;
+            u64 see2 = seed;
+
+            do {
+                seed = mix(read64(p)      ^ kShortSecret[1], read64(p + 8)  ^ seed);
+                see1 = mix(read64(p + 16) ^ kShortSecret[2], read64(p + 24) ^ see1);
+                see2 = mix(read64(p + 32) ^ kShortSecret[3], read64(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+
+            seed ^= see1 ^ see2;
+        }
+
+        while (i > 16) {
+            seed = mix(read64(p) ^ kShortSecret[1], read64(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+
+        a = read64(p + i - 16);
+        b = read64(p + i - 8);
+    }
+
+    a ^= kShortSecret[1];
+    b ^= seed;
+    multiply128(a, b);
+    return mix(a ^ kShortSecret[0] ^ len, b ^ kShortSecret[1]);
+}
+
+/* =============================================
+    Long Inputs (> 256 bytes)
+   --------------------------------------------- */
+
+/**
+ * @brief Striped accumulator state, and its seeded secret.
+ */
+struct LongState {
+    u64 acc[8];
+    u64 secret[kSecretWords];
+};
+
+/**
+ * @brief Initializes accumulator lanes, and derives the seeded secret.
+ */
+constexpr inline void init_long_state(LongState& state, u64 seed) noexcept {
+    state.acc[0] = kPrime32_3;
+    state.acc[1] = kPrime64_1;
+    state.acc[2] = kPrime64_2;
+    state.acc[3] = kPrime64_3;
+    state.acc[4] = kPrime64_4;
+    state.acc[5] = kPrime32_2;
+    state.acc[6] = kPrime64_5;
+    state.acc[7] = kPrime32_1;
+
+    for (size_t i = 0; i < kSecretWords; i += 2) {
+        state.secret[i]     = kLongSecret[i]     + seed;
+        state.secret[i + 1] = kLongSecret[i + 1] - seed;
+    }
+}
+
+/**
+ * @brief Accumulates one 64-byte stripe (scalar reference).
+ */
+template <typename CharT>
+constexpr inline void accumulate_stripe_scalar(u64* acc, const CharT* p, const u64* key) noexcept {
+    for (size_t i = 0; i < 8; ++i) {
+        const u64 data = read64(p + (i * 8));
+        const u64 data_key = data ^ key[i];
+        acc[i ^ 1] += data;
+        acc[i] += (data_key & 0xFFFFFFFFULL) * (data_key >> 32);
+    }
+}
+
+/**
+ * @brief Scrambles accumulator lanes at block boundaries (scalar reference).
+ */
+constexpr inline void scramble_scalar(u64* acc, const u64* key) noexcept {
+    for (size_t i = 0; i < 8; ++i) {
+        u64 a = acc[i];
+        a ^= a >> 47;
+        a ^= key[i];
+        a *= kPrime32_1;
+        acc[i] = a;
+    }
+}
+
+/**
+ * @brief Runs the whole striped loop (scalar reference).
+ */
+template <typename CharT>
+constexpr inline void hash_long_loop_scalar(LongState& state, const CharT* p, size_t len) noexcept {
+    const size_t nb_blocks = (len - 1) / kBlockLength;
+
+    for (size_t n = 0; n < nb_blocks; ++n) {
+        for (size_t s = 0; s < kStripesPerBlock; ++s) {
+            accumulate_stripe_scalar(state.acc, p + (n * kBlockLength) + (s * kStripeLength),
+                                     state.secret + s);
+        }
+        scramble_scalar(state.acc, state.secret + kScrambleOffset);
+    }
+
+    const size_t nb_stripes = ((len - 1) - (nb_blocks * kBlockLength)) / kStripeLength;
+    for (size_t s = 0; s < nb_stripes; ++s) {
+        accumulate_stripe_scalar(state.acc, p + (nb_blocks * kBlockLength) + (s * kStripeLength),
+                                 state.secret + s);
+    }
+
+    accumulate_stripe_scalar(state.acc, p + len - kStripeLength, state.secret + kLastStripeOffset);
+}
+
+#if MYSTIC_ARCH_SIMD_HAS_AVX2
+
+/**
+ * @brief Accumulates one stripe into two 256-bit lanes.
+ */
+MYSTIC_FORCEINLINE inline void accumulate_stripe_avx2(__m256i& acc0, __m256i& acc1,
+                                                      const unsigned char* p,
+                                                      const u64* key) noexcept {
+    const __m256i d0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    const __m256i d1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32));
+    const __m256i k0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key));
+    const __m256i k1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key + 4));
+
+    const __m256i dk0 = _mm256_xor_si256(d0, k0);
+    const __m256i dk1 = _mm256_xor_si256(d1, k1);
+
+    // lo32(dk) * hi32(dk) per 64-bit lane.
+    const __m256i p0 = _mm256_mul_epu32(dk0, _mm256_srli_epi64(dk0, 32));
+    const __m256i p1 = _mm256_mul_epu32(dk1, _mm256_srli_epi64(dk1, 32));
+
+    // Swap neighbouring 64-bit lanes, i.e., acc[i ^ 1] += data[i].
+    const __m256i s0 = _mm256_shuffle_epi32(d0, _MM_SHUFFLE(1, 0, 3, 2));
+    const __m256i s1 = _mm256_shuffle_epi32(d1, _MM_SHUFFLE(1, 0, 3, 2));
+
+    acc0 = _mm256_add_epi64(acc0, _mm256_add_epi64(p0, s0));
+    acc1 = _mm256_add_epi64(acc1, _mm256_add_epi64(p1, s1));
+}
+
+/**
+ * @brief Scrambles one 256-bit lane.
+ */
+MYSTIC_FORCEINLINE inline __m256i scramble_avx2(__m256i acc, const u64* key) noexcept {
+    const __m256i k = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key));
+    const __m256i prime = _mm256_set1_epi64x(static_cast<long long>(kPrime32_1));
+
+    acc = _mm256_xor_si256(acc, _mm256_srli_epi64(acc, 47));
+    acc = _mm256_xor_si256(acc, k);
+
+    // 64x32 multiply built from two 32x32 -> 64 products.
+    const __m256i lo = _mm256_mul_epu32(acc, prime);
+    const __m256i hi = _mm256_mul_epu32(_mm256_srli_epi64(acc, 32), prime);
+    return _mm256_add_epi64(lo, _mm256_slli_epi64(hi, 32));
+}
+
+/**
+ * @brief Runs the whole striped loop with AVX2.
+ */
+inline void hash_long_loop_simd(LongState& state, const unsigned char* p, size_t len) noexcept {
+    __m256i acc0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state.acc));
+    __m256i acc1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state.acc + 4));
+
+    const size_t nb_blocks = (len - 1) / kBlockLength;
+
+    for (size_t n = 0; n < nb_blocks; ++n) {
+        for (size_t s = 0; s < kStripesPerBlock; ++s) {
+            accumulate_stripe_avx2(acc0, acc1, p + (n * kBlockLength) + (s * kStripeLength),
+                                   state.secret + s);
+        }
+        acc0 = scramble_avx2(acc0, state.secret + kScrambleOffset);
+        acc1 = scramble_avx2(acc1, state.secret + kScrambleOffset + 4);
+    }
+
+    const size_t nb_stripes = ((len - 1) - (nb_blocks * kBlockLength)) / kStripeLength;
+    for (size_t s = 0; s < nb_stripes; ++s) {
+        accumulate_stripe_avx2(acc0, acc1, p + (nb_blocks * kBlockLength) + (s * kStripeLength),
+                               state.secret + s);
+    }
+
+    accumulate_stripe_avx2(acc0, acc1, p + len - kStripeLength, state.secret + kLastStripeOffset);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(state.acc), acc0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(state.acc + 4), acc1);
+}
+
+#elif MYSTIC_ARCH_SIMD_HAS_NEON && (MYSTIC_ARCH_ENDIANNESS == MYSTIC_ARCH_ENDIANNESS_LITTLE)
+
+/**
+ * @brief Accumulates one stripe into four 128-bit lanes.
+ */
+MYSTIC_FORCEINLINE inline void accumulate_stripe_neon(uint64x2_t* acc,
+                                                      const unsigned char* p,
+                                                      const u64* key) noexcept {
+    for (size_t i = 0; i < 4; ++i) {
+        const uint64x2_t data = vreinterpretq_u64_u8(vld1q_u8(p + (i * 16)));
+        const uint64x2_t data_key = veorq_u64(data, vld1q_u64(key + (i * 2)));
+
+        // lo32(dk) * hi32(dk) per 64-bit lane.
+        const uint64x2_t product = vmull_u32(vmovn_u64(data_key), vshrn_n_u64(data_key, 32));
+
+        // Swap neighbouring 64-bit lanes, i.e., acc[i ^ 1] += data[i].
+        const uint64x2_t swapped = vextq_u64(data, data, 1);
+
+        acc[i] = vaddq_u64(acc[i], vaddq_u64(product, swapped));
+    }
+}
+
+/**
+ * @brief Scrambles four 128-bit lanes.
+ */
+MYSTIC_FORCEINLINE inline void scramble_neon(uint64x2_t* acc, const u64* key) noexcept {
+    const uint32x2_t prime = vdup_n_u32(static_cast<u32>(kPrime32_1));
+
+    for (size_t i = 0; i < 4; ++i) {
+        uint64x2_t a = acc[i];
+        a = veorq_u64(a, vshrq_n_u64(a, 47));
+        a = veorq_u64(a, vld1q_u64(key + (i * 2)));
+
+        // 64x32 multiply built from two 32x32 -> 64 products.
+        const uint64x2_t lo = vmull_u32(vmovn_u64(a), prime);
+        const uint64x2_t hi = vmull_u32(vshrn_n_u64(a, 32), prime);
+        acc[i] = vaddq_u64(lo, vshlq_n_u64(hi, 32));
+    }
+}
+
+/**
+ * @brief Runs the whole striped loop with NEON.
+ */
+inline void hash_long_loop_simd(LongState& state, const unsigned char* p, size_t len) noexcept {
+    uint64x2_t acc[4];
+    for (size_t i = 0; i < 4; ++i) {
+        acc[i] = vld1q_u64(state.acc + (i * 2));
+    }
+
+    const size_t nb_blocks = (len - 1) / kBlockLength;
+
+    for (size_t n = 0; n < nb_blocks; ++n) {
+        for (size_t s = 0; s < kStripesPerBlock; ++s) {
+            accumulate_stripe_neon(acc, p + (n * kBlockLength) + (s * kStripeLength),
+                                   state.secret + s);
+        }
+        scramble_neon(acc, state.secret + kScrambleOffset);
+    }
+
+    const size_t nb_stripes = ((len - 1) - (nb_blocks * kBlockLength)) / kStripeLength;
+    for (size_t s = 0; s < nb_stripes; ++s) {
+        accumulate_stripe_neon(acc, p + (nb_blocks * kBlockLength) + (s * kStripeLength),
+                               state.secret + s);
+    }
+
+    accumulate_stripe_neon(acc, p + len - kStripeLength, state.secret + kLastStripeOffset);
+
+    for (size_t i = 0; i < 4; ++i) {
+        vst1q_u64(state.acc + (i * 2), acc[i]);
+    }
+}
+
+#else /* scalar */
+
+/**
+ * @brief Runs the whole striped loop (no SIMD available).
+ */
+inline void hash_long_loop_simd(LongState& state, const unsigned char* p, size_t len) noexcept {
+    hash_long_loop_scalar(state, p, len);
+}
+
+#endif // MYSTIC_ARCH_SIMD_HAS_AVX2
+
+/**
+ * @brief Runs the striped loop, using SIMD when not constant evaluated.
+ */
+template <typename CharT>
+constexpr inline void hash_long_loop(LongState& state, const CharT* p, size_t len) noexcept {
+    if (!::mystic::traits::is_constant_evaluated()) {
+        hash_long_loop_simd(state, reinterpret_cast<const unsigned char*>(p), len);
+    } else {
+        hash_long_loop_scalar(state, p, len);
+    }
+}
+
+/**
+ * @brief Folds the accumulator lanes into one 64-bit value.
+ */
+constexpr inline u64 merge_accumulators(const LongState& state, size_t key_offset, u64 start) noexcept {
+    u64 result = start;
+    for (size_t i = 0; i < 4; ++i) {
+        result += mix(state.acc[2 * i] ^ state.secret[key_offset + (2 * i)],
+                      state.acc[(2 * i) + 1] ^ state.secret[key_offset + (2 * i) + 1]);
+    }
+    return avalanche(result);
+}
+
+/**
+ * @brief Striped accumulator for long inputs, 64-bit result.
+ */
+template <typename CharT>
+constexpr inline u64 hash_long64(const CharT* p, size_t len, u64 seed) noexcept {
+    LongState state{};
+    init_long_state(state, seed);
+    hash_long_loop(state, p, len);
+    return merge_accumulators(state, 1, static_cast<u64>(len) * kPrime64_1);
+}
+
+/**
+ * @brief Striped accumulator for long inputs, 128-bit result.
+ */
+template <typename CharT>
+constexpr inline Hash128 hash_long128(const CharT* p, size_t len, u64 seed) noexcept {
+    LongState state{};
+    init_long_state(state, seed);
+    hash_long_loop(state, p, len);
+    return Hash128{
+        merge_accumulators(state, 1, static_cast<u64>(len) * kPrime64_1),
+        merge_accumulators(state, 11, ~(static_cast<u64>(len) * kPrime64_2)),
+    };
+}
+
+/**
+ * @brief Dispatches on length, 64-bit result.
+ */
+template <typename CharT>
+constexpr inline u64 hash64(const CharT* p, size_t len, u64 seed) noexcept {
+    if (len <= kShortMaxLength) {
+        return hash_short(p, len, seed);
+    }
+    return hash_long64(p, len, seed);
+}
+
+/**
+ * @brief Dispatches on length, 128-bit result.
+ */
+template <typename CharT>
+constexpr inline Hash128 hash128(const CharT* p, size_t len, u64 seed) noexcept {
+    if (len <= kShortMaxLength) {
+        return Hash128{hash_short(p, len, seed), hash_short(p, len, seed ^ kHighSeedMask)};
+    }
+    return hash_long128(p, len, seed);
+}
+
+} // namespace internal
+
+/* =============================================
+    Public Interface
+   --------------------------------------------- */
+
+/**
+ * @brief 64-bit hash of a string view.
+ *
+ * @param data The given string view.
+ * @param seed The seed, different seeds give independent hashes.
+ *
+ * @returns The 64-bit hash.
+ */
+constexpr inline ::mystic::types::uint64_t hash64(::std::string_view data,
+                                                  ::mystic::types::uint64_t seed = 0) noexcept {
+    return internal::hash64(data.data(), data.size(), seed);
+}
+
+/**
+ * @brief 64-bit hash of raw bytes.
+ *
+ * @param data Pointer to the first byte.
+ * @param size Number of bytes.
+ * @param seed The seed, different seeds give independent hashes.
+ *
+ * @returns The 64-bit hash.
+ */
+inline ::mystic::types::uint64_t hash64(const void* data, ::mystic::types::size_t size,
+                                        ::mystic::types::uint64_t seed = 0) noexcept {
+    return internal::hash64(static_cast<const unsigned char*>(data), size, seed);
+}
+
+/**
+ * @brief 128-bit hash of a string view.
+ *
+ * @param data The given string view.
+ * @param seed The seed, different seeds give independent hashes.
+ *
+ * @returns The 128-bit hash.
+ */
+constexpr inline Hash128 hash128(::std::string_view data,
+                                 ::mystic::types::uint64_t seed = 0) noexcept {
+    return internal::hash128(data.data(), data.size(), seed);
+}
+
+/**
+ * @brief 128-bit hash of raw bytes.
+ *
+ * @param data Pointer to the first byte.
+ * @param size Number of bytes.
+ * @param seed The seed, different seeds give independent hashes.
+ *
+ * @returns The 128-bit hash.
+ */
+inline Hash128 hash128(const void* data, ::mystic::types::size_t size,
+                       ::mystic::types::uint64_t seed = 0) noexcept {
+    return internal::hash128(static_cast<const unsigned char*>(data), size, seed);
+}
+
+/**
+ * @brief 64-bit hash of a single 64-bit integer.
+ *
+ * @details
+ * Cheaper than hashing the integer's bytes, as it is a single
+ * multiply-fold round.
+ *
+ * @param value The given integer.
+ * @param seed The seed, different seeds give independent hashes.
+ *
+ * @returns The 64-bit hash.
+ */
+constexpr inline ::mystic::types::uint64_t hash_integer(::mystic::types::uint64_t value,
+                                                        ::mystic::types::uint64_t seed = 0) noexcept {
+    return internal::mix(value ^ internal::kShortSecret[0] ^ seed,
+                         internal::kShortSecret[1] ^ (seed >> 1) ^ internal::kPrime64_1);
+}
+
+/* =============================================
+    Hasher
+   --------------------------------------------- */
+
+/**
+ * @brief Hasher functor, a drop-in replacement of std::hash.
+ *
+ * @details
+ * Specialized for integrals, enums, pointers, and strings. String hashers
+ * are transparent, so containers supporting heterogeneous lookup can be
+ * searched with a std::string_view, or a C string.
+ */
+template <typename Type, typename = void>
+struct Hasher;
+
+/**
+ * @brief Hasher for integral, and enum types.
+ */
+template <typename Type>
+struct Hasher<Type, ::std::enable_if_t<::std::is_integral<Type>::value ||
+                                       ::std::is_enum<Type>::value>> {
+    constexpr ::mystic::types::size_t operator()(Type value) const noexcept {
+        return static_cast<::mystic::types::size_t>(
+            hash_integer(static_cast<::mystic::types::uint64_t>(value)));
+    }
+};
+
+/**
+ * @brief Hasher for pointers.
+ */
+template <typename Type>
+struct Hasher<Type*, void> {
+    ::mystic::types::size_t operator()(const Type* value) const noexcept {
+        return static_cast<::mystic::types::size_t>(
+            hash_integer(reinterpret_cast<::mystic::types::uintptr_t>(value)));
+    }
+};
+
+/**
+ * @brief Transparent hasher for string-like types.
+ */
+struct StringHasher {
+    using is_transparent = void;
+
+    constexpr ::mystic::types::size_t operator()(::std::string_view value) const noexcept {
+        return static_cast<::mystic::types::size_t>(hash64(value));
+    }
+
+    ::mystic::types::size_t operator()(const ::std::string& value) const noexcept {
+        return static_cast<::mystic::types::size_t>(hash64(::std::string_view(value)));
+    }
+
+    constexpr ::mystic::types::size_t operator()(const char* value) const noexcept {
+        return static_cast<::mystic::types::size_t>(hash64(::std::string_view(value)));
+    }
+};
+
+/**
+ * @brief Hasher for std::string_view.
+ */
+template <>
+struct Hasher<::std::string_view, void> : StringHasher {};
+
+/**
+ * @brief Hasher for std::string.
+ */
+template <>
+struct Hasher<::std::string, void> : StringHasher {};
+
+} // namespace hash
+} // namespace mystic
@@ -0,0 +1,378 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/memory/arena.hpp
+ * @file arena.hpp
+ * @brief Defines a monotonic (bump) arena allocator.
+ *
+ * @details
+ * This header provides `mystic::memory::Arena`, which hands out aligned
+ * blocks by bumping a cursor through a chain of chunks. Individual blocks
+ * are never freed; instead the whole arena is reset, or rewound to a
+ * marker, in O(1). Chunks are kept across resets, so a warmed up arena
+ * serves a request shaped workload without touching the upstream allocator.
+ *
+ * This header file provides,
+ * 1. Arena, the allocator itself (optionally starting in a caller buffer).
+ * 2. ArenaMarker, a saved position to rewind to.
+ * 3. ArenaResource, a `std::pmr::memory_resource` adapter.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/memory/arena.hpp"
+ *
+ * alignas(std::max_align_t) std::byte stack[4096];
+ * mystic::memory::Arena arena(stack, sizeof(stack));
+ *
+ * auto* header = arena.create<RequestHeader>();
+ * auto* ids = arena.allocate_array<std::uint64_t>(count);
+ *
+ * mystic::memory::ArenaResource resource(arena);
+ * std::pmr::vector<int> values(&resource);
+ *
+ * arena.reset(); // Everything above is gone, chunks are kept.
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+#include "mystic/attributes/noinline.hpp"
+#include "mystic/memory/upstream.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::memory
+ * @brief Memory allocation facilities.
+ */
+namespace memory {
+
+/**
+ * @brief Saved arena position, see `Arena::mark()`.
+ */
+struct ArenaMarker {
+    /// Chunk the cursor was in, or null for the initial buffer.
+    void* chunk = nullptr;
+
+    /// Cursor inside that chunk.
+    char* cursor = nullptr;
+};
+
+/**
+ * @brief Monotonic arena, bump-allocating from chained chunks.
+ *
+ * @details
+ * Allocation is a pointer bump on the fast path. When the current chunk
+ * is exhausted, the next retained chunk is reused if large enough, and
+ * otherwise a new chunk (doubling up to `kMaxChunkSize`) is requested from
+ * the upstream resource, or `std::malloc`.
+ *
+ * Objects placed in the arena are not destroyed by it; use it for
+ * trivially destructible data, or destroy objects manually.
+ */
+class Arena {
+public:
+    /// Default alignment of `allocate()`.
+    static constexpr ::mystic::types::size_t kDefaultAlignment = alignof(::mystic::types::max_align_t);
+
+    /// Default size of the first heap chunk.
+    static constexpr ::mystic::types::size_t kDefaultChunkSize = 4096;
+
+    /// Upper bound of the geometric chunk growth.
+    static constexpr ::mystic::types::size_t kMaxChunkSize = ::mystic::types::size_t(1) << 20;
+
+    /**
+     * @brief Constructs an empty arena.
+     *
+     * @param chunk_size Size of the first heap chunk.
+     * @param upstream Source of chunks, or null for `std::malloc`.
+     */
+    explicit Arena(::mystic::types::size_t chunk_size = kDefaultChunkSize,
+                   ::std::pmr::memory_resource* upstream = nullptr) noexcept
+        : next_chunk_size_(chunk_size), upstream_(upstream) {}
+
+    /**
+     * @brief Constructs an arena that starts in a caller buffer.
+     *
+     * @param buffer Initial storage, not owned, must outlive the arena.
+     * @param size Size of the buffer.
+     * @param chunk_size Size of the first heap chunk.
+     * @param upstream Source of chunks, or null for `std::malloc`.
+     */
+    Arena(void* buffer, ::mystic::types::size_t size,
+          ::mystic::types::size_t chunk_size = kDefaultChunkSize,
+          ::std::pmr::memory_resource* upstream = nullptr) noexcept
+        : cursor_(static_cast<char*>(buffer)), end_(static_cast<char*>(buffer) + size),
+          initial_begin_(static_cast<char*>(buffer)), initial_end_(static_cast<char*>(buffer) + size),
+          next_chunk_size_(chunk_size), upstream_(upstream) {}
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    ~Arena() {
+        release();
+    }
+
+    /* =============================================
+        Allocation
+       --------------------------------------------- */
+
+    /**
+     * @brief Allocates `size` bytes aligned to `alignment` (a power of two).
+     *
+     * @returns The block, or null if the upstream allocator failed.
+     */
+    void* allocate(::mystic::types::size_t size,
+                   ::mystic::types::size_t alignment = kDefaultAlignment) noexcept {
+        const ::mystic::types::uintptr_t cursor = reinterpret_cast<::mystic::types::uintptr_t>(cursor_);
+        const ::mystic::types::uintptr_t aligned = (cursor + alignment - 1) & ~(alignment - 1);
+        const ::mystic::types::uintptr_t end = reinterpret_cast<::mystic::types::uintptr_t>(end_);
+
+        if ((aligned <= end) && (size <= end - aligned) && (cursor_ != nullptr)) {
+            cursor_ = reinterpret_cast<char*>(aligned + size);
+            return reinterpret_cast<void*>(aligned);
+        }
+        return allocate_slow(size, alignment);
+    }
+
+    /**
+     * @brief Allocates uninitialized storage for `count` objects of a type.
+     */
+    template <typename Type>
+    Type* allocate_array(::mystic::types::size_t count) noexcept {
+        if (count > (static_cast<::mystic::types::size_t>(-1) / sizeof(Type))) {
+            return nullptr;
+        }
+        return static_cast<Type*>(allocate(sizeof(Type) * count, alignof(Type)));
+    }
+
+    /**
+     * @brief Constructs an object in the arena (it is never destroyed by the arena).
+     *
+     * @returns The object, or null if allocation failed.
+     */
+    template <typename Type, typename... Args>
+    Type* create(Args&&... args) {
+        void* storage = allocate(sizeof(Type), alignof(Type));
+        return (storage != nullptr) ? ::new (storage) Type(::std::forward<Args>(args)...) : nullptr;
+    }
+
+    /* =============================================
+        Reset, and Rewind
+       --------------------------------------------- */
+
+    /**
+     * @brief Returns the current position.
+     */
+    ArenaMarker mark() const noexcept {
+        return ArenaMarker{current_, cursor_};
+    }
+
+    /**
+     * @brief Frees everything allocated after `marker` was taken, in O(1).
+     *
+     * @details
+     * Chunks past the marker are retained, and reused by later allocations.
+     */
+    void rewind(const ArenaMarker& marker) noexcept {
+        current_ = static_cast<Chunk*>(marker.chunk);
+        cursor_ = marker.cursor;
+        end_ = (current_ != nullptr) ? current_->end() : initial_end_;
+    }
+
+    /**
+     * @brief Frees everything, retaining all chunks, in O(1).
+     */
+    void reset() noexcept {
+        if (initial_begin_ != nullptr) {
+            rewind(ArenaMarker{nullptr, initial_begin_});
+        } else if (head_ != nullptr) {
+            rewind(ArenaMarker{head_, head_->begin()});
+        }
+    }
+
+    /**
+     * @brief Frees everything, and returns all chunks upstream.
+     */
+    void release() noexcept {
+        Chunk* chunk = head_;
+        while (chunk != nullptr) {
+            Chunk* next = chunk->next;
+            internal::upstream_deallocate(upstream_, chunk, chunk->size);
+            chunk = next;
+        }
+
+        head_ = nullptr;
+        current_ = nullptr;
+        cursor_ = initial_begin_;
+        end_ = initial_end_;
+        capacity_ = 0;
+    }
+
+    /* =============================================
+        Observers
+       --------------------------------------------- */
+
+    /**
+     * @brief Returns the total size of heap chunks held.
+     */
+    ::mystic::types::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    /**
+     * @brief Returns the upstream resource (null for `std::malloc`).
+     */
+    ::std::pmr::memory_resource* upstream() const noexcept {
+        return upstream_;
+    }
+
+private:
+    /**
+     * @brief Chunk header, the usable bytes follow it.
+     */
+    struct alignas(::mystic::types::max_align_t) Chunk {
+        Chunk* next;
+        ::mystic::types::size_t size;
+
+        char* begin() noexcept {
+            return reinterpret_cast<char*>(this + 1);
+        }
+
+        char* end() noexcept {
+            return reinterpret_cast<char*>(this) + size;
+        }
+    };
+
+    /**
+     * @brief Moves to the next chunk that fits, or chains a new one.
+     */
+    MYSTIC_NOINLINE void* allocate_slow(::mystic::types::size_t size, ::mystic::types::size_t alignment) noexcept {
+        if ((alignment == 0) || ((alignment & (alignment - 1)) != 0)) {
+            return nullptr;
+        }
+
+        if ((size > (static_cast<::mystic::types::size_t>(-1) / 4)) ||
+            (alignment > (static_cast<::mystic::types::size_t>(-1) / 4))) {
+            return nullptr;
+        }
+
+        Chunk* next = (current_ != nullptr) ? current_->next : head_;
+        const ::mystic::types::size_t slack = (alignment > alignof(Chunk)) ? alignment - alignof(Chunk) : 0;
+
+        if ((next == nullptr) || (next->size < sizeof(Chunk) + slack + size)) {
+            ::mystic::types::size_t chunk_size = sizeof(Chunk) + size + slack;
+            if (chunk_size < next_chunk_size_) {
+                chunk_size = next_chunk_size_;
+            }
+
+            auto* chunk = static_cast<Chunk*>(internal::upstream_allocate(upstream_, chunk_size));
+            if (chunk == nullptr) {
+                return nullptr;
+            }
+            chunk->next = next;
+            chunk->size = chunk_size;
+            capacity_ += chunk_size;
+
+            if (current_ != nullptr) {
+                current_->next = chunk;
+            } else {
+                head_ = chunk;
+            }
+            if (next_chunk_size_ < kMaxChunkSize) {
+                next_chunk_size_ *= 2;
+            }
+            next = chunk;
+        }
+
+        current_ = next;
+        cursor_ = next->begin();
+        end_ = next->end();
+        return allocate(size, alignment);
+    }
+
+    /// Bump cursor, and end of the current block.
+    char* cursor_ = nullptr;
+    char* end_ = nullptr;
+
+    /// Caller provided initial buffer (may be null).
+    char* initial_begin_ = nullptr;
+    char* initial_end_ = nullptr;
+
+    /// Chunk chain, and the chunk the cursor is in (null for the initial buffer).
+    Chunk* head_ = nullptr;
+    Chunk* current_ = nullptr;
+
+    ::mystic::types::size_t next_chunk_size_;
+    ::mystic::types::size_t capacity_ = 0;
+    ::std::pmr::memory_resource* upstream_;
+};
+
+/**
+ * @brief `std::pmr::memory_resource` over an arena.
+ *
+ * @details
+ * Deallocation is a no-op; memory comes back on `Arena::reset()`, or
+ * `Arena::rewind()`. Allocation failure throws `std::bad_alloc` (abort
+ * without exceptions), as the interface requires.
+ */
+class ArenaResource final : public ::std::pmr::memory_resource {
+public:
+    explicit ArenaResource(Arena& arena) noexcept
+        : arena_(&arena) {}
+
+    /**
+     * @brief Returns the underlying arena.
+     */
+    Arena& arena() const noexcept {
+        return *arena_;
+    }
+
+private:
+    void* do_allocate(::mystic::types::size_t bytes, ::mystic::types::size_t alignment) override {
+        void* ptr = arena_->allocate((bytes != 0) ? bytes : 1, alignment);
+        if (ptr == nullptr) {
+            internal::throw_bad_alloc();
+        }
+        return ptr;
+    }
+
+    void do_deallocate(void*, ::mystic::types::size_t, ::mystic::types::size_t) override {}
+
+    bool do_is_equal(const ::std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    Arena* arena_;
+};
+
+} // namespace memory
+} // namespace mystic
@@ -0,0 +1,363 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/memory/mirrored_ring_buffer.hpp
+ * @file mirrored_ring_buffer.hpp
+ * @brief Defines a ring buffer whose pages are mapped twice back-to-back.
+ *
+ * @details
+ * The same memfd pages are mapped at `[base, base + capacity)`, and at
+ * `[base + capacity, base + 2 * capacity)`, so any run of up to `capacity`
+ * bytes starting inside the first half is contiguous, even across the
+ * wraparound. Producers `memcpy` records whole, and consumers hand one
+ * pointer to `write()`, or `writev()`, without split copies.
+ *
+ * Linux only; the header is empty elsewhere.
+ *
+ * This header file provides,
+ * 1. MirroredRegion, the raw double mapping, for custom (e.g. MPSC) queues.
+ * 2. MirroredRingBuffer, a single-producer, single-consumer byte ring on top.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/memory/mirrored_ring_buffer.hpp"
+ *
+ * mystic::memory::MirroredRingBuffer ring;
+ * if (ring.create(1u << 20) != mystic::status::StatusCode::OK) {
+ *     return;
+ * }
+ *
+ * // Producer thread
+ * ring.write(record, record_size);
+ *
+ * // Consumer thread
+ * const mystic::memory::RingSlice pending = ring.peek();
+ * const ssize_t written = ::write(fd, pending.data, pending.size);
+ * if (written > 0) {
+ *     ring.consume(static_cast<std::size_t>(written));
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "mystic/architecture/os_detection.hpp"
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+
+#include <atomic>
+#include <cstring>
+#include <utility>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/memory/page_allocator.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+#include "mystic/utility/bit.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::memory
+ * @brief Memory allocation facilities.
+ */
+namespace memory {
+
+/**
+ * @brief Contiguous run of ring bytes.
+ */
+struct RingSlice {
+    char* data = nullptr;
+    ::mystic::types::size_t size = 0;
+};
+
+/* =============================================
+    Mirrored Region
+   --------------------------------------------- */
+
+/**
+ * @brief Memory mapped twice back-to-back.
+ *
+ * @details
+ * `data()[i]`, and `data()[i + capacity()]` are the same byte for every
+ * `i < capacity()`. The capacity is a power of two, and a multiple of the
+ * page size, so offsets wrap with a mask.
+ */
+class MirroredRegion {
+public:
+    MirroredRegion() noexcept = default;
+
+    MirroredRegion(const MirroredRegion&) = delete;
+    MirroredRegion& operator=(const MirroredRegion&) = delete;
+
+    MirroredRegion(MirroredRegion&& other) noexcept
+        : data_(::std::exchange(other.data_, nullptr)), capacity_(::std::exchange(other.capacity_, 0)) {}
+
+    MirroredRegion& operator=(MirroredRegion&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            data_ = ::std::exchange(other.data_, nullptr);
+            capacity_ = ::std::exchange(other.capacity_, 0);
+        }
+        return *this;
+    }
+
+    ~MirroredRegion() {
+        unmap();
+    }
+
+    /**
+     * @brief Maps at least `capacity` bytes (rounded up to a power of two, and a page).
+     *
+     * @returns `OK`, `FAILED_PRECONDITION` if already mapped, `INVALID_ARGUMENT`
+     * for a zero, or overflowing capacity, `UNAVAILABLE` if memfd is not
+     * supported, or `RESOURCE_EXHAUSTED` if mapping failed.
+     */
+    ::mystic::status::StatusCode map(::mystic::types::size_t capacity) noexcept {
+        if (data_ != nullptr) {
+            return ::mystic::status::StatusCode::FAILED_PRECONDITION;
+        }
+        if ((capacity == 0) || (capacity > (static_cast<::mystic::types::size_t>(-1) >> 2))) {
+            return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+        }
+
+        const ::mystic::types::size_t page = internal::small_page_size();
+        const ::mystic::types::size_t size =
+            static_cast<::mystic::types::size_t>(::mystic::bit::bit_ceil((capacity < page) ? page : capacity));
+
+        // MFD_CLOEXEC; the raw syscall avoids depending on the glibc wrapper.
+        const int fd = static_cast<int>(::syscall(SYS_memfd_create, "mystic-ring", 1u));
+        if (fd < 0) {
+            return ::mystic::status::StatusCode::UNAVAILABLE;
+        }
+        if (::ftruncate(fd, static_cast<::off_t>(size)) != 0) {
+            ::close(fd);
+            return ::mystic::status::StatusCode::RESOURCE_EXHAUSTED;
+        }
+
+        // Reserve both halves first, so nothing else can land in between.
+        void* base = ::mmap(nullptr, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (base == MAP_FAILED) {
+            ::close(fd);
+            return ::mystic::status::StatusCode::RESOURCE_EXHAUSTED;
+        }
+
+        char* first = static_cast<char*>(base);
+        const bool mapped =
+            (::mmap(first, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED) &&
+            (::mmap(first + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED);
+        ::close(fd);
+        if (!mapped) {
+            ::munmap(base, 2 * size);
+            return ::mystic::status::StatusCode::RESOURCE_EXHAUSTED;
+        }
+
+        data_ = first;
+        capacity_ = size;
+        return ::mystic::status::StatusCode::OK;
+    }
+
+    /**
+     * @brief Unmaps both halves.
+     */
+    void unmap() noexcept {
+        if (data_ != nullptr) {
+            ::munmap(data_, 2 * capacity_);
+        }
+        data_ = nullptr;
+        capacity_ = 0;
+    }
+
+    /**
+     * @brief Returns the start of the first half.
+     */
+    char* data() const noexcept {
+        return data_;
+    }
+
+    /**
+     * @brief Returns the size of one half.
+     */
+    ::mystic::types::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+private:
+    char* data_ = nullptr;
+    ::mystic::types::size_t capacity_ = 0;
+};
+
+/* =============================================
+    Ring Buffer
+   --------------------------------------------- */
+
+/**
+ * @brief Single-producer, single-consumer byte ring on a `MirroredRegion`.
+ *
+ * @details
+ * Positions grow monotonically, and are masked on access. `write()` keeps
+ * a cached copy of the consumer's position, so it touches the consumer's
+ * cache line only when the cached view runs out of space.
+ */
+class MirroredRingBuffer {
+public:
+    MirroredRingBuffer() noexcept = default;
+
+    MirroredRingBuffer(const MirroredRingBuffer&) = delete;
+    MirroredRingBuffer& operator=(const MirroredRingBuffer&) = delete;
+
+    /**
+     * @brief Maps the ring; see `MirroredRegion::map()`.
+     */
+    ::mystic::status::StatusCode create(::mystic::types::size_t capacity) noexcept {
+        const ::mystic::status::StatusCode status = region_.map(capacity);
+        if (status == ::mystic::status::StatusCode::OK) {
+            mask_ = region_.capacity() - 1;
+            read_.position.store(0, ::std::memory_order_relaxed);
+            write_.position.store(0, ::std::memory_order_relaxed);
+            read_.cached = 0;
+            write_.cached = 0;
+        }
+        return status;
+    }
+
+    /**
+     * @brief Returns the ring size.
+     */
+    ::mystic::types::size_t capacity() const noexcept {
+        return region_.capacity();
+    }
+
+    /**
+     * @brief Returns the number of readable bytes (a snapshot).
+     */
+    ::mystic::types::size_t size() const noexcept {
+        return static_cast<::mystic::types::size_t>(write_.position.load(::std::memory_order_acquire) -
+                                                    read_.position.load(::std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Returns the underlying region.
+     */
+    const MirroredRegion& region() const noexcept {
+        return region_;
+    }
+
+    /* ---------------- Producer ---------------- */
+
+    /**
+     * @brief Returns the contiguous free space (producer only).
+     */
+    RingSlice prepare_write() noexcept {
+        const ::mystic::types::uint64_t tail = write_.position.load(::std::memory_order_relaxed);
+        write_.cached = read_.position.load(::std::memory_order_acquire);
+        const ::mystic::types::size_t free = region_.capacity() - static_cast<::mystic::types::size_t>(tail - write_.cached);
+        return RingSlice{region_.data() + (tail & mask_), free};
+    }
+
+    /**
+     * @brief Publishes `size` bytes written into `prepare_write()` (producer only).
+     */
+    void commit_write(::mystic::types::size_t size) noexcept {
+        write_.position.store(write_.position.load(::std::memory_order_relaxed) + size, ::std::memory_order_release);
+    }
+
+    /**
+     * @brief Copies a record in whole, or not at all (producer only).
+     *
+     * @returns False if there is not enough free space.
+     */
+    bool write(const void* data, ::mystic::types::size_t size) noexcept {
+        const ::mystic::types::uint64_t tail = write_.position.load(::std::memory_order_relaxed);
+        if (region_.capacity() - static_cast<::mystic::types::size_t>(tail - write_.cached) < size) {
+            write_.cached = read_.position.load(::std::memory_order_acquire);
+            if (region_.capacity() - static_cast<::mystic::types::size_t>(tail - write_.cached) < size) {
+                return false;
+            }
+        }
+        if (size != 0) {
+            ::std::memcpy(region_.data() + (tail & mask_), data, size);
+        }
+        write_.position.store(tail + size, ::std::memory_order_release);
+        return true;
+    }
+
+    /* ---------------- Consumer ---------------- */
+
+    /**
+     * @brief Returns every readable byte as one contiguous run (consumer only).
+     */
+    RingSlice peek() noexcept {
+        const ::mystic::types::uint64_t head = read_.position.load(::std::memory_order_relaxed);
+        read_.cached = write_.position.load(::std::memory_order_acquire);
+        return RingSlice{region_.data() + (head & mask_), static_cast<::mystic::types::size_t>(read_.cached - head)};
+    }
+
+    /**
+     * @brief Releases `size` bytes returned by `peek()` (consumer only).
+     */
+    void consume(::mystic::types::size_t size) noexcept {
+        read_.position.store(read_.position.load(::std::memory_order_relaxed) + size, ::std::memory_order_release);
+    }
+
+    /**
+     * @brief Copies out up to `capacity` bytes (consumer only).
+     *
+     * @returns The number of bytes read.
+     */
+    ::mystic::types::size_t read(void* out, ::mystic::types::size_t capacity) noexcept {
+        const RingSlice pending = peek();
+        const ::mystic::types::size_t size = (pending.size < capacity) ? pending.size : capacity;
+        if (size != 0) {
+            ::std::memcpy(out, pending.data, size);
+            consume(size);
+        }
+        return size;
+    }
+
+private:
+    /**
+     * @brief One side's position, and its cache of the other side's.
+     */
+    struct alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) Cursor {
+        ::std::atomic<::mystic::types::uint64_t> position{0};
+        ::mystic::types::uint64_t cached = 0;
+    };
+
+    MirroredRegion region_;
+    ::mystic::types::uint64_t mask_ = 0;
+    Cursor write_;
+    Cursor read_;
+};
+
+} // namespace memory
+} // namespace mystic
+
+#endif // (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
@@ -0,0 +1,570 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/memory/numa.hpp
+ * @file numa.hpp
+ * @brief Defines NUMA topology, node-local allocation, and thread placement.
+ *
+ * @details
+ * This header provides NUMA support without a libnuma dependency. On Linux
+ * the topology is read from sysfs (`/sys/devices/system/node`), memory is
+ * placed with the `mbind`, and `set_mempolicy` system calls, and threads
+ * are pinned with `sched_setaffinity`.
+ *
+ * Machines (and OSes) without NUMA information are reported as a single
+ * node 0 owning every CPU; placement calls for node 0 then succeed as
+ * no-ops, so the same code runs everywhere.
+ *
+ * This header file provides,
+ * 1. NumaTopology, the node, memory, and CPU layout.
+ * 2. current_node(), bind_to_node(), prefer_node(), and pin_thread_to_node().
+ * 3. NumaResource, a node-local `std::pmr::memory_resource` for `Arena`,
+ *    and `FixedPool::set_upstream()`.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/memory/numa.hpp"
+ *
+ * const auto& topology = mystic::memory::NumaTopology::system();
+ * for (int node = 0; node < topology.max_node() + 1; ++node) {
+ *     if (topology.has_node(node)) {
+ *         std::thread([node] {
+ *             mystic::memory::pin_thread_to_node(node);
+ *             mystic::memory::NumaResource local(node);
+ *             mystic::memory::Arena arena(1u << 20, &local);
+ *             // ... node-local work
+ *         }).detach();
+ *     }
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <memory_resource>
+#include <string_view>
+#include <thread>
+
+#include "mystic/architecture/os_detection.hpp"
+#include "mystic/memory/upstream.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+# include <cerrno>
+# include <fcntl.h>
+# include <sched.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+# include "mystic/memory/page_allocator.hpp"
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::memory
+ * @brief Memory allocation facilities.
+ */
+namespace memory {
+
+/**
+ * @brief NUMA layout of the machine, read once.
+ *
+ * @details
+ * Nodes are addressed by their kernel id, which may be sparse; use
+ * `has_node()` while iterating up to `max_node()`.
+ */
+class NumaTopology {
+public:
+    /// Highest supported node id plus one.
+    static constexpr int kMaxNodes = 64;
+
+    /// Highest supported CPU id plus one.
+    static constexpr int kMaxCpus = 1024;
+
+    /**
+     * @brief Returns the topology of this machine (read on first use).
+     */
+    static const NumaTopology& system() noexcept {
+        static const NumaTopology topology = [] {
+            NumaTopology result;
+            result.load();
+            return result;
+        }();
+        return topology;
+    }
+
+    /**
+     * @brief Returns the number of nodes (at least 1).
+     */
+    int node_count() const noexcept {
+        return node_count_;
+    }
+
+    /**
+     * @brief Returns the highest node id.
+     */
+    int max_node() const noexcept {
+        return max_node_;
+    }
+
+    /**
+     * @brief Returns true if the machine has more than one node.
+     */
+    bool is_numa() const noexcept {
+        return node_count_ > 1;
+    }
+
+    /**
+     * @brief Returns true if a node id exists.
+     */
+    bool has_node(int node) const noexcept {
+        return (node >= 0) && (node < kMaxNodes) && nodes_[node].present;
+    }
+
+    /**
+     * @brief Returns the memory of a node in bytes, or 0 if unknown.
+     */
+    ::mystic::types::size_t node_memory(int node) const noexcept {
+        return has_node(node) ? nodes_[node].memory : 0;
+    }
+
+    /**
+     * @brief Returns the number of CPUs of a node.
+     */
+    int cpu_count(int node) const noexcept {
+        return has_node(node) ? nodes_[node].cpu_count : 0;
+    }
+
+    /**
+     * @brief Returns true if a CPU belongs to a node.
+     */
+    bool node_has_cpu(int node, int cpu) const noexcept {
+        return has_node(node) && (cpu >= 0) && (cpu < kMaxCpus) &&
+               ((nodes_[node].cpus[cpu / 64] >> (cpu % 64)) & 1u) != 0;
+    }
+
+    /**
+     * @brief Returns the node of a CPU (0 if unknown).
+     */
+    int node_of_cpu(int cpu) const noexcept {
+        for (int node = 0; node <= max_node_; ++node) {
+            if (node_has_cpu(node, cpu)) {
+                return node;
+            }
+        }
+        return 0;
+    }
+
+private:
+    struct Node {
+        bool present = false;
+        int cpu_count = 0;
+        ::mystic::types::size_t memory = 0;
+        ::mystic::types::uint64_t cpus[kMaxCpus / 64] = {};
+    };
+
+    /**
+     * @brief Parses a kernel list ("0-3,8,10-11") into a bitmask.
+     */
+    template <typename Callback>
+    static void parse_list(const char* text, Callback&& callback) noexcept {
+        const char* cursor = text;
+        while ((*cursor >= '0') && (*cursor <= '9')) {
+            int first = 0;
+            while ((*cursor >= '0') && (*cursor <= '9')) {
+                first = first * 10 + (*cursor++ - '0');
+            }
+            int last = first;
+            if (*cursor == '-') {
+                ++cursor;
+                last = 0;
+                while ((*cursor >= '0') && (*cursor <= '9')) {
+                    last = last * 10 + (*cursor++ - '0');
+                }
+            }
+            for (int id = first; id <= last; ++id) {
+                callback(id);
+            }
+            if (*cursor == ',') {
+                ++cursor;
+            }
+        }
+    }
+
+    /**
+     * @brief Falls back to one node holding the online CPUs (assumed numbered from 0).
+     */
+    void load_single_node() noexcept {
+        *this = NumaTopology();
+        nodes_[0].present = true;
+        const unsigned int online = ::std::thread::hardware_concurrency();
+        const int cpus = (online == 0) ? 1 : (online > static_cast<unsigned int>(kMaxCpus)) ? kMaxCpus
+                                                                                           : static_cast<int>(online);
+        for (int cpu = 0; cpu < cpus; ++cpu) {
+            nodes_[0].cpus[cpu / 64] |= ::mystic::types::uint64_t(1) << (cpu % 64);
+        }
+        nodes_[0].cpu_count = cpus;
+        node_count_ = 1;
+        max_node_ = 0;
+    }
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+    /**
+     * @brief Reads a small sysfs file, null terminated; returns false if missing.
+     */
+    static bool read_file(const char* path, char* buffer, ::mystic::types::size_t capacity) noexcept {
+        const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return false;
+        }
+        const ::ssize_t length = ::read(fd, buffer, capacity - 1);
+        ::close(fd);
+        buffer[(length > 0) ? length : 0] = '\0';
+        return length > 0;
+    }
+
+    /**
+     * @brief Writes "/sys/devices/system/node/node<id>/<leaf>" into path.
+     */
+    static void node_path(char* path, int node, const char* leaf) noexcept {
+        const char prefix[] = "/sys/devices/system/node/node";
+        char* cursor = path;
+        for (const char* c = prefix; *c != '\0'; ++c) {
+            *cursor++ = *c;
+        }
+        char digits[8];
+        int count = 0;
+        do {
+            digits[count++] = static_cast<char>('0' + node % 10);
+            node /= 10;
+        } while (node != 0);
+        while (count != 0) {
+            *cursor++ = digits[--count];
+        }
+        *cursor++ = '/';
+        for (const char* c = leaf; *c != '\0'; ++c) {
+            *cursor++ = *c;
+        }
+        *cursor = '\0';
+    }
+
+    void load() noexcept {
+        char text[4096];
+        if (!read_file("/sys/devices/system/node/online", text, sizeof(text))) {
+            load_single_node();
+            return;
+        }
+
+        parse_list(text, [this](int node) {
+            if ((node >= 0) && (node < kMaxNodes)) {
+                nodes_[node].present = true;
+                ++node_count_;
+                max_node_ = (node > max_node_) ? node : max_node_;
+            }
+        });
+        if (node_count_ == 0) {
+            load_single_node();
+            return;
+        }
+
+        char path[96];
+        for (int node = 0; node <= max_node_; ++node) {
+            if (!nodes_[node].present) {
+                continue;
+            }
+
+            node_path(path, node, "cpulist");
+            if (read_file(path, text, sizeof(text))) {
+                Node& entry = nodes_[node];
+                parse_list(text, [&entry](int cpu) {
+                    if ((cpu >= 0) && (cpu < kMaxCpus)) {
+                        entry.cpus[cpu / 64] |= ::mystic::types::uint64_t(1) << (cpu % 64);
+                        ++entry.cpu_count;
+                    }
+                });
+            }
+
+            // "Node 0 MemTotal:       32768000 kB"
+            node_path(path, node, "meminfo");
+            if (read_file(path, text, sizeof(text))) {
+                const ::std::string_view info(text);
+                const auto found = info.find("MemTotal:");
+                if (found != ::std::string_view::npos) {
+                    const char* cursor = text + found + 9;
+                    while (*cursor == ' ') {
+                        ++cursor;
+                    }
+                    ::mystic::types::size_t kilobytes = 0;
+                    while ((*cursor >= '0') && (*cursor <= '9')) {
+                        kilobytes = kilobytes * 10 + static_cast<::mystic::types::size_t>(*cursor++ - '0');
+                    }
+                    nodes_[node].memory = kilobytes * 1024;
+                }
+            }
+        }
+    }
+#else
+    void load() noexcept {
+        load_single_node();
+    }
+#endif
+
+    Node nodes_[kMaxNodes];
+    int node_count_ = 0;
+    int max_node_ = 0;
+};
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+/**
+ * @namespace mystic::memory::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/// Memory policy modes, and flags (linux/mempolicy.h).
+constexpr inline int kMempolicyDefault = 0;
+constexpr inline int kMempolicyPreferred = 1;
+constexpr inline int kMempolicyBind = 2;
+constexpr inline unsigned kMempolicyMoveFlag = 1u << 1;
+
+/**
+ * @brief Node mask in the kernel's `unsigned long` array layout.
+ */
+struct NodeMask {
+    static constexpr int kBits = static_cast<int>(sizeof(unsigned long) * 8);
+    unsigned long words[(NumaTopology::kMaxNodes + kBits - 1) / kBits] = {};
+
+    explicit NodeMask(int node) noexcept {
+        words[node / kBits] = 1ul << (node % kBits);
+    }
+
+    /// The kernel reads `maxnode - 1` bits.
+    static constexpr unsigned long max_node() noexcept {
+        return NumaTopology::kMaxNodes + 1;
+    }
+};
+
+} // namespace internal
+#endif
+
+/* =============================================
+    Placement
+   --------------------------------------------- */
+
+/**
+ * @brief Returns the node the calling thread currently runs on (0 if unknown).
+ */
+inline int current_node() noexcept {
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX) && defined(SYS_getcpu)
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+        return static_cast<int>(node);
+    }
+#endif
+    return 0;
+}
+
+/**
+ * @brief Places a page aligned range on a node (moving pages already touched).
+ *
+ * @param data Page aligned start.
+ * @param size Range size.
+ * @param node Target node.
+ * @param strict Fail allocations instead of spilling to other nodes.
+ *
+ * @returns `OK` (also for node 0 on single node machines), `INVALID_ARGUMENT`
+ * for an unknown node, or `UNAVAILABLE` if the kernel refused.
+ */
+inline ::mystic::status::StatusCode bind_to_node(void* data, ::mystic::types::size_t size, int node,
+                                                 bool strict = false) noexcept {
+    const NumaTopology& topology = NumaTopology::system();
+    if (!topology.has_node(node)) {
+        return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+    }
+    if (!topology.is_numa()) {
+        return ::mystic::status::StatusCode::OK;
+    }
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX) && defined(SYS_mbind)
+    const internal::NodeMask mask(node);
+    const long result = ::syscall(SYS_mbind, data, static_cast<unsigned long>(size),
+                                  strict ? internal::kMempolicyBind : internal::kMempolicyPreferred,
+                                  mask.words, internal::NodeMask::max_node(), internal::kMempolicyMoveFlag);
+    return (result == 0) ? ::mystic::status::StatusCode::OK : ::mystic::status::StatusCode::UNAVAILABLE;
+#else
+    static_cast<void>(data);
+    static_cast<void>(size);
+    static_cast<void>(strict);
+    return ::mystic::status::StatusCode::UNAVAILABLE;
+#endif
+}
+
+/**
+ * @brief Makes the calling thread's future allocations prefer a node (-1 restores the default).
+ *
+ * @returns `OK`, `INVALID_ARGUMENT` for an unknown node, or `UNAVAILABLE`.
+ */
+inline ::mystic::status::StatusCode prefer_node(int node) noexcept {
+    const NumaTopology& topology = NumaTopology::system();
+    if ((node != -1) && !topology.has_node(node)) {
+        return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+    }
+    if (!topology.is_numa()) {
+        return ::mystic::status::StatusCode::OK;
+    }
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX) && defined(SYS_set_mempolicy)
+    long result = 0;
+    if (node == -1) {
+        result = ::syscall(SYS_set_mempolicy, internal::kMempolicyDefault, nullptr, 0ul);
+    } else {
+        const internal::NodeMask mask(node);
+        result = ::syscall(SYS_set_mempolicy, internal::kMempolicyPreferred, mask.words,
+                           internal::NodeMask::max_node());
+    }
+    return (result == 0) ? ::mystic::status::StatusCode::OK : ::mystic::status::StatusCode::UNAVAILABLE;
+#else
+    return ::mystic::status::StatusCode::UNAVAILABLE;
+#endif
+}
+
+/**
+ * @brief Restricts the calling thread to the CPUs of a node.
+ *
+ * @returns `OK` (a no-op on single node machines), `INVALID_ARGUMENT`
+ * for an unknown node, or `UNAVAILABLE` if the affinity could not be set.
+ */
+inline ::mystic::status::StatusCode pin_thread_to_node(int node) noexcept {
+    const NumaTopology& topology = NumaTopology::system();
+    if (!topology.has_node(node)) {
+        return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+    }
+    if (!topology.is_numa()) {
+        return ::mystic::status::StatusCode::OK;
+    }
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu = 0; (cpu < NumaTopology::kMaxCpus) && (cpu < CPU_SETSIZE); ++cpu) {
+        if (topology.node_has_cpu(node, cpu)) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    return (::sched_setaffinity(0, sizeof(set), &set) == 0) ? ::mystic::status::StatusCode::OK
+                                                             : ::mystic::status::StatusCode::UNAVAILABLE;
+#else
+    return ::mystic::status::StatusCode::UNAVAILABLE;
+#endif
+}
+
+/* =============================================
+    Memory Resource
+   --------------------------------------------- */
+
+/**
+ * @brief `std::pmr::memory_resource` placing every allocation on one node.
+ *
+ * @details
+ * On Linux each allocation is mapped as pages (see `page_allocator.hpp`),
+ * and bound with `mbind`; placement failures fall back to the default
+ * policy rather than failing. Elsewhere it forwards to
+ * `std::pmr::new_delete_resource()`. Use it as the upstream of `Arena`,
+ * or of `FixedPool::set_upstream()`; each allocation is a whole mapping,
+ * so chunk sizes should be a page or more.
+ *
+ * Huge pages are off by default. With a huge page policy, only requests
+ * of at least 2 MiB (or aligned past a normal page) use it; smaller ones
+ * still get normal pages, rather than being rounded up to 2 MiB.
+ */
+class NumaResource final : public ::std::pmr::memory_resource {
+public:
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+    explicit NumaResource(int node, HugePages policy = HugePages::NEVER) noexcept
+        : node_(node), policy_(policy) {}
+#else
+    explicit NumaResource(int node) noexcept
+        : node_(node) {}
+#endif
+
+    /**
+     * @brief Returns the target node.
+     */
+    int node() const noexcept {
+        return node_;
+    }
+
+private:
+    void* do_allocate(::mystic::types::size_t bytes, ::mystic::types::size_t alignment) override {
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+        const HugePages policy = policy_for(bytes, alignment);
+        if (alignment > internal::page_granule(policy)) {
+            internal::throw_bad_alloc();
+        }
+        const PageBlock block = allocate_pages((bytes != 0) ? bytes : 1, policy);
+        if (block.data == nullptr) {
+            internal::throw_bad_alloc();
+        }
+        bind_to_node(block.data, block.size, node_);
+        return block.data;
+#else
+        return ::std::pmr::new_delete_resource()->allocate(bytes, alignment);
+#endif
+    }
+
+    void do_deallocate(void* ptr, ::mystic::types::size_t bytes, ::mystic::types::size_t alignment) override {
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+        const ::mystic::types::size_t granule = internal::page_granule(policy_for(bytes, alignment));
+        free_pages(PageBlock{ptr, internal::round_up_pow2((bytes != 0) ? bytes : 1, granule), PageSize::SMALL});
+#else
+        ::std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+#endif
+    }
+
+    bool do_is_equal(const ::std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+    /// Huge pages only where they cannot waste most of a 2 MiB page.
+    HugePages policy_for(::mystic::types::size_t bytes, ::mystic::types::size_t alignment) const noexcept {
+        if ((bytes >= kHugePageSize) || (alignment > internal::small_page_size())) {
+            return policy_;
+        }
+        return HugePages::NEVER;
+    }
+#endif
+
+    int node_;
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+    HugePages policy_;
+#endif
+};
+
+} // namespace memory
+} // namespace mystic
@@ -0,0 +1,527 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/memory/page_allocator.hpp
+ * @file page_allocator.hpp
+ * @brief Defines a page-level allocator with huge page support (Linux).
+ *
+ * @details
+ * This header provides page granular memory straight from the kernel,
+ * backed by huge pages where possible to cut TLB misses on large tables.
+ * Explicit huge pages (`MAP_HUGETLB`) are tried first when asked for,
+ * then transparent huge pages (`madvise(MADV_HUGEPAGE)` on 2 MiB aligned
+ * regions), then normal pages. Every result reports which page size was
+ * actually obtained.
+ *
+ * This header file provides,
+ * 1. allocate_pages(), and free_pages(), for one-shot mappings.
+ * 2. PageReservation, which reserves address space, and commits it incrementally.
+ * 3. PageResource, a `std::pmr::memory_resource` (e.g. an `Arena` upstream).
+ *
+ * Only available on Linux (`MYSTIC_ARCH_OS_LINUX`); elsewhere the header is empty.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/memory/page_allocator.hpp"
+ *
+ * mystic::memory::PageReservation table;
+ * if (table.reserve(64ull << 30, mystic::memory::HugePages::TRANSPARENT) ==
+ *     mystic::status::StatusCode::OK) {
+ *     table.commit(256u << 20);
+ *     log("table backed by {}", table.page_size() == mystic::memory::PageSize::SMALL ? "4K" : "2M");
+ * }
+ *
+ * mystic::memory::PageResource pages(mystic::memory::HugePages::EXPLICIT);
+ * mystic::memory::Arena arena(2u << 20, &pages);
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "mystic/architecture/os_detection.hpp"
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+
+#include <memory_resource>
+#include <string_view>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "mystic/memory/upstream.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::memory
+ * @brief Memory allocation facilities.
+ */
+namespace memory {
+
+/**
+ * @brief Huge page request policy.
+ */
+enum class HugePages : ::mystic::types::uint8_t {
+    /// Normal pages only.
+    NEVER = 0,
+
+    /// Transparent huge pages, falling back to normal pages.
+    TRANSPARENT = 1,
+
+    /// Explicit (hugetlbfs pool) pages, falling back to transparent, then normal pages.
+    EXPLICIT = 2,
+};
+
+/**
+ * @brief Page size actually obtained.
+ */
+enum class PageSize : ::mystic::types::uint8_t {
+    /// Normal pages (4 KiB on common configurations).
+    SMALL = 0,
+
+    /// Transparent huge pages were enabled for the region.
+    HUGE_TRANSPARENT = 1,
+
+    /// Explicit huge pages back the region.
+    HUGE_EXPLICIT = 2,
+};
+
+/**
+ * @brief A page mapping, and the page size it got.
+ */
+struct PageBlock {
+    /// Start of the mapping, or null.
+    void* data = nullptr;
+
+    /// Size of the mapping (rounded to the page granule).
+    ::mystic::types::size_t size = 0;
+
+    /// Page size obtained.
+    PageSize page_size = PageSize::SMALL;
+};
+
+/// Huge page size assumed for alignment, and rounding (2 MiB, x86-64, and 4K granule Arm64).
+constexpr inline ::mystic::types::size_t kHugePageSize = ::mystic::types::size_t(2) << 20;
+
+/**
+ * @namespace mystic::memory::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/**
+ * @brief Rounds up to a power of two multiple.
+ */
+constexpr inline ::mystic::types::size_t round_up_pow2(::mystic::types::size_t value,
+                                                       ::mystic::types::size_t granule) noexcept {
+    return (value + granule - 1) & ~(granule - 1);
+}
+
+/**
+ * @brief Returns the normal page size.
+ */
+inline ::mystic::types::size_t small_page_size() noexcept {
+    static const ::mystic::types::size_t size = [] {
+        const long page = ::sysconf(_SC_PAGESIZE);
+        return (page > 0) ? static_cast<::mystic::types::size_t>(page) : ::mystic::types::size_t(4096);
+    }();
+    return size;
+}
+
+/**
+ * @brief Returns true if the kernel honours `MADV_HUGEPAGE` (THP mode `always`, or `madvise`).
+ */
+inline bool transparent_huge_pages_enabled() noexcept {
+    static const bool enabled = [] {
+        const int fd = ::open("/sys/kernel/mm/transparent_hugepage/enabled", O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return false;
+        }
+        char text[128] = {};
+        const ::ssize_t length = ::read(fd, text, sizeof(text) - 1);
+        ::close(fd);
+        if (length <= 0) {
+            return false;
+        }
+        // The active mode is bracketed, e.g. "always [madvise] never".
+        const ::std::string_view modes(text, static_cast<::mystic::types::size_t>(length));
+        return modes.find("[never]") == ::std::string_view::npos;
+    }();
+    return enabled;
+}
+
+/**
+ * @brief Maps `size` bytes aligned to `alignment`, trimming the excess.
+ */
+inline void* map_aligned(::mystic::types::size_t size, ::mystic::types::size_t alignment,
+                         int protection, int flags) noexcept {
+    const ::mystic::types::size_t padded = size + alignment;
+    void* raw = ::mmap(nullptr, padded, protection, flags, -1, 0);
+    if (raw == MAP_FAILED) {
+        return nullptr;
+    }
+
+    const ::mystic::types::uintptr_t start = reinterpret_cast<::mystic::types::uintptr_t>(raw);
+    const ::mystic::types::uintptr_t aligned = round_up_pow2(start, alignment);
+    const ::mystic::types::size_t head = aligned - start;
+    const ::mystic::types::size_t tail = padded - head - size;
+
+    if (head != 0) {
+        ::munmap(raw, head);
+    }
+    if (tail != 0) {
+        ::munmap(reinterpret_cast<void*>(aligned + size), tail);
+    }
+    return reinterpret_cast<void*>(aligned);
+}
+
+/**
+ * @brief Maps explicit huge pages, or returns null if the pool cannot supply them.
+ */
+inline void* map_explicit_huge(::mystic::types::size_t size) noexcept {
+#if defined(MAP_HUGETLB)
+    void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    return (data != MAP_FAILED) ? data : nullptr;
+#else
+    static_cast<void>(size);
+    return nullptr;
+#endif
+}
+
+/**
+ * @brief Asks for transparent huge pages on a 2 MiB aligned region.
+ */
+inline PageSize advise_huge(void* data, ::mystic::types::size_t size) noexcept {
+#if defined(MADV_HUGEPAGE)
+    if (transparent_huge_pages_enabled() && (::madvise(data, size, MADV_HUGEPAGE) == 0)) {
+        return PageSize::HUGE_TRANSPARENT;
+    }
+#else
+    static_cast<void>(data);
+    static_cast<void>(size);
+#endif
+    return PageSize::SMALL;
+}
+
+/**
+ * @brief Mapping granule for a policy.
+ */
+inline ::mystic::types::size_t page_granule(HugePages policy) noexcept {
+    return (policy == HugePages::NEVER) ? small_page_size() : kHugePageSize;
+}
+
+} // namespace internal
+
+/* =============================================
+    One-shot Mappings
+   --------------------------------------------- */
+
+/**
+ * @brief Maps zeroed, readable, and writable pages.
+ *
+ * @param size Requested size, rounded up to 2 MiB unless the policy is `NEVER`.
+ * @param policy Huge page policy.
+ *
+ * @returns The mapping (null data on failure), with the page size obtained.
+ */
+inline PageBlock allocate_pages(::mystic::types::size_t size, HugePages policy = HugePages::TRANSPARENT) noexcept {
+    PageBlock block;
+    if (size == 0) {
+        return block;
+    }
+
+    const ::mystic::types::size_t granule = internal::page_granule(policy);
+    if (size > static_cast<::mystic::types::size_t>(-1) - 2 * granule) {
+        return block;
+    }
+    block.size = internal::round_up_pow2(size, granule);
+
+    if (policy == HugePages::EXPLICIT) {
+        block.data = internal::map_explicit_huge(block.size);
+        if (block.data != nullptr) {
+            block.page_size = PageSize::HUGE_EXPLICIT;
+            return block;
+        }
+    }
+
+    if (policy == HugePages::NEVER) {
+        void* data = ::mmap(nullptr, block.size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        block.data = (data != MAP_FAILED) ? data : nullptr;
+    } else {
+        block.data = internal::map_aligned(block.size, kHugePageSize, PROT_READ | PROT_WRITE,
+                                           MAP_PRIVATE | MAP_ANONYMOUS);
+        if (block.data != nullptr) {
+            block.page_size = internal::advise_huge(block.data, block.size);
+        }
+    }
+
+    if (block.data == nullptr) {
+        block.size = 0;
+    }
+    return block;
+}
+
+/**
+ * @brief Unmaps pages from `allocate_pages()`.
+ */
+inline void free_pages(const PageBlock& block) noexcept {
+    if (block.data != nullptr) {
+        ::munmap(block.data, block.size);
+    }
+}
+
+/* =============================================
+    Reservations
+   --------------------------------------------- */
+
+/**
+ * @brief Reserved address range, committed on demand from the front.
+ *
+ * @details
+ * Reserving takes address space only; `commit()` makes a prefix usable.
+ * With the `EXPLICIT` policy the hugetlb pool is charged up front, so
+ * the whole range is committed at `reserve()` (or the reservation falls
+ * back to transparent huge pages).
+ */
+class PageReservation {
+public:
+    PageReservation() noexcept = default;
+
+    PageReservation(const PageReservation&) = delete;
+    PageReservation& operator=(const PageReservation&) = delete;
+
+    PageReservation(PageReservation&& other) noexcept
+        : data_(::std::exchange(other.data_, nullptr)), capacity_(::std::exchange(other.capacity_, 0)),
+          committed_(::std::exchange(other.committed_, 0)), granule_(other.granule_),
+          page_size_(other.page_size_) {}
+
+    PageReservation& operator=(PageReservation&& other) noexcept {
+        if (this != &other) {
+            release();
+            data_ = ::std::exchange(other.data_, nullptr);
+            capacity_ = ::std::exchange(other.capacity_, 0);
+            committed_ = ::std::exchange(other.committed_, 0);
+            granule_ = other.granule_;
+            page_size_ = other.page_size_;
+        }
+        return *this;
+    }
+
+    ~PageReservation() {
+        release();
+    }
+
+    /**
+     * @brief Reserves `capacity` bytes of address space.
+     *
+     * @returns `OK`, `FAILED_PRECONDITION` if already reserved, `INVALID_ARGUMENT`
+     * for a zero, or overflowing capacity, or `RESOURCE_EXHAUSTED` if mapping failed.
+     */
+    ::mystic::status::StatusCode reserve(::mystic::types::size_t capacity,
+                                         HugePages policy = HugePages::TRANSPARENT) noexcept {
+        if (data_ != nullptr) {
+            return ::mystic::status::StatusCode::FAILED_PRECONDITION;
+        }
+
+        granule_ = internal::page_granule(policy);
+        if ((capacity == 0) || (capacity > static_cast<::mystic::types::size_t>(-1) - 2 * granule_)) {
+            return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+        }
+        const ::mystic::types::size_t size = internal::round_up_pow2(capacity, granule_);
+
+        if (policy == HugePages::EXPLICIT) {
+            data_ = internal::map_explicit_huge(size);
+            if (data_ != nullptr) {
+                capacity_ = size;
+                committed_ = size;
+                page_size_ = PageSize::HUGE_EXPLICIT;
+                return ::mystic::status::StatusCode::OK;
+            }
+        }
+
+        data_ = internal::map_aligned(size, granule_, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE);
+        if (data_ == nullptr) {
+            return ::mystic::status::StatusCode::RESOURCE_EXHAUSTED;
+        }
+
+        capacity_ = size;
+        committed_ = 0;
+        page_size_ = (policy == HugePages::NEVER) ? PageSize::SMALL : internal::advise_huge(data_, size);
+        return ::mystic::status::StatusCode::OK;
+    }
+
+    /**
+     * @brief Makes the first `size` bytes usable (rounded up to the granule).
+     *
+     * @returns `OK`, `FAILED_PRECONDITION` if nothing is reserved, `OUT_OF_RANGE`
+     * past the capacity, or `RESOURCE_EXHAUSTED` if the kernel refused.
+     */
+    ::mystic::status::StatusCode commit(::mystic::types::size_t size) noexcept {
+        if (data_ == nullptr) {
+            return ::mystic::status::StatusCode::FAILED_PRECONDITION;
+        }
+        if (size > capacity_) {
+            return ::mystic::status::StatusCode::OUT_OF_RANGE;
+        }
+        if (size <= committed_) {
+            return ::mystic::status::StatusCode::OK;
+        }
+
+        const ::mystic::types::size_t target = internal::round_up_pow2(size, granule_);
+        if (::mprotect(static_cast<char*>(data_) + committed_, target - committed_, PROT_READ | PROT_WRITE) != 0) {
+            return ::mystic::status::StatusCode::RESOURCE_EXHAUSTED;
+        }
+        committed_ = target;
+        return ::mystic::status::StatusCode::OK;
+    }
+
+    /**
+     * @brief Returns committed memory past `size` to the kernel, keeping the reservation.
+     */
+    void decommit(::mystic::types::size_t size) noexcept {
+        if ((data_ == nullptr) || (page_size_ == PageSize::HUGE_EXPLICIT)) {
+            return;
+        }
+
+        const ::mystic::types::size_t keep = internal::round_up_pow2(size, granule_);
+        if (keep >= committed_) {
+            return;
+        }
+
+        char* start = static_cast<char*>(data_) + keep;
+        ::madvise(start, committed_ - keep, MADV_DONTNEED);
+        ::mprotect(start, committed_ - keep, PROT_NONE);
+        committed_ = keep;
+    }
+
+    /**
+     * @brief Unmaps the whole reservation.
+     */
+    void release() noexcept {
+        if (data_ != nullptr) {
+            ::munmap(data_, capacity_);
+        }
+        data_ = nullptr;
+        capacity_ = 0;
+        committed_ = 0;
+    }
+
+    /**
+     * @brief Returns the start of the reservation.
+     */
+    void* data() const noexcept {
+        return data_;
+    }
+
+    /**
+     * @brief Returns the reserved size.
+     */
+    ::mystic::types::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    /**
+     * @brief Returns the usable (committed) prefix size.
+     */
+    ::mystic::types::size_t committed() const noexcept {
+        return committed_;
+    }
+
+    /**
+     * @brief Returns the page size obtained.
+     */
+    PageSize page_size() const noexcept {
+        return page_size_;
+    }
+
+private:
+    void* data_ = nullptr;
+    ::mystic::types::size_t capacity_ = 0;
+    ::mystic::types::size_t committed_ = 0;
+    ::mystic::types::size_t granule_ = 0;
+    PageSize page_size_ = PageSize::SMALL;
+};
+
+/* =============================================
+    Memory Resource
+   --------------------------------------------- */
+
+/**
+ * @brief `std::pmr::memory_resource` mapping each allocation as pages.
+ *
+ * @details
+ * Meant as the upstream of chunked allocators (`Arena`, pools, tables)
+ * with chunk sizes of a huge page, or more. Allocation failure throws
+ * `std::bad_alloc` (abort without exceptions), as the interface requires.
+ */
+class PageResource final : public ::std::pmr::memory_resource {
+public:
+    explicit PageResource(HugePages policy = HugePages::TRANSPARENT) noexcept
+        : policy_(policy) {}
+
+    /**
+     * @brief Returns the page size of the most recent allocation.
+     */
+    PageSize last_page_size() const noexcept {
+        return last_page_size_;
+    }
+
+private:
+    void* do_allocate(::mystic::types::size_t bytes, ::mystic::types::size_t alignment) override {
+        if (alignment > internal::page_granule(policy_)) {
+            internal::throw_bad_alloc();
+        }
+
+        const PageBlock block = allocate_pages((bytes != 0) ? bytes : 1, policy_);
+        if (block.data == nullptr) {
+            internal::throw_bad_alloc();
+        }
+        last_page_size_ = block.page_size;
+        return block.data;
+    }
+
+    void do_deallocate(void* ptr, ::mystic::types::size_t bytes, ::mystic::types::size_t) override {
+        const ::mystic::types::size_t granule = internal::page_granule(policy_);
+        ::munmap(ptr, internal::round_up_pow2((bytes != 0) ? bytes : 1, granule));
+    }
+
+    bool do_is_equal(const ::std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    HugePages policy_;
+    PageSize last_page_size_ = PageSize::SMALL;
+};
+
+} // namespace memory
+} // namespace mystic
+
+#endif // (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
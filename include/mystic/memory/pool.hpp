@@ -0,0 +1,485 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/memory/pool.hpp
+ * @file pool.hpp
+ * @brief Defines a fixed-size slab pool with thread-local caches.
+ *
+ * @details
+ * This header provides `mystic::memory::FixedPool`, a process-wide pool of
+ * equally sized slots, keyed by slot size, alignment, and a tag type.
+ *
+ * Each thread allocates from, and frees to, its own free list without
+ * synchronization. When a thread's list grows past `kLocalCapacity`, a
+ * batch of `kBatchSize` slots moves to a shared lock-free depot; an empty
+ * list is refilled with one batch from the depot, or carved from a slab.
+ * Slabs are never returned upstream, so slots stay valid for the life of
+ * the process.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/memory/pool.hpp"
+ *
+ * using EventPool = mystic::memory::FixedPool<sizeof(TraceEvent), alignof(TraceEvent)>;
+ *
+ * TraceEvent* event = EventPool::create<TraceEvent>(id, timestamp);
+ * // ... possibly on another thread
+ * EventPool::destroy(event);
+ *
+ * auto stats = EventPool::stats();
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <utility>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/attributes/noinline.hpp"
+#include "mystic/memory/upstream.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::memory
+ * @brief Memory allocation facilities.
+ */
+namespace memory {
+
+/**
+ * @brief Occupancy snapshot of a pool.
+ */
+struct PoolStats {
+    /// Bytes per slot.
+    ::mystic::types::size_t slot_size = 0;
+
+    /// Slots carved from slabs so far.
+    ::mystic::types::size_t capacity = 0;
+
+    /// Slots currently handed out.
+    ::mystic::types::size_t in_use = 0;
+
+    /// Free slots parked in the shared depot.
+    ::mystic::types::size_t depot = 0;
+
+    /// Bytes obtained from upstream.
+    ::mystic::types::size_t slab_bytes = 0;
+};
+
+/**
+ * @namespace mystic::memory::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/**
+ * @brief Free slot, linked into a thread list, and (as a batch head) into the depot.
+ */
+struct PoolNode {
+    PoolNode* next;
+    ::std::atomic<PoolNode*> next_batch;
+};
+
+/**
+ * @brief Lock-free stack of free slot batches.
+ *
+ * @details
+ * The head packs a pointer with a modification tag in the unused upper
+ * bits, which protects pops against ABA. Reading a batch that a racing
+ * thread already took is harmless, since slab memory is never unmapped.
+ */
+class PoolDepot {
+public:
+    /**
+     * @brief Pushes a linked batch of `count` slots.
+     */
+    void push(PoolNode* batch, ::mystic::types::size_t count) noexcept {
+        ::mystic::types::uint64_t old_head = head_.load(::std::memory_order_relaxed);
+        ::mystic::types::uint64_t new_head = 0;
+        do {
+            batch->next_batch.store(unpack(old_head), ::std::memory_order_relaxed);
+            new_head = pack(batch, tag(old_head) + 1);
+        } while (!head_.compare_exchange_weak(old_head, new_head, ::std::memory_order_release,
+                                              ::std::memory_order_relaxed));
+        slots_.fetch_add(count, ::std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Pops one batch, or returns null if the depot is empty.
+     */
+    PoolNode* pop() noexcept {
+        ::mystic::types::uint64_t old_head = head_.load(::std::memory_order_acquire);
+        for (;;) {
+            PoolNode* top = unpack(old_head);
+            if (top == nullptr) {
+                return nullptr;
+            }
+            PoolNode* next = top->next_batch.load(::std::memory_order_relaxed);
+            if (head_.compare_exchange_weak(old_head, pack(next, tag(old_head) + 1),
+                                            ::std::memory_order_acquire, ::std::memory_order_acquire)) {
+                return top;
+            }
+        }
+    }
+
+    /**
+     * @brief Accounts for slots taken out by `pop()`.
+     */
+    void release_slots(::mystic::types::size_t count) noexcept {
+        slots_.fetch_sub(count, ::std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the number of free slots in the depot.
+     */
+    ::mystic::types::size_t slots() const noexcept {
+        return slots_.load(::std::memory_order_relaxed);
+    }
+
+private:
+    /// 48 address bits on 64-bit targets (x86-64, and Arm64 user space), all on 32-bit.
+    static constexpr unsigned kPointerBits = (sizeof(void*) == 8) ? 48 : 32;
+    static constexpr ::mystic::types::uint64_t kPointerMask =
+        (::mystic::types::uint64_t(1) << kPointerBits) - 1;
+
+    static ::mystic::types::uint64_t pack(PoolNode* node, ::mystic::types::uint64_t tag) noexcept {
+        return (tag << kPointerBits) |
+               static_cast<::mystic::types::uint64_t>(reinterpret_cast<::mystic::types::uintptr_t>(node));
+    }
+
+    static PoolNode* unpack(::mystic::types::uint64_t head) noexcept {
+        return reinterpret_cast<PoolNode*>(static_cast<::mystic::types::uintptr_t>(head & kPointerMask));
+    }
+
+    static ::mystic::types::uint64_t tag(::mystic::types::uint64_t head) noexcept {
+        return head >> kPointerBits;
+    }
+
+    alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) ::std::atomic<::mystic::types::uint64_t> head_{0};
+    ::std::atomic<::mystic::types::size_t> slots_{0};
+};
+
+} // namespace internal
+
+/**
+ * @brief Process-wide pool of fixed-size slots with thread-local caches.
+ *
+ * @tparam Size Slot payload size.
+ * @tparam Alignment Slot alignment (a power of two).
+ * @tparam Tag Distinguishes pools of equal geometry.
+ */
+template <::mystic::types::size_t Size,
+          ::mystic::types::size_t Alignment = alignof(::mystic::types::max_align_t),
+          typename Tag = void>
+class FixedPool {
+    static_assert((Alignment != 0) && ((Alignment & (Alignment - 1)) == 0),
+                  "Alignment must be a power of two.");
+
+    using Node = internal::PoolNode;
+
+public:
+    /// Bytes per slot (at least a free list node, and a multiple of the alignment).
+    static constexpr ::mystic::types::size_t kSlotSize =
+        (((Size > sizeof(Node)) ? Size : sizeof(Node)) + Alignment - 1) & ~(Alignment - 1);
+
+    /// Slots moved between a thread cache, and the depot at once.
+    static constexpr ::mystic::types::size_t kBatchSize = 32;
+
+    /// Free slots a thread keeps before spilling a batch.
+    static constexpr ::mystic::types::size_t kLocalCapacity = 2 * kBatchSize;
+
+    /// Slots carved per slab (about 64 KiB, at least one batch).
+    static constexpr ::mystic::types::size_t kSlabSlots =
+        ((65536 / kSlotSize) > kBatchSize) ? (65536 / kSlotSize) : kBatchSize;
+
+    FixedPool() = delete;
+
+    /* =============================================
+        Allocation
+       --------------------------------------------- */
+
+    /**
+     * @brief Allocates one slot.
+     *
+     * @returns The slot, or null if upstream allocation failed.
+     */
+    static void* allocate() noexcept {
+        LocalCache& cache = local();
+        Node* node = cache.head;
+        if (node == nullptr) {
+            node = refill(cache);
+            if (node == nullptr) {
+                return nullptr;
+            }
+        }
+
+        cache.head = node->next;
+        --cache.count;
+        bump(cache.allocations);
+        return node;
+    }
+
+    /**
+     * @brief Returns a slot (from any thread).
+     */
+    static void deallocate(void* ptr) noexcept {
+        if (ptr == nullptr) {
+            return;
+        }
+
+        LocalCache& cache = local();
+        Node* node = static_cast<Node*>(ptr);
+        node->next = cache.head;
+        cache.head = node;
+        bump(cache.deallocations);
+
+        if (++cache.count > kLocalCapacity) {
+            spill(cache);
+        }
+    }
+
+    /**
+     * @brief Allocates a slot, and constructs an object in it.
+     *
+     * @returns The object, or null if allocation failed.
+     */
+    template <typename Type, typename... Args>
+    static Type* create(Args&&... args) {
+        static_assert((sizeof(Type) <= kSlotSize) && (alignof(Type) <= Alignment),
+                      "Type does not fit the pool slot.");
+        void* slot = allocate();
+        return (slot != nullptr) ? ::new (slot) Type(::std::forward<Args>(args)...) : nullptr;
+    }
+
+    /**
+     * @brief Destroys an object made by `create()`, and frees its slot.
+     */
+    template <typename Type>
+    static void destroy(Type* object) noexcept {
+        if (object != nullptr) {
+            object->~Type();
+            deallocate(object);
+        }
+    }
+
+    /* =============================================
+        Configuration, and Stats
+       --------------------------------------------- */
+
+    /**
+     * @brief Sets the source of future slabs (null for `std::malloc`).
+     *
+     * @details
+     * Slabs are never returned, so the resource must outlive all use of the pool.
+     */
+    static void set_upstream(::std::pmr::memory_resource* upstream) noexcept {
+        ::std::lock_guard<::std::mutex> guard(shared_.lock);
+        shared_.upstream = upstream;
+    }
+
+    /**
+     * @brief Returns an occupancy snapshot.
+     *
+     * @details
+     * Takes the pool lock, and sums per-thread counters, so it is meant
+     * for monitoring, not hot paths.
+     */
+    static PoolStats stats() noexcept {
+        ::std::lock_guard<::std::mutex> guard(shared_.lock);
+
+        ::mystic::types::uint64_t allocations = shared_.retired_allocations;
+        ::mystic::types::uint64_t deallocations = shared_.retired_deallocations;
+        for (LocalCache* cache = shared_.threads; cache != nullptr; cache = cache->next_thread) {
+            allocations += cache->allocations.load(::std::memory_order_relaxed);
+            deallocations += cache->deallocations.load(::std::memory_order_relaxed);
+        }
+
+        PoolStats stats;
+        stats.slot_size = kSlotSize;
+        stats.capacity = shared_.capacity;
+        stats.in_use = static_cast<::mystic::types::size_t>(allocations - deallocations);
+        stats.depot = shared_.depot.slots();
+        stats.slab_bytes = shared_.slab_bytes;
+        return stats;
+    }
+
+private:
+    /**
+     * @brief Per-thread free list, and counters (written by the owner only).
+     */
+    struct LocalCache {
+        Node* head = nullptr;
+        ::mystic::types::size_t count = 0;
+        ::std::atomic<::mystic::types::uint64_t> allocations{0};
+        ::std::atomic<::mystic::types::uint64_t> deallocations{0};
+        LocalCache* prev_thread = nullptr;
+        LocalCache* next_thread = nullptr;
+
+        LocalCache() noexcept {
+            ::std::lock_guard<::std::mutex> guard(shared_.lock);
+            next_thread = shared_.threads;
+            if (next_thread != nullptr) {
+                next_thread->prev_thread = this;
+            }
+            shared_.threads = this;
+        }
+
+        ~LocalCache() {
+            if (head != nullptr) {
+                shared_.depot.push(head, count);
+            }
+
+            ::std::lock_guard<::std::mutex> guard(shared_.lock);
+            shared_.retired_allocations += allocations.load(::std::memory_order_relaxed);
+            shared_.retired_deallocations += deallocations.load(::std::memory_order_relaxed);
+            if (prev_thread != nullptr) {
+                prev_thread->next_thread = next_thread;
+            } else {
+                shared_.threads = next_thread;
+            }
+            if (next_thread != nullptr) {
+                next_thread->prev_thread = prev_thread;
+            }
+        }
+    };
+
+    /**
+     * @brief Pool-wide state.
+     */
+    struct Shared {
+        internal::PoolDepot depot;
+
+        alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) ::std::mutex lock;
+        char* slab_cursor = nullptr;
+        char* slab_end = nullptr;
+        void* slabs = nullptr;
+        ::mystic::types::size_t capacity = 0;
+        ::mystic::types::size_t slab_bytes = 0;
+        ::std::pmr::memory_resource* upstream = nullptr;
+        LocalCache* threads = nullptr;
+        ::mystic::types::uint64_t retired_allocations = 0;
+        ::mystic::types::uint64_t retired_deallocations = 0;
+    };
+
+    static LocalCache& local() noexcept {
+        thread_local LocalCache cache;
+        return cache;
+    }
+
+    /**
+     * @brief Single-writer counter increment (no locked instruction).
+     */
+    static void bump(::std::atomic<::mystic::types::uint64_t>& counter) noexcept {
+        counter.store(counter.load(::std::memory_order_relaxed) + 1, ::std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Refills an empty thread list from the depot, or a slab.
+     */
+    MYSTIC_NOINLINE static Node* refill(LocalCache& cache) noexcept {
+        Node* batch = shared_.depot.pop();
+        if (batch != nullptr) {
+            ::mystic::types::size_t count = 0;
+            for (Node* node = batch; node != nullptr; node = node->next) {
+                ++count;
+            }
+            shared_.depot.release_slots(count);
+            cache.head = batch;
+            cache.count = count;
+            return batch;
+        }
+
+        ::std::lock_guard<::std::mutex> guard(shared_.lock);
+        if (static_cast<::mystic::types::size_t>(shared_.slab_end - shared_.slab_cursor) <
+            kBatchSize * kSlotSize) {
+            if (!grow()) {
+                return nullptr;
+            }
+        }
+
+        // Link one batch of fresh slots.
+        char* first = shared_.slab_cursor;
+        for (::mystic::types::size_t i = 0; i < kBatchSize; ++i) {
+            Node* node = reinterpret_cast<Node*>(first + i * kSlotSize);
+            node->next = (i + 1 < kBatchSize) ? reinterpret_cast<Node*>(first + (i + 1) * kSlotSize)
+                                              : nullptr;
+        }
+        shared_.slab_cursor += kBatchSize * kSlotSize;
+        shared_.capacity += kBatchSize;
+
+        cache.head = reinterpret_cast<Node*>(first);
+        cache.count = kBatchSize;
+        return cache.head;
+    }
+
+    /**
+     * @brief Gets a new slab from upstream, lock must be held.
+     */
+    static bool grow() noexcept {
+        // Link word, then slots aligned up from it.
+        constexpr ::mystic::types::size_t kBytes = sizeof(void*) + Alignment + kSlabSlots * kSlotSize;
+
+        void* raw = internal::upstream_allocate(shared_.upstream, kBytes);
+        if (raw == nullptr) {
+            return false;
+        }
+        *static_cast<void**>(raw) = shared_.slabs;
+        shared_.slabs = raw;
+        shared_.slab_bytes += kBytes;
+
+        const ::mystic::types::uintptr_t start =
+            (reinterpret_cast<::mystic::types::uintptr_t>(raw) + sizeof(void*) + Alignment - 1) & ~(Alignment - 1);
+        shared_.slab_cursor = reinterpret_cast<char*>(start);
+        shared_.slab_end = shared_.slab_cursor + kSlabSlots * kSlotSize;
+        return true;
+    }
+
+    /**
+     * @brief Moves one batch from an overflowing thread list to the depot.
+     */
+    MYSTIC_NOINLINE static void spill(LocalCache& cache) noexcept {
+        Node* batch = cache.head;
+        Node* last = batch;
+        for (::mystic::types::size_t i = 1; i < kBatchSize; ++i) {
+            last = last->next;
+        }
+
+        cache.head = last->next;
+        cache.count -= kBatchSize;
+        last->next = nullptr;
+        shared_.depot.push(batch, kBatchSize);
+    }
+
+    static inline Shared shared_{};
+};
+
+} // namespace memory
+} // namespace mystic
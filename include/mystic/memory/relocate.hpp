@@ -0,0 +1,152 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/memory/relocate.hpp
+ * @file relocate.hpp
+ * @brief Defines object relocation helpers for containers.
+ *
+ * @details
+ * Relocation moves objects to new storage, and ends the lifetime of the
+ * originals. Trivially relocatable types move with one `memcpy`, or
+ * `memmove`; others are move constructed (copied when the move may
+ * throw, and a copy exists), and destroyed.
+ *
+ * Shifting in place cannot be rolled back, so `shift_right()`, and
+ * `shift_left()` only accept types that relocate without throwing.
+ *
+ * This header file provides,
+ * 1. relocate_n(), into uninitialized, non-overlapping storage.
+ * 2. shift_right(), and shift_left(), to open, and close gaps in place.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/memory/relocate.hpp"
+ *
+ * Widget* grown = static_cast<Widget*>(::operator new(2 * capacity * sizeof(Widget)));
+ * mystic::memory::relocate_n(old_data, size, grown);
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "mystic/traits/is_trivially_relocatable.hpp"
+#include "mystic/types/standard_def.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::memory
+ * @brief Memory allocation facilities.
+ */
+namespace memory {
+
+/**
+ * @brief Relocates `count` objects into uninitialized, non-overlapping storage.
+ *
+ * @details
+ * If construction throws, nothing is left constructed at `dest`, and
+ * every source is still alive, and destructible. Sources are unchanged
+ * when they are copied; a move-only type with a throwing move may have
+ * had some of them moved from.
+ */
+template <typename Type>
+inline void relocate_n(Type* first, ::mystic::types::size_t count, Type* dest) {
+    if constexpr (::mystic::traits::is_trivially_relocatable_v<Type>) {
+        if (count != 0) {
+            ::std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), count * sizeof(Type));
+        }
+    } else {
+        if constexpr (::std::is_nothrow_move_constructible_v<Type> || !::std::is_copy_constructible_v<Type>) {
+            ::std::uninitialized_move_n(first, count, dest);
+        } else {
+            ::std::uninitialized_copy_n(first, count, dest);
+        }
+        ::std::destroy_n(first, count);
+    }
+}
+
+/**
+ * @brief True if `Type` relocates without throwing, as in-place shifts require.
+ */
+template <typename Type>
+constexpr inline bool is_nothrow_relocatable_v =
+    ::mystic::traits::is_trivially_relocatable_v<Type> || ::std::is_nothrow_move_constructible_v<Type>;
+
+/**
+ * @brief Shifts `[pos, end)` right by `gap`, leaving `[pos, pos + gap)` uninitialized.
+ *
+ * @details
+ * `[end, end + gap)` must be uninitialized storage. Trivially relocatable
+ * types use one `memmove`.
+ */
+template <typename Type>
+inline void shift_right(Type* pos, Type* end, ::mystic::types::size_t gap) noexcept {
+    static_assert(is_nothrow_relocatable_v<Type>,
+                  "shift_right cannot roll back a throwing move; Type must be nothrow move constructible");
+    if constexpr (::mystic::traits::is_trivially_relocatable_v<Type>) {
+        if (pos != end) {
+            ::std::memmove(static_cast<void*>(pos + gap), static_cast<const void*>(pos),
+                           static_cast<::mystic::types::size_t>(end - pos) * sizeof(Type));
+        }
+    } else {
+        for (Type* it = end; it != pos;) {
+            --it;
+            ::new (static_cast<void*>(it + gap)) Type(::std::move(*it));
+            it->~Type();
+        }
+    }
+}
+
+/**
+ * @brief Shifts `[pos + gap, end)` left by `gap`; `[pos, pos + gap)` must hold no live objects.
+ *
+ * @details
+ * Leaves `[end - gap, end)` uninitialized.
+ */
+template <typename Type>
+inline void shift_left(Type* pos, Type* end, ::mystic::types::size_t gap) noexcept {
+    static_assert(is_nothrow_relocatable_v<Type>,
+                  "shift_left cannot roll back a throwing move; Type must be nothrow move constructible");
+    if constexpr (::mystic::traits::is_trivially_relocatable_v<Type>) {
+        if (pos + gap != end) {
+            ::std::memmove(static_cast<void*>(pos), static_cast<const void*>(pos + gap),
+                           static_cast<::mystic::types::size_t>(end - pos - gap) * sizeof(Type));
+        }
+    } else {
+        for (Type* it = pos + gap; it != end; ++it) {
+            ::new (static_cast<void*>(it - gap)) Type(::std::move(*it));
+            it->~Type();
+        }
+    }
+}
+
+} // namespace memory
+} // namespace mystic
@@ -0,0 +1,410 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/memory/tracking_resource.hpp
+ * @file tracking_resource.hpp
+ * @brief Defines a memory resource attributing allocations to tags.
+ *
+ * @details
+ * `TrackingResource` wraps an upstream `std::pmr::memory_resource`, and
+ * counts bytes, and allocations against a tag. Tags are types with a
+ * `kName`, interned once into a small id; equal names share an id.
+ *
+ * Counters live per thread, and are written by their owner only, so the
+ * hot path is a handful of plain stores with no locked instruction. One
+ * in N allocations may additionally record its call stack; sampling is
+ * off by default, and costs one relaxed load when off.
+ *
+ * This header file provides,
+ * 1. tracking_tag_id<Tag>(), the interned id of a tag.
+ * 2. TrackingResource, the counting resource.
+ * 3. tracking_snapshot(), tracking_samples(), and set_tracking_sample_rate(),
+ *    for profilers.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/memory/tracking_resource.hpp"
+ *
+ * struct RendererTag {
+ *     static constexpr std::string_view kName = "renderer";
+ * };
+ *
+ * mystic::memory::TrackingResource renderer(mystic::memory::tracking_tag_id<RendererTag>());
+ * std::pmr::vector<int> vertices(&renderer);
+ * vertices.resize(1024);
+ *
+ * mystic::memory::set_tracking_sample_rate(1000);
+ * const mystic::memory::TrackingSnapshot snapshot = mystic::memory::tracking_snapshot();
+ * for (mystic::types::size_t i = 0; i < snapshot.tag_count; ++i) {
+ *     std::printf("%s: %llu live bytes\n", snapshot.tags[i].name.data(),
+ *                 static_cast<unsigned long long>(snapshot.tags[i].live_bytes()));
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <memory_resource>
+#include <mutex>
+#include <string_view>
+
+#if defined(__has_include)
+# if __has_include(<execinfo.h>)
+#  include <execinfo.h>
+#  define MYSTIC_MEMORY_HAS_BACKTRACE 1
+# endif
+#endif
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/attributes/forceinline.hpp"
+#include "mystic/attributes/noinline.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::memory
+ * @brief Memory allocation facilities.
+ */
+namespace memory {
+
+/// Interned tag id; 0 is the "other" tag that also absorbs overflow.
+using TrackingTagId = ::mystic::types::uint16_t;
+
+/// Maximum number of distinct tags, including "other".
+constexpr inline ::mystic::types::size_t kMaxTrackingTags = 64;
+
+/// Maximum frames kept per sampled call stack.
+constexpr inline ::mystic::types::size_t kMaxSampleFrames = 16;
+
+/// Number of most recent samples kept.
+constexpr inline ::mystic::types::size_t kMaxTrackingSamples = 256;
+
+/**
+ * @brief Totals of one tag.
+ */
+struct TagStats {
+    ::std::string_view name;
+    ::mystic::types::uint64_t allocated_bytes = 0;
+    ::mystic::types::uint64_t freed_bytes = 0;
+    ::mystic::types::uint64_t allocations = 0;
+    ::mystic::types::uint64_t deallocations = 0;
+
+    /**
+     * @brief Returns the bytes currently allocated.
+     */
+    ::mystic::types::uint64_t live_bytes() const noexcept {
+        return allocated_bytes - freed_bytes;
+    }
+};
+
+/**
+ * @brief Totals of every interned tag, indexed by id.
+ */
+struct TrackingSnapshot {
+    TagStats tags[kMaxTrackingTags];
+    ::mystic::types::size_t tag_count = 0;
+};
+
+/**
+ * @brief One sampled allocation.
+ */
+struct AllocationSample {
+    TrackingTagId tag = 0;
+    ::mystic::types::size_t size = 0;
+    ::mystic::types::size_t depth = 0;
+    void* frames[kMaxSampleFrames] = {};
+};
+
+/**
+ * @namespace mystic::memory::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+struct TrackingLocal;
+
+/**
+ * @brief Process-wide tag names, retired counters, and samples.
+ */
+struct TrackingRegistry {
+    ::std::mutex lock;
+    ::std::string_view names[kMaxTrackingTags] = {"other"};
+    ::mystic::types::size_t tag_count = 1;
+    TagStats retired[kMaxTrackingTags];
+    TrackingLocal* threads = nullptr;
+
+    alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) ::std::atomic<::mystic::types::uint32_t> sample_rate{0};
+
+    ::std::mutex sample_lock;
+    AllocationSample samples[kMaxTrackingSamples];
+    ::mystic::types::uint64_t sample_count = 0;
+
+    /**
+     * @brief Returns the id of a name, adding it if new.
+     */
+    TrackingTagId intern(::std::string_view name) noexcept {
+        ::std::lock_guard<::std::mutex> guard(lock);
+        for (::mystic::types::size_t id = 0; id < tag_count; ++id) {
+            if (names[id] == name) {
+                return static_cast<TrackingTagId>(id);
+            }
+        }
+        if (tag_count == kMaxTrackingTags) {
+            return 0;
+        }
+        names[tag_count] = name;
+        return static_cast<TrackingTagId>(tag_count++);
+    }
+};
+
+inline TrackingRegistry tracking_registry{};
+
+/**
+ * @brief Per-thread counters (written by the owner only).
+ */
+struct TrackingLocal {
+    struct Counters {
+        ::std::atomic<::mystic::types::uint64_t> allocated_bytes{0};
+        ::std::atomic<::mystic::types::uint64_t> freed_bytes{0};
+        ::std::atomic<::mystic::types::uint64_t> allocations{0};
+        ::std::atomic<::mystic::types::uint64_t> deallocations{0};
+    };
+
+    Counters tags[kMaxTrackingTags];
+    ::mystic::types::uint32_t since_sample = 0;
+    TrackingLocal* prev_thread = nullptr;
+    TrackingLocal* next_thread = nullptr;
+
+    TrackingLocal() noexcept {
+        ::std::lock_guard<::std::mutex> guard(tracking_registry.lock);
+        next_thread = tracking_registry.threads;
+        if (next_thread != nullptr) {
+            next_thread->prev_thread = this;
+        }
+        tracking_registry.threads = this;
+    }
+
+    ~TrackingLocal() {
+        ::std::lock_guard<::std::mutex> guard(tracking_registry.lock);
+        for (::mystic::types::size_t id = 0; id < kMaxTrackingTags; ++id) {
+            TagStats& retired = tracking_registry.retired[id];
+            retired.allocated_bytes += tags[id].allocated_bytes.load(::std::memory_order_relaxed);
+            retired.freed_bytes += tags[id].freed_bytes.load(::std::memory_order_relaxed);
+            retired.allocations += tags[id].allocations.load(::std::memory_order_relaxed);
+            retired.deallocations += tags[id].deallocations.load(::std::memory_order_relaxed);
+        }
+        if (prev_thread != nullptr) {
+            prev_thread->next_thread = next_thread;
+        } else {
+            tracking_registry.threads = next_thread;
+        }
+        if (next_thread != nullptr) {
+            next_thread->prev_thread = prev_thread;
+        }
+    }
+};
+
+inline TrackingLocal& tracking_local() noexcept {
+    thread_local TrackingLocal local;
+    return local;
+}
+
+/**
+ * @brief Single-writer counter increment (no locked instruction).
+ */
+MYSTIC_FORCEINLINE inline void tracking_add(::std::atomic<::mystic::types::uint64_t>& counter,
+                                            ::mystic::types::uint64_t value) noexcept {
+    counter.store(counter.load(::std::memory_order_relaxed) + value, ::std::memory_order_relaxed);
+}
+
+/**
+ * @brief Records the calling stack of a sampled allocation.
+ */
+MYSTIC_NOINLINE inline void tracking_sample(TrackingTagId tag, ::mystic::types::size_t size) noexcept {
+    AllocationSample sample;
+    sample.tag = tag;
+    sample.size = size;
+#if defined(MYSTIC_MEMORY_HAS_BACKTRACE)
+    const int depth = ::backtrace(sample.frames, static_cast<int>(kMaxSampleFrames));
+    sample.depth = (depth > 0) ? static_cast<::mystic::types::size_t>(depth) : 0;
+#endif
+
+    ::std::lock_guard<::std::mutex> guard(tracking_registry.sample_lock);
+    tracking_registry.samples[tracking_registry.sample_count % kMaxTrackingSamples] = sample;
+    ++tracking_registry.sample_count;
+}
+
+} // namespace internal
+
+/* =============================================
+    Tags
+   --------------------------------------------- */
+
+/**
+ * @brief Returns the interned id of a tag type.
+ *
+ * @tparam Tag A type with a `static constexpr std::string_view kName`
+ * (or anything convertible to it) with static storage.
+ *
+ * @details
+ * Interning takes a lock once per tag; later calls are a static load.
+ * Tags past `kMaxTrackingTags` map to id 0 ("other").
+ */
+template <typename Tag>
+inline TrackingTagId tracking_tag_id() noexcept {
+    static const TrackingTagId id = internal::tracking_registry.intern(::std::string_view(Tag::kName));
+    return id;
+}
+
+/* =============================================
+    Tracking Resource
+   --------------------------------------------- */
+
+/**
+ * @brief `std::pmr::memory_resource` counting its traffic against a tag.
+ *
+ * @details
+ * Memory must be returned through a resource of the same tag for the
+ * live byte count to be meaningful.
+ */
+class TrackingResource final : public ::std::pmr::memory_resource {
+public:
+    explicit TrackingResource(TrackingTagId tag,
+                              ::std::pmr::memory_resource* upstream = ::std::pmr::get_default_resource()) noexcept
+        : tag_((tag < kMaxTrackingTags) ? tag : 0), upstream_(upstream) {}
+
+    /**
+     * @brief Returns the tag id.
+     */
+    TrackingTagId tag() const noexcept {
+        return tag_;
+    }
+
+    /**
+     * @brief Returns the wrapped resource.
+     */
+    ::std::pmr::memory_resource* upstream() const noexcept {
+        return upstream_;
+    }
+
+private:
+    void* do_allocate(::mystic::types::size_t bytes, ::mystic::types::size_t alignment) override {
+        void* ptr = upstream_->allocate(bytes, alignment);
+
+        internal::TrackingLocal& local = internal::tracking_local();
+        internal::TrackingLocal::Counters& counters = local.tags[tag_];
+        internal::tracking_add(counters.allocated_bytes, bytes);
+        internal::tracking_add(counters.allocations, 1);
+
+        const ::mystic::types::uint32_t rate =
+            internal::tracking_registry.sample_rate.load(::std::memory_order_relaxed);
+        if ((rate != 0) && (++local.since_sample >= rate)) {
+            local.since_sample = 0;
+            internal::tracking_sample(tag_, bytes);
+        }
+        return ptr;
+    }
+
+    void do_deallocate(void* ptr, ::mystic::types::size_t bytes, ::mystic::types::size_t alignment) override {
+        internal::TrackingLocal::Counters& counters = internal::tracking_local().tags[tag_];
+        internal::tracking_add(counters.freed_bytes, bytes);
+        internal::tracking_add(counters.deallocations, 1);
+        upstream_->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const ::std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    TrackingTagId tag_;
+    ::std::pmr::memory_resource* upstream_;
+};
+
+/* =============================================
+    Profiler Interface
+   --------------------------------------------- */
+
+/**
+ * @brief Samples the call stack of one in `rate` allocations per thread (0 disables).
+ */
+inline void set_tracking_sample_rate(::mystic::types::uint32_t rate) noexcept {
+    internal::tracking_registry.sample_rate.store(rate, ::std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the totals of every tag.
+ *
+ * @details
+ * Takes the registry lock, and sums per-thread counters, so it is meant
+ * for monitoring, not hot paths. Counters of running threads are read
+ * without stopping them, so tags may be momentarily inconsistent.
+ */
+inline TrackingSnapshot tracking_snapshot() noexcept {
+    internal::TrackingRegistry& registry = internal::tracking_registry;
+    ::std::lock_guard<::std::mutex> guard(registry.lock);
+
+    TrackingSnapshot snapshot;
+    snapshot.tag_count = registry.tag_count;
+    for (::mystic::types::size_t id = 0; id < registry.tag_count; ++id) {
+        TagStats& stats = snapshot.tags[id];
+        stats = registry.retired[id];
+        stats.name = registry.names[id];
+        for (internal::TrackingLocal* local = registry.threads; local != nullptr; local = local->next_thread) {
+            stats.allocated_bytes += local->tags[id].allocated_bytes.load(::std::memory_order_relaxed);
+            stats.freed_bytes += local->tags[id].freed_bytes.load(::std::memory_order_relaxed);
+            stats.allocations += local->tags[id].allocations.load(::std::memory_order_relaxed);
+            stats.deallocations += local->tags[id].deallocations.load(::std::memory_order_relaxed);
+        }
+    }
+    return snapshot;
+}
+
+/**
+ * @brief Copies the most recent samples, oldest first.
+ *
+ * @param out Destination.
+ * @param capacity Capacity of `out`.
+ *
+ * @returns The number of samples copied.
+ */
+inline ::mystic::types::size_t tracking_samples(AllocationSample* out, ::mystic::types::size_t capacity) noexcept {
+    internal::TrackingRegistry& registry = internal::tracking_registry;
+    ::std::lock_guard<::std::mutex> guard(registry.sample_lock);
+
+    const ::mystic::types::uint64_t kept =
+        (registry.sample_count < kMaxTrackingSamples) ? registry.sample_count : kMaxTrackingSamples;
+    const ::mystic::types::size_t count = (kept < capacity) ? static_cast<::mystic::types::size_t>(kept) : capacity;
+    const ::mystic::types::uint64_t first = registry.sample_count - count;
+    for (::mystic::types::size_t i = 0; i < count; ++i) {
+        out[i] = registry.samples[(first + i) % kMaxTrackingSamples];
+    }
+    return count;
+}
+
+} // namespace memory
+} // namespace mystic
@@ -0,0 +1,108 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/memory/upstream.hpp
+ * @file upstream.hpp
+ * @brief Defines helpers shared by the allocators for their backing memory.
+ *
+ * @details
+ * Allocators in `mystic::memory` take their backing memory from an optional
+ * `std::pmr::memory_resource`, falling back to `std::malloc` when none is
+ * given. This header holds the small helpers implementing that choice.
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+
+#include "mystic/types/standard_def.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::memory
+ * @brief Memory allocation facilities.
+ */
+namespace memory {
+
+/**
+ * @namespace mystic::memory::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/**
+ * @brief Reports allocation failure through a standard interface.
+ *
+ * @details
+ * `std::pmr::memory_resource` must not return null, so adapters throw
+ * `std::bad_alloc`, or abort when exceptions are disabled.
+ */
+[[noreturn]] inline void throw_bad_alloc() {
+#if defined(__cpp_exceptions)
+    throw ::std::bad_alloc();
+#else
+    ::std::abort();
+#endif
+}
+
+/**
+ * @brief Allocates raw bytes from an upstream resource, or malloc.
+ *
+ * @returns The block, or null on failure (a throwing upstream's exception is caught).
+ */
+inline void* upstream_allocate(::std::pmr::memory_resource* upstream, ::mystic::types::size_t size) noexcept {
+    if (upstream == nullptr) {
+        return ::std::malloc(size);
+    }
+#if defined(__cpp_exceptions)
+    try {
+#endif
+        return upstream->allocate(size, alignof(::mystic::types::max_align_t));
+#if defined(__cpp_exceptions)
+    } catch (...) {
+        return nullptr;
+    }
+#endif
+}
+
+/**
+ * @brief Returns raw bytes to an upstream resource, or malloc.
+ */
+inline void upstream_deallocate(::std::pmr::memory_resource* upstream, void* ptr,
+                                ::mystic::types::size_t size) noexcept {
+    if (upstream != nullptr) {
+        upstream->deallocate(ptr, size, alignof(::mystic::types::max_align_t));
+    } else {
+        ::std::free(ptr);
+    }
+}
+
+} // namespace internal
+
+} // namespace memory
+} // namespace mystic
@@ -0,0 +1,481 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/platform/mapped_file.hpp
+ * @file mapped_file.hpp
+ * @brief Defines memory mapped files with access pattern hints.
+ *
+ * @details
+ * `MappedFile` maps a whole file read-only, or read-write (shared, so
+ * stores reach the file), and hands it out as a byte span. Access hints
+ * map to `madvise()`, and `populate` pre-faults the mapping on Linux
+ * (`MAP_POPULATE`) so the first scan takes no page faults.
+ *
+ * For files larger than memory, `SequentialPrefetcher` issues
+ * `MADV_WILLNEED` a few windows ahead of a streaming scan, and can drop
+ * the pages already consumed.
+ *
+ * POSIX only (Linux, and macOS); the header is empty elsewhere.
+ *
+ * This header file provides,
+ * 1. MappedFile, with open(), create(), advise(), and sync().
+ * 2. SequentialPrefetcher, a chunked read-ahead helper.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/platform/mapped_file.hpp"
+ *
+ * mystic::platform::MappedFile file;
+ * if (file.open("events.log") != mystic::status::StatusCode::OK) {
+ *     return;
+ * }
+ * file.advise(mystic::platform::AccessHint::SEQUENTIAL);
+ *
+ * mystic::platform::SequentialPrefetcher prefetcher(file);
+ * const mystic::platform::ByteSpan bytes = file.bytes();
+ * for (std::size_t offset = 0; offset < bytes.size; offset += 4096) {
+ *     prefetcher.advance(offset);
+ *     // ... scan bytes.data + offset
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "mystic/architecture/os_detection.hpp"
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX) || (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_MACOS)
+
+#include <cerrno>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "mystic/status/status_code.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::platform
+ * @brief Operating system facilities.
+ */
+namespace platform {
+
+/**
+ * @brief Mapping access mode.
+ */
+enum class MapMode : ::mystic::types::uint8_t {
+    READ_ONLY,
+    READ_WRITE,
+};
+
+/**
+ * @brief Expected access pattern (`madvise()` advice).
+ */
+enum class AccessHint : ::mystic::types::uint8_t {
+    NORMAL,
+    SEQUENTIAL,
+    RANDOM,
+    WILLNEED,
+    DONTNEED,
+};
+
+/**
+ * @brief Mapped bytes.
+ */
+struct ByteSpan {
+    ::mystic::types::byte* data = nullptr;
+    ::mystic::types::size_t size = 0;
+};
+
+/**
+ * @namespace mystic::platform::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/**
+ * @brief Maps an `errno` value to a status code.
+ */
+inline ::mystic::status::StatusCode status_from_errno(int error) noexcept {
+    switch (error) {
+        case ENOENT:
+        case ENOTDIR:
+            return ::mystic::status::StatusCode::NOT_FOUND;
+        case EACCES:
+        case EPERM:
+        case EROFS:
+            return ::mystic::status::StatusCode::PERMISSION_DENIED;
+        case ENOMEM:
+        case EMFILE:
+        case ENFILE:
+        case ENOSPC:
+        case EFBIG:
+            return ::mystic::status::StatusCode::RESOURCE_EXHAUSTED;
+        case EINVAL:
+        case EISDIR:
+        case ENODEV:
+            return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+        default:
+            return ::mystic::status::StatusCode::INTERNAL;
+    }
+}
+
+/**
+ * @brief Returns the `madvise()` advice of a hint.
+ */
+constexpr inline int advice_of(AccessHint hint) noexcept {
+    switch (hint) {
+        case AccessHint::SEQUENTIAL:
+            return MADV_SEQUENTIAL;
+        case AccessHint::RANDOM:
+            return MADV_RANDOM;
+        case AccessHint::WILLNEED:
+            return MADV_WILLNEED;
+        case AccessHint::DONTNEED:
+            return MADV_DONTNEED;
+        default:
+            return MADV_NORMAL;
+    }
+}
+
+/**
+ * @brief Returns the normal page size.
+ */
+inline ::mystic::types::size_t page_size() noexcept {
+    static const ::mystic::types::size_t size = [] {
+        const long page = ::sysconf(_SC_PAGESIZE);
+        return (page > 0) ? static_cast<::mystic::types::size_t>(page) : ::mystic::types::size_t(4096);
+    }();
+    return size;
+}
+
+} // namespace internal
+
+/* =============================================
+    Mapped File
+   --------------------------------------------- */
+
+/**
+ * @brief Whole-file memory mapping.
+ *
+ * @details
+ * Empty files open successfully with a null span. The mapping stays
+ * valid after the descriptor is closed, and is unmapped on destruction.
+ */
+class MappedFile {
+public:
+    MappedFile() noexcept = default;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : data_(::std::exchange(other.data_, nullptr)), size_(::std::exchange(other.size_, 0)),
+          mode_(other.mode_), open_(::std::exchange(other.open_, false)) {}
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            close();
+            data_ = ::std::exchange(other.data_, nullptr);
+            size_ = ::std::exchange(other.size_, 0);
+            mode_ = other.mode_;
+            open_ = ::std::exchange(other.open_, false);
+        }
+        return *this;
+    }
+
+    ~MappedFile() {
+        close();
+    }
+
+    /**
+     * @brief Maps an existing file.
+     *
+     * @param path File path.
+     * @param mode Access mode.
+     * @param populate Pre-fault every page (Linux; ignored elsewhere).
+     *
+     * @returns `OK`, `FAILED_PRECONDITION` if already open, or the
+     * `errno` derived code (`NOT_FOUND`, `PERMISSION_DENIED`, ...).
+     */
+    ::mystic::status::StatusCode open(const char* path, MapMode mode = MapMode::READ_ONLY,
+                                      bool populate = false) noexcept {
+        if (open_) {
+            return ::mystic::status::StatusCode::FAILED_PRECONDITION;
+        }
+
+        const int fd = ::open(path, ((mode == MapMode::READ_ONLY) ? O_RDONLY : O_RDWR) | O_CLOEXEC);
+        if (fd < 0) {
+            return internal::status_from_errno(errno);
+        }
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            const int error = errno;
+            ::close(fd);
+            return internal::status_from_errno(error);
+        }
+        if (!S_ISREG(info.st_mode)) {
+            ::close(fd);
+            return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+        }
+
+        const ::mystic::status::StatusCode status = map(fd, static_cast<::mystic::types::size_t>(info.st_size),
+                                                        mode, populate);
+        ::close(fd);
+        return status;
+    }
+
+    /**
+     * @brief Creates (or truncates) a file of `size` bytes, and maps it read-write.
+     *
+     * @returns `OK`, `FAILED_PRECONDITION` if already open, or the
+     * `errno` derived code.
+     */
+    ::mystic::status::StatusCode create(const char* path, ::mystic::types::size_t size,
+                                        bool populate = false) noexcept {
+        if (open_) {
+            return ::mystic::status::StatusCode::FAILED_PRECONDITION;
+        }
+
+        const int fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            return internal::status_from_errno(errno);
+        }
+        if (::ftruncate(fd, static_cast<::off_t>(size)) != 0) {
+            const int error = errno;
+            ::close(fd);
+            return internal::status_from_errno(error);
+        }
+
+        const ::mystic::status::StatusCode status = map(fd, size, MapMode::READ_WRITE, populate);
+        ::close(fd);
+        return status;
+    }
+
+    /**
+     * @brief Unmaps the file (unwritten stores still reach it through the page cache).
+     */
+    void close() noexcept {
+        if (data_ != nullptr) {
+            ::munmap(data_, size_);
+        }
+        data_ = nullptr;
+        size_ = 0;
+        open_ = false;
+    }
+
+    /**
+     * @brief Applies an access hint to `[offset, offset + length)`, clamped to the file.
+     *
+     * @details
+     * The range is widened to page boundaries. `DONTNEED` drops the pages
+     * from this mapping only; the file contents are unaffected.
+     *
+     * @returns `OK`, `FAILED_PRECONDITION` if not open, or the `errno` derived code.
+     */
+    ::mystic::status::StatusCode advise(AccessHint hint, ::mystic::types::size_t offset = 0,
+                                        ::mystic::types::size_t length = static_cast<::mystic::types::size_t>(-1)) const noexcept {
+        if (!open_) {
+            return ::mystic::status::StatusCode::FAILED_PRECONDITION;
+        }
+        if ((data_ == nullptr) || (offset >= size_)) {
+            return ::mystic::status::StatusCode::OK;
+        }
+
+        const ::mystic::types::size_t end = (length > size_ - offset) ? size_ : offset + length;
+        const ::mystic::types::size_t start = offset & ~(internal::page_size() - 1);
+        if (::madvise(reinterpret_cast<char*>(data_) + start, end - start,
+                      internal::advice_of(hint)) != 0) {
+            return internal::status_from_errno(errno);
+        }
+        return ::mystic::status::StatusCode::OK;
+    }
+
+    /**
+     * @brief Flushes modified pages to the file.
+     *
+     * @param wait Block until written (`MS_SYNC`), or only schedule (`MS_ASYNC`).
+     *
+     * @returns `OK`, `FAILED_PRECONDITION` if not open read-write, or the `errno` derived code.
+     */
+    ::mystic::status::StatusCode sync(bool wait = true) const noexcept {
+        if (!open_ || (mode_ != MapMode::READ_WRITE)) {
+            return ::mystic::status::StatusCode::FAILED_PRECONDITION;
+        }
+        if ((data_ != nullptr) && (::msync(data_, size_, wait ? MS_SYNC : MS_ASYNC) != 0)) {
+            return internal::status_from_errno(errno);
+        }
+        return ::mystic::status::StatusCode::OK;
+    }
+
+    /**
+     * @brief Returns the mapped bytes (writable only in `READ_WRITE` mode).
+     */
+    ByteSpan bytes() const noexcept {
+        return ByteSpan{data_, size_};
+    }
+
+    /**
+     * @brief Returns the start of the mapping.
+     */
+    const ::mystic::types::byte* data() const noexcept {
+        return data_;
+    }
+
+    /**
+     * @brief Returns the file size.
+     */
+    ::mystic::types::size_t size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @brief Returns the access mode.
+     */
+    MapMode mode() const noexcept {
+        return mode_;
+    }
+
+    /**
+     * @brief Returns true if a file is mapped.
+     */
+    bool is_open() const noexcept {
+        return open_;
+    }
+
+private:
+    ::mystic::status::StatusCode map(int fd, ::mystic::types::size_t size, MapMode mode, bool populate) noexcept {
+        mode_ = mode;
+        if (size == 0) {
+            open_ = true;
+            return ::mystic::status::StatusCode::OK;
+        }
+
+        int flags = MAP_SHARED;
+#if defined(MAP_POPULATE)
+        if (populate) {
+            flags |= MAP_POPULATE;
+        }
+#else
+        static_cast<void>(populate);
+#endif
+        const int protection = (mode == MapMode::READ_ONLY) ? PROT_READ : (PROT_READ | PROT_WRITE);
+        void* data = ::mmap(nullptr, size, protection, flags, fd, 0);
+        if (data == MAP_FAILED) {
+            return internal::status_from_errno(errno);
+        }
+
+        data_ = static_cast<::mystic::types::byte*>(data);
+        size_ = size;
+        open_ = true;
+        return ::mystic::status::StatusCode::OK;
+    }
+
+    ::mystic::types::byte* data_ = nullptr;
+    ::mystic::types::size_t size_ = 0;
+    MapMode mode_ = MapMode::READ_ONLY;
+    bool open_ = false;
+};
+
+/* =============================================
+    Sequential Prefetcher
+   --------------------------------------------- */
+
+/**
+ * @brief Keeps `MADV_WILLNEED` a few windows ahead of a forward scan.
+ *
+ * @details
+ * Call `advance()` with the current offset as often as convenient; it
+ * returns immediately until the scan reaches the next window. With
+ * `release_behind`, windows left behind are dropped from the mapping,
+ * which keeps the resident set bounded on files larger than memory.
+ */
+class SequentialPrefetcher {
+public:
+    /// Default window size.
+    static constexpr ::mystic::types::size_t kDefaultWindow = ::mystic::types::size_t(4) << 20;
+
+    /// Default number of windows kept ahead.
+    static constexpr ::mystic::types::size_t kDefaultAhead = 2;
+
+    explicit SequentialPrefetcher(const MappedFile& file, ::mystic::types::size_t window = kDefaultWindow,
+                                  ::mystic::types::size_t ahead = kDefaultAhead, bool release_behind = false) noexcept
+        : file_(file), window_((window < internal::page_size()) ? internal::page_size() : window),
+          ahead_((ahead == 0) ? 1 : ahead), release_behind_(release_behind) {
+        window_ &= ~(internal::page_size() - 1);
+    }
+
+    /**
+     * @brief Notes that the scan reached `offset`.
+     */
+    void advance(::mystic::types::size_t offset) noexcept {
+        if (offset < next_) {
+            return;
+        }
+
+        const ::mystic::types::size_t current = offset - offset % window_;
+        const ::mystic::types::size_t target = current + (ahead_ + 1) * window_;
+        if (target > prefetched_) {
+            const ::mystic::types::size_t from = (prefetched_ > current) ? prefetched_ : current;
+            file_.advise(AccessHint::WILLNEED, from, target - from);
+            prefetched_ = target;
+        }
+        if (release_behind_ && (current > released_ + window_)) {
+            file_.advise(AccessHint::DONTNEED, released_, current - window_ - released_);
+            released_ = current - window_;
+        }
+        next_ = current + window_;
+    }
+
+    /**
+     * @brief Restarts from the beginning of the file.
+     */
+    void reset() noexcept {
+        next_ = 0;
+        prefetched_ = 0;
+        released_ = 0;
+    }
+
+private:
+    const MappedFile& file_;
+    ::mystic::types::size_t window_;
+    ::mystic::types::size_t ahead_;
+    bool release_behind_;
+    ::mystic::types::size_t next_ = 0;
+    ::mystic::types::size_t prefetched_ = 0;
+    ::mystic::types::size_t released_ = 0;
+};
+
+} // namespace platform
+} // namespace mystic
+
+#endif // (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX) || (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_MACOS)
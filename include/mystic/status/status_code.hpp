@@ -175,7 +175,7 @@ enum class MYSTIC_FRAMEWORK_API StatusCode :
  *
  * @returns The corresponding string.
  */
-MYSTIC_NODISCARD MYSTIC_FORCEINLINE
+MYSTIC_NODISCARD_NO_MSG MYSTIC_FORCEINLINE inline
 ::mystic::string to_string(const StatusCode& code) noexcept {
     switch(code) {
         case StatusCode::OK:
@@ -228,7 +228,7 @@ MYSTIC_NODISCARD MYSTIC_FORCEINLINE
  * @note
  * When unknown string is given, it defaults to `StatusCode::OK`.
  */
-MYSTIC_NODISCARD MYSTIC_FORCEINLINE
+MYSTIC_NODISCARD_NO_MSG MYSTIC_FORCEINLINE inline
 StatusCode from_string(const ::mystic::string& str) noexcept {
 
     // Convert to uppercase for case-agnostic comparision.
@@ -0,0 +1,197 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/time/deadline.hpp
+ * @file deadline.hpp
+ * @brief Defines a monotonic-clock deadline value type.
+ *
+ * @details
+ * `Deadline` is an absolute point on the monotonic clock, in
+ * nanoseconds: one 64-bit word, cheap to pass down a call chain, and
+ * immune to wall-clock jumps. Narrowing for a sub-call is `earliest`;
+ * expiry maps to `StatusCode::DEADLINE_EXCEEDED`.
+ *
+ * This header file provides,
+ * 1. monotonic_ns(), the clock deadlines are measured on.
+ * 2. Deadline, the value type.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/time/deadline.hpp"
+ *
+ * mystic::status::StatusCode handle(const Request& request, mystic::time::Deadline deadline) {
+ *     auto backend = mystic::time::earliest(deadline, mystic::time::Deadline::after(50'000'000));
+ *     if (auto status = backend.status(); status != mystic::status::StatusCode::OK) {
+ *         return status;   // DEADLINE_EXCEEDED
+ *     }
+ *     return call_backend(request, backend);
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <chrono>
+
+#include "mystic/status/status_code.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::time
+ * @brief Clocks, deadlines, and timers.
+ */
+namespace time {
+
+/**
+ * @brief Current `std::chrono::steady_clock` time, in nanoseconds.
+ */
+inline ::mystic::types::uint64_t monotonic_ns() noexcept {
+    return static_cast<::mystic::types::uint64_t>(
+        ::std::chrono::duration_cast<::std::chrono::nanoseconds>(::std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+/**
+ * @brief Absolute deadline on the `monotonic_ns` clock.
+ *
+ * @details
+ * Default constructed deadlines are infinite (never expire).
+ */
+class Deadline {
+public:
+    static constexpr ::mystic::types::uint64_t kInfinite = ~::mystic::types::uint64_t{0};
+
+    constexpr Deadline() noexcept = default;
+
+    /**
+     * @brief Deadline at `monotonic_ns() == ns`.
+     */
+    static constexpr Deadline at(::mystic::types::uint64_t ns) noexcept {
+        return Deadline(ns);
+    }
+
+    /**
+     * @brief Deadline `timeout_ns` from `now_ns`; saturates to infinite.
+     */
+    static constexpr Deadline after(::mystic::types::uint64_t timeout_ns, ::mystic::types::uint64_t now_ns) noexcept {
+        return Deadline((timeout_ns >= kInfinite - now_ns) ? kInfinite : now_ns + timeout_ns);
+    }
+
+    static Deadline after(::mystic::types::uint64_t timeout_ns) noexcept {
+        return after(timeout_ns, monotonic_ns());
+    }
+
+    static constexpr Deadline infinite() noexcept {
+        return Deadline();
+    }
+
+    /* =============================================
+        Observers
+       --------------------------------------------- */
+
+    constexpr ::mystic::types::uint64_t ns() const noexcept {
+        return ns_;
+    }
+
+    constexpr bool is_infinite() const noexcept {
+        return ns_ == kInfinite;
+    }
+
+    constexpr bool expired(::mystic::types::uint64_t now_ns) const noexcept {
+        return now_ns >= ns_;
+    }
+
+    bool expired() const noexcept {
+        return !is_infinite() && expired(monotonic_ns());
+    }
+
+    /**
+     * @brief Nanoseconds left at `now_ns` (zero once expired, `kInfinite` if infinite).
+     */
+    constexpr ::mystic::types::uint64_t remaining_ns(::mystic::types::uint64_t now_ns) const noexcept {
+        return is_infinite() ? kInfinite : (now_ns >= ns_) ? 0 : ns_ - now_ns;
+    }
+
+    ::mystic::types::uint64_t remaining_ns() const noexcept {
+        return is_infinite() ? kInfinite : remaining_ns(monotonic_ns());
+    }
+
+    /**
+     * @brief `DEADLINE_EXCEEDED` once expired, else `OK`.
+     */
+    constexpr ::mystic::status::StatusCode status(::mystic::types::uint64_t now_ns) const noexcept {
+        return expired(now_ns) ? ::mystic::status::StatusCode::DEADLINE_EXCEEDED : ::mystic::status::StatusCode::OK;
+    }
+
+    ::mystic::status::StatusCode status() const noexcept {
+        return expired() ? ::mystic::status::StatusCode::DEADLINE_EXCEEDED : ::mystic::status::StatusCode::OK;
+    }
+
+    /* =============================================
+        Comparison
+       --------------------------------------------- */
+
+    friend constexpr bool operator==(Deadline lhs, Deadline rhs) noexcept {
+        return lhs.ns_ == rhs.ns_;
+    }
+
+    friend constexpr bool operator!=(Deadline lhs, Deadline rhs) noexcept {
+        return lhs.ns_ != rhs.ns_;
+    }
+
+    friend constexpr bool operator<(Deadline lhs, Deadline rhs) noexcept {
+        return lhs.ns_ < rhs.ns_;
+    }
+
+    friend constexpr bool operator<=(Deadline lhs, Deadline rhs) noexcept {
+        return lhs.ns_ <= rhs.ns_;
+    }
+
+    friend constexpr bool operator>(Deadline lhs, Deadline rhs) noexcept {
+        return lhs.ns_ > rhs.ns_;
+    }
+
+    friend constexpr bool operator>=(Deadline lhs, Deadline rhs) noexcept {
+        return lhs.ns_ >= rhs.ns_;
+    }
+
+private:
+    constexpr explicit Deadline(::mystic::types::uint64_t ns) noexcept
+        : ns_(ns) {}
+
+    ::mystic::types::uint64_t ns_ = kInfinite;
+};
+
+/**
+ * @brief The earlier of two deadlines (for narrowing a sub-call).
+ */
+constexpr inline Deadline earliest(Deadline lhs, Deadline rhs) noexcept {
+    return (rhs < lhs) ? rhs : lhs;
+}
+
+} // namespace time
+} // namespace mystic
@@ -0,0 +1,402 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/time/timer_wheel.hpp
+ * @file timer_wheel.hpp
+ * @brief Defines a hierarchical hashed timer wheel.
+ *
+ * @details
+ * `TimerWheel<T, Offset>` keeps timers in 8 levels of 64 slots, each
+ * level 64 times coarser than the one below, covering 2^48 ticks. A
+ * timer goes in the level where its distance from now fits, and moves
+ * down a level when the time comes to resolve it more finely, so
+ * scheduling, and cancelling are O(1), and a timer is touched at most
+ * once per level.
+ *
+ * Timers are intrusive: the `TimerHook` at byte `Offset` of `T` holds
+ * the links, so millions of outstanding timeouts need no allocation,
+ * and no priority queue. `advance(now, fn)` fires every due timer in
+ * one batch, jumping straight to the next occupied slot of any level
+ * via per-level occupancy bitmaps, so idle stretches cost nothing.
+ *
+ * Times are nanoseconds on any monotonic clock; the tick (resolution)
+ * is set at construction, down to 1 ns. Timers never fire early, and
+ * fire at most one tick late (plus however late `advance` is called).
+ *
+ * The wheel is not thread safe; drive it from one thread.
+ *
+ * This header file provides,
+ * 1. TimerHook - Hook embedded in timer objects.
+ * 2. TimerWheel - The wheel.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/time/timer_wheel.hpp"
+ *
+ * struct Request {
+ *     mystic::time::TimerHook timeout;
+ *     // ...
+ * };
+ *
+ * mystic::time::TimerWheel<Request, MYSTIC_OFFSETOF(Request, timeout)> wheel(1000, now_ns());  // 1 us ticks
+ *
+ * wheel.schedule(request, now_ns() + 250'000'000);
+ * wheel.cancel(request);                                     // Answered in time.
+ *
+ * wheel.advance(now_ns(), [](Request& expired) {
+ *     expired.fail(mystic::status::StatusCode::DEADLINE_EXCEEDED);
+ * });
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "mystic/containers/intrusive_hook.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+#include "mystic/utility/bit.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::time
+ * @brief Clocks, deadlines, and timers.
+ */
+namespace time {
+
+/**
+ * @brief Timer state embedded in objects scheduled on a `TimerWheel`.
+ */
+struct TimerHook {
+    ::mystic::ListHook links;
+    ::mystic::types::uint64_t expiry = 0; ///< Tick at which the timer fires.
+
+    bool is_armed() const noexcept {
+        return links.is_linked();
+    }
+};
+
+/**
+ * @brief Hierarchical hashed timer wheel over intrusive timers.
+ *
+ * @details
+ * Not copyable, or movable (slots are self-linked list heads).
+ *
+ * @tparam Type Timer object type (standard layout, for the hook offset).
+ * @tparam HookOffset Byte offset of the `TimerHook` in `Type`.
+ */
+template <typename Type, ::mystic::types::size_t HookOffset>
+class TimerWheel {
+public:
+    using size_type = ::mystic::types::size_t;
+
+    static constexpr unsigned int kLevelBits = 6;
+    static constexpr unsigned int kSlots     = 1u << kLevelBits;
+    static constexpr unsigned int kLevels    = 8;
+
+    /// Farthest tick distance resolved; later timers wait at the top level.
+    static constexpr ::mystic::types::uint64_t kMaxDelta = ::mystic::types::uint64_t{1} << (kLevelBits * kLevels);
+
+    /**
+     * @brief Empty wheel at time `now_ns`, ticking every `tick_ns` (at least 1).
+     */
+    explicit TimerWheel(::mystic::types::uint64_t tick_ns = 1'000'000, ::mystic::types::uint64_t now_ns = 0) noexcept
+        : tick_ns_((tick_ns == 0) ? 1 : tick_ns) {
+        current_ = now_ns / tick_ns_;
+        for (auto& level : slots_) {
+            for (::mystic::ListHook& slot : level) {
+                slot.prev = &slot;
+                slot.next = &slot;
+            }
+        }
+    }
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    /**
+     * @brief Disarms every pending timer.
+     */
+    ~TimerWheel() {
+        clear();
+    }
+
+    /* =============================================
+        Observers
+       --------------------------------------------- */
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    ::mystic::types::uint64_t tick_ns() const noexcept {
+        return tick_ns_;
+    }
+
+    /**
+     * @brief Start of the first tick not yet processed by `advance`.
+     */
+    ::mystic::types::uint64_t now_ns() const noexcept {
+        return current_ * tick_ns_;
+    }
+
+    /* =============================================
+        Scheduling
+       --------------------------------------------- */
+
+    /**
+     * @brief Arms `timer` (which must be disarmed) to fire at `deadline_ns`.
+     *
+     * @details
+     * The deadline is rounded up to a tick; deadlines already past fire
+     * on the next `advance`.
+     */
+    void schedule(Type& timer, ::mystic::types::uint64_t deadline_ns) noexcept {
+        TimerHook* hook = hook_of(timer);
+        hook->expiry = deadline_ns / tick_ns_ + ((deadline_ns % tick_ns_) != 0 ? 1 : 0);
+        place(hook);
+        ++size_;
+    }
+
+    /**
+     * @brief Disarms `timer`; returns false if it was not armed.
+     */
+    bool cancel(Type& timer) noexcept {
+        ::mystic::ListHook* links = &hook_of(timer)->links;
+        if (!links->is_linked()) {
+            return false;
+        }
+        unlink(links);
+        --size_;
+        return true;
+    }
+
+    /**
+     * @brief Moves `timer` to `deadline_ns`, arming it if needed.
+     */
+    void reschedule(Type& timer, ::mystic::types::uint64_t deadline_ns) noexcept {
+        cancel(timer);
+        schedule(timer, deadline_ns);
+    }
+
+    /**
+     * @brief Fires every timer due by `now_ns`, calling `fn(timer)` in tick order.
+     *
+     * @details
+     * Timers are disarmed before `fn` runs, so `fn` may reschedule them,
+     * or schedule, and cancel others; it must not call `advance`. If `fn`
+     * throws, its timer stays disarmed, and the others due stay armed, to
+     * fire on the next call.
+     *
+     * @returns Number of timers fired.
+     */
+    template <typename Fn>
+    size_type advance(::mystic::types::uint64_t now_ns, Fn&& fn) {
+        const ::mystic::types::uint64_t target = now_ns / tick_ns_;
+        size_type fired = 0;
+        while (current_ <= target) {
+            const ::mystic::types::uint64_t tick = next_event();
+            if (tick > target) {
+                current_ = target + 1;
+                break;
+            }
+            current_ = tick;
+            if ((current_ & (kSlots - 1)) == 0) {
+                cascade();
+            }
+            const unsigned int index = static_cast<unsigned int>(current_ & (kSlots - 1));
+            // Past this tick first, so timers scheduled by `fn` land ahead of it.
+            ++current_;
+            if ((occupied_[0] & (::mystic::types::uint64_t{1} << index)) != 0) {
+                fired += fire(index, fn);
+            }
+        }
+        return fired;
+    }
+
+    /**
+     * @brief Disarms every pending timer without firing it.
+     */
+    void clear() noexcept {
+        for (unsigned int level = 0; level < kLevels; ++level) {
+            for (::mystic::ListHook& slot : slots_[level]) {
+                ::mystic::ListHook* links = slot.next;
+                while (links != &slot) {
+                    ::mystic::ListHook* next = links->next;
+                    links->prev = nullptr;
+                    links->next = nullptr;
+                    links = next;
+                }
+                slot.prev = &slot;
+                slot.next = &slot;
+            }
+            occupied_[level] = 0;
+        }
+        size_ = 0;
+    }
+
+private:
+    static TimerHook* hook_of(Type& timer) noexcept {
+        return ::mystic::internal::owner_hook<TimerHook, HookOffset>(timer);
+    }
+
+    static TimerHook* hook_of(::mystic::ListHook* links) noexcept {
+        // `links` is the first member of TimerHook.
+        return reinterpret_cast<TimerHook*>(links);
+    }
+
+    static void unlink(::mystic::ListHook* links) noexcept {
+        links->prev->next = links->next;
+        links->next->prev = links->prev;
+        links->prev = nullptr;
+        links->next = nullptr;
+    }
+
+    /// Links `hook` into the slot matching its distance from the current tick.
+    void place(TimerHook* hook) noexcept {
+        ::mystic::types::uint64_t expiry = (hook->expiry > current_) ? hook->expiry : current_;
+        if (expiry - current_ >= kMaxDelta) {
+            expiry = current_ + kMaxDelta - 1;
+        }
+        const ::mystic::types::uint64_t delta = expiry - current_;
+        const unsigned int level =
+            (delta < kSlots) ? 0u : static_cast<unsigned int>(63 - ::mystic::bit::countl_zero(delta)) / kLevelBits;
+        const unsigned int index = static_cast<unsigned int>(expiry >> (level * kLevelBits)) & (kSlots - 1);
+
+        ::mystic::ListHook& slot = slots_[level][index];
+        ::mystic::ListHook* links = &hook->links;
+        links->prev = slot.prev;
+        links->next = &slot;
+        slot.prev->next = links;
+        slot.prev = links;
+        occupied_[level] |= ::mystic::types::uint64_t{1} << index;
+    }
+
+    /**
+     * @brief First tick from the current one with an occupied slot to fire, or cascade.
+     *
+     * @details
+     * Level `l` slot `i` is handled at the next tick that is a multiple
+     * of 64^l, with `i` as its level-`l` digit; rotating each bitmap to
+     * the current digit finds the nearest one per level.
+     */
+    ::mystic::types::uint64_t next_event() const noexcept {
+        ::mystic::types::uint64_t next = ~::mystic::types::uint64_t{0};
+        for (unsigned int level = 0; level < kLevels; ++level) {
+            const ::mystic::types::uint64_t bits = occupied_[level];
+            if (bits == 0) {
+                continue;
+            }
+            const unsigned int shift = level * kLevelBits;
+            const ::mystic::types::uint64_t first = (current_ + (::mystic::types::uint64_t{1} << shift) - 1) >> shift;
+            const unsigned int digit = static_cast<unsigned int>(first & (kSlots - 1));
+            const ::mystic::types::uint64_t rotated = (bits >> digit) | (bits << ((kSlots - digit) & (kSlots - 1)));
+            const ::mystic::types::uint64_t tick = (first + ::mystic::bit::countr_zero(rotated)) << shift;
+            if (tick < next) {
+                next = tick;
+            }
+        }
+        return next;
+    }
+
+    /// Moves the timers of the higher-level slots starting at the current tick down.
+    void cascade() noexcept {
+        for (unsigned int level = 1; level < kLevels; ++level) {
+            const unsigned int shift = level * kLevelBits;
+            if ((current_ & ((::mystic::types::uint64_t{1} << shift) - 1)) != 0) {
+                return;
+            }
+            const unsigned int index = static_cast<unsigned int>(current_ >> shift) & (kSlots - 1);
+            if ((occupied_[level] & (::mystic::types::uint64_t{1} << index)) == 0) {
+                continue;
+            }
+            occupied_[level] &= ~(::mystic::types::uint64_t{1} << index);
+            ::mystic::ListHook& slot = slots_[level][index];
+            ::mystic::ListHook* links = slot.next;
+            slot.prev = &slot;
+            slot.next = &slot;
+            while (links != &slot) {
+                ::mystic::ListHook* next = links->next;
+                place(hook_of(links));
+                links = next;
+            }
+        }
+    }
+
+    /// Fires level-0 slot `index` as one batch.
+    template <typename Fn>
+    size_type fire(unsigned int index, Fn& fn) {
+        occupied_[0] &= ~(::mystic::types::uint64_t{1} << index);
+        ::mystic::ListHook& slot = slots_[0][index];
+        if (slot.next == &slot) {
+            return 0; // Emptied by cancellations.
+        }
+        // Detached first: `fn` may schedule into this slot again.
+        ::mystic::ListHook batch;
+        batch.next = slot.next;
+        batch.prev = slot.prev;
+        batch.next->prev = &batch;
+        batch.prev->next = &batch;
+        slot.prev = &slot;
+        slot.next = &slot;
+
+        size_type fired = 0;
+#if defined(__cpp_exceptions)
+        try {
+#endif
+            while (batch.next != &batch) {
+                ::mystic::ListHook* links = batch.next;
+                unlink(links);
+                --size_;
+                ++fired;
+                fn(*::mystic::internal::hook_owner<Type, HookOffset>(hook_of(links)));
+            }
+#if defined(__cpp_exceptions)
+        } catch (...) {
+            // The rest stay armed, and due: re-placed, they fire on the next `advance`.
+            while (batch.next != &batch) {
+                ::mystic::ListHook* links = batch.next;
+                unlink(links);
+                place(hook_of(links));
+            }
+            throw;
+        }
+#endif
+        return fired;
+    }
+
+    ::mystic::ListHook slots_[kLevels][kSlots];
+    ::mystic::types::uint64_t occupied_[kLevels] = {}; ///< Slot bits; may be stale after cancels.
+    ::mystic::types::uint64_t tick_ns_;
+    ::mystic::types::uint64_t current_ = 0; ///< First tick not yet processed.
+    size_type size_ = 0;
+};
+
+} // namespace time
+} // namespace mystic
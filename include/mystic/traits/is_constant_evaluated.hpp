@@ -0,0 +1,82 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/traits/is_constant_evaluated.hpp
+ * @file is_constant_evaluated.hpp
+ * @brief Defines is constant evaluated query.
+ *
+ * @details
+ * This header lets constexpr functions pick a runtime-only fast path
+ * (SIMD, memcpy, etc.) while keeping a portable path for compile time.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/traits/is_constant_evaluated.hpp"
+ *
+ * constexpr int compute(int x) {
+ *     if (!mystic::traits::is_constant_evaluated()) {
+ *         // Runtime-only path
+ *     }
+ *     // Portable path
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <type_traits>
+
+#include "mystic/architecture/compiler_detection.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level enclosing namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::traits
+ * @ingroup Traits
+ * @brief This namespace defines type traits.
+ */
+namespace traits {
+
+/**
+ * @brief Returns true when called during constant evaluation.
+ *
+ * @note
+ * When neither the standard nor the compiler provide the query,
+ * it conservatively returns true, so callers always take their
+ * portable path.
+ */
+constexpr inline bool is_constant_evaluated() noexcept {
+#if defined(__cpp_lib_is_constant_evaluated)
+    return ::std::is_constant_evaluated();
+#elif (MYSTIC_ARCH_COMPILER == MYSTIC_ARCH_COMPILER_CLANG) || \
+      (MYSTIC_ARCH_COMPILER == MYSTIC_ARCH_COMPILER_GCC)
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
+} // namespace traits
+} // namespace mystic
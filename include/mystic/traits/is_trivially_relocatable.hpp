@@ -0,0 +1,119 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/traits/is_trivially_relocatable.hpp
+ * @file is_trivially_relocatable.hpp
+ * @brief Defines is trivially relocatable type trait.
+ *
+ * @details
+ * A type is trivially relocatable when moving an object to new storage,
+ * and destroying the source, is equivalent to copying its bytes, and
+ * forgetting the source. Containers use this to grow, insert, and erase
+ * with `memcpy`, and `memmove`.
+ *
+ * Trivially copyable types qualify automatically, as do types Clang
+ * reports through `__is_trivially_relocatable` (e.g. `[[clang::trivial_abi]]`
+ * classes). Other types opt in by specializing the trait; smart pointers,
+ * and pairs of relocatable members are opted in here.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/traits/is_trivially_relocatable.hpp"
+ *
+ * struct Handle {
+ *     Handle(Handle&&) noexcept;
+ *     ~Handle();
+ *     void* resource;
+ * };
+ *
+ * template <>
+ * struct mystic::traits::is_trivially_relocatable<Handle> : std::true_type {};
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @namespace mystic
+ * @brief Top-level enclosing namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::traits
+ * @ingroup Traits
+ * @brief This namespace defines type traits.
+ */
+namespace traits {
+
+/**
+ * @brief Type trait is_trivially_relocatable (specialize to opt in).
+ */
+template <typename Type>
+struct is_trivially_relocatable
+    : ::std::bool_constant<::std::is_trivially_copyable<Type>::value
+#if defined(__has_builtin)
+# if __has_builtin(__is_trivially_relocatable)
+                           || __is_trivially_relocatable(Type)
+# endif
+#endif
+                           > {
+};
+
+/**
+ * @brief Owning pointers hold only a pointer (and an empty deleter).
+ */
+template <typename Type>
+struct is_trivially_relocatable<::std::unique_ptr<Type>> : ::std::true_type {};
+
+/**
+ * @brief Shared pointers hold two pointers, and no self references.
+ */
+template <typename Type>
+struct is_trivially_relocatable<::std::shared_ptr<Type>> : ::std::true_type {};
+
+/**
+ * @brief Weak pointers hold two pointers, and no self references.
+ */
+template <typename Type>
+struct is_trivially_relocatable<::std::weak_ptr<Type>> : ::std::true_type {};
+
+/**
+ * @brief Pairs relocate like their members (const members included).
+ */
+template <typename First, typename Second>
+struct is_trivially_relocatable<::std::pair<First, Second>>
+    : ::std::bool_constant<is_trivially_relocatable<::std::remove_const_t<First>>::value &&
+                           is_trivially_relocatable<::std::remove_const_t<Second>>::value> {
+};
+
+/**
+ * @brief _v Alias for type.
+ */
+template <typename Type>
+constexpr inline bool is_trivially_relocatable_v = is_trivially_relocatable<Type>::value;
+
+} // namespace traits
+} // namespace mystic
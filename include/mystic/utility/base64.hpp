@@ -0,0 +1,425 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/utility/base64.hpp
+ * @file base64.hpp
+ * @brief Defines vectorized base64 encoding, and decoding.
+ *
+ * @details
+ * This header provides standard (RFC 4648, padded) base64 encoding, and
+ * strictly validated decoding over byte ranges. The bulk of the input is
+ * processed with table lookups in vector registers,
+ * 1. AVX512 VBMI, 48 bytes per step, using byte permutes.
+ * 2. AVX2, 24 bytes per step, using nibble lookups.
+ * 3. NEON, 48 bytes per step, using interleaved loads, and `tbl`.
+ *
+ * Decoding reports `StatusCode::INVALID_ARGUMENT` for lengths that are
+ * not a multiple of four, characters outside the alphabet, misplaced
+ * padding, and non-zero trailing bits.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/utility/base64.hpp"
+ *
+ * char text[mystic::string_utils::base64_encoded_size(32)];
+ * mystic::string_utils::base64_encode(payload, 32, text);
+ *
+ * mystic::types::byte bytes[mystic::string_utils::base64_decoded_max_size(64)];
+ * mystic::types::size_t length = 0;
+ * auto status = mystic::string_utils::base64_decode(header, bytes, length);
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <string_view>
+
+#include "mystic/architecture/simd_detection.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+#if MYSTIC_ARCH_SIMD_HAS_AVX2
+# include <immintrin.h>
+#elif MYSTIC_ARCH_SIMD_HAS_NEON
+# include <arm_neon.h>
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::string_utils
+ * @brief String utility functions.
+ */
+namespace string_utils {
+
+/**
+ * @namespace mystic::string_utils::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/// Standard base64 alphabet.
+inline constexpr char kBase64Alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/**
+ * @brief Character to sextet table, 0xFF marks characters outside the alphabet.
+ */
+struct Base64DecodeTable {
+    ::mystic::types::uint8_t values[256];
+
+    constexpr Base64DecodeTable() noexcept : values() {
+        for (int i = 0; i < 256; ++i) {
+            values[i] = 0xFF;
+        }
+        for (int i = 0; i < 64; ++i) {
+            values[static_cast<unsigned char>(kBase64Alphabet[i])] = static_cast<::mystic::types::uint8_t>(i);
+        }
+    }
+};
+
+/// Shared decode table.
+inline constexpr Base64DecodeTable kBase64DecodeTable{};
+
+} // namespace internal
+
+/**
+ * @brief Encoded size of `size` bytes, padding included.
+ */
+constexpr inline ::mystic::types::size_t base64_encoded_size(::mystic::types::size_t size) noexcept {
+    return ((size + 2) / 3) * 4;
+}
+
+/**
+ * @brief Upper bound of the decoded size of `size` base64 characters.
+ */
+constexpr inline ::mystic::types::size_t base64_decoded_max_size(::mystic::types::size_t size) noexcept {
+    return (size / 4) * 3;
+}
+
+/**
+ * @brief Encodes bytes as padded base64.
+ *
+ * @param data The given bytes.
+ * @param size Number of bytes.
+ * @param out Destination of at least `base64_encoded_size(size)` characters.
+ *
+ * @returns Number of characters written.
+ */
+inline ::mystic::types::size_t base64_encode(const ::mystic::types::byte* data, ::mystic::types::size_t size,
+                                             char* out) noexcept {
+    const auto* in = reinterpret_cast<const ::mystic::types::uint8_t*>(data);
+    const char* alphabet = internal::kBase64Alphabet;
+    char* cursor = out;
+    ::mystic::types::size_t i = 0;
+
+#if MYSTIC_ARCH_SIMD_HAS_AVX512VBMI
+    {
+        // Spread each 3 byte group over a 32-bit lane as [b1, b0, b2, b1],
+        // then pull the four sextets out with one multishift.
+        const __m512i spread = _mm512_setr_epi32(
+            0x01020001, 0x04050304, 0x07080607, 0x0a0b090a, 0x0d0e0c0d, 0x10110f10, 0x13141213, 0x16171516,
+            0x191a1819, 0x1c1d1b1c, 0x1f201e1f, 0x22232122, 0x25262425, 0x28292728, 0x2b2c2a2b, 0x2e2f2d2e);
+        const __m512i shifts = _mm512_set1_epi64(0x3036242a1016040aLL);
+        const __m512i lookup = _mm512_loadu_si512(reinterpret_cast<const void*>(alphabet));
+
+        // Loads 64 bytes per 48 consumed.
+        for (; i + 64 <= size; i += 48) {
+            const __m512i v = _mm512_permutexvar_epi8(
+                spread, _mm512_loadu_si512(reinterpret_cast<const void*>(in + i)));
+            const __m512i sextets = _mm512_multishift_epi64_epi8(shifts, v);
+            _mm512_storeu_si512(reinterpret_cast<void*>(cursor), _mm512_permutexvar_epi8(sextets, lookup));
+            cursor += 64;
+        }
+    }
+#endif
+
+#if MYSTIC_ARCH_SIMD_HAS_AVX2
+    {
+        const __m256i spread = _mm256_setr_epi8(
+            1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+            1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+        // Character offsets, indexed by the sextet's range (see below).
+        const __m256i offsets = _mm256_setr_epi8(
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+        // Loads 28 bytes per 24 consumed (12 per 128-bit lane).
+        for (; i + 28 <= size; i += 24) {
+            __m256i v = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 12)), 1);
+            v = _mm256_shuffle_epi8(v, spread);
+
+            const __m256i ac = _mm256_mulhi_epu16(_mm256_and_si256(v, _mm256_set1_epi32(0x0fc0fc00)),
+                                                  _mm256_set1_epi32(0x04000040));
+            const __m256i bd = _mm256_mullo_epi16(_mm256_and_si256(v, _mm256_set1_epi32(0x003f03f0)),
+                                                  _mm256_set1_epi32(0x01000010));
+            const __m256i sextets = _mm256_or_si256(ac, bd);
+
+            // 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12.
+            __m256i range = _mm256_subs_epu8(sextets, _mm256_set1_epi8(51));
+            range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), sextets),
+                                                            _mm256_set1_epi8(13)));
+            const __m256i chars = _mm256_add_epi8(sextets, _mm256_shuffle_epi8(offsets, range));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(cursor), chars);
+            cursor += 32;
+        }
+    }
+#elif MYSTIC_ARCH_SIMD_HAS_NEON
+    {
+        const auto* table_bytes = reinterpret_cast<const ::mystic::types::uint8_t*>(alphabet);
+        uint8x16x4_t table;
+        table.val[0] = vld1q_u8(table_bytes);
+        table.val[1] = vld1q_u8(table_bytes + 16);
+        table.val[2] = vld1q_u8(table_bytes + 32);
+        table.val[3] = vld1q_u8(table_bytes + 48);
+        const uint8x16_t low6 = vdupq_n_u8(0x3F);
+
+        for (; i + 48 <= size; i += 48) {
+            const uint8x16x3_t v = vld3q_u8(in + i);
+            uint8x16x4_t chars;
+            chars.val[0] = vqtbl4q_u8(table, vshrq_n_u8(v.val[0], 2));
+            chars.val[1] = vqtbl4q_u8(table, vandq_u8(vorrq_u8(vshlq_n_u8(v.val[0], 4),
+                                                              vshrq_n_u8(v.val[1], 4)), low6));
+            chars.val[2] = vqtbl4q_u8(table, vandq_u8(vorrq_u8(vshlq_n_u8(v.val[1], 2),
+                                                              vshrq_n_u8(v.val[2], 6)), low6));
+            chars.val[3] = vqtbl4q_u8(table, vandq_u8(v.val[2], low6));
+            vst4q_u8(reinterpret_cast<::mystic::types::uint8_t*>(cursor), chars);
+            cursor += 64;
+        }
+    }
+#endif
+
+    for (; i + 3 <= size; i += 3) {
+        const ::mystic::types::uint32_t group = (static_cast<::mystic::types::uint32_t>(in[i]) << 16) |
+                                                (static_cast<::mystic::types::uint32_t>(in[i + 1]) << 8) |
+                                                static_cast<::mystic::types::uint32_t>(in[i + 2]);
+        cursor[0] = alphabet[(group >> 18) & 0x3F];
+        cursor[1] = alphabet[(group >> 12) & 0x3F];
+        cursor[2] = alphabet[(group >> 6) & 0x3F];
+        cursor[3] = alphabet[group & 0x3F];
+        cursor += 4;
+    }
+
+    if (i < size) {
+        const ::mystic::types::uint32_t b0 = in[i];
+        const ::mystic::types::uint32_t b1 = (i + 1 < size) ? in[i + 1] : 0;
+        cursor[0] = alphabet[b0 >> 2];
+        cursor[1] = alphabet[((b0 & 0x03) << 4) | (b1 >> 4)];
+        cursor[2] = (i + 1 < size) ? alphabet[(b1 & 0x0F) << 2] : '=';
+        cursor[3] = '=';
+        cursor += 4;
+    }
+
+    return static_cast<::mystic::types::size_t>(cursor - out);
+}
+
+/**
+ * @brief Decodes padded base64 into bytes.
+ *
+ * @param text The base64 text.
+ * @param out Destination of at least `base64_decoded_max_size(text.size())` bytes.
+ * @param written Receives the number of bytes decoded.
+ *
+ * @returns `StatusCode::OK`, or `StatusCode::INVALID_ARGUMENT` if the text
+ * is not canonical padded base64 (the output is then unspecified).
+ */
+inline ::mystic::status::StatusCode base64_decode(::std::string_view text, ::mystic::types::byte* out,
+                                                  ::mystic::types::size_t& written) noexcept {
+    written = 0;
+    const ::mystic::types::size_t size = text.size();
+    if ((size % 4) != 0) {
+        return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+    }
+    if (size == 0) {
+        return ::mystic::status::StatusCode::OK;
+    }
+
+    const auto* in = reinterpret_cast<const ::mystic::types::uint8_t*>(text.data());
+    auto* dst = reinterpret_cast<::mystic::types::uint8_t*>(out);
+    const ::mystic::types::uint8_t* table = internal::kBase64DecodeTable.values;
+
+    // The last quantum may carry padding, so it is always decoded last, by hand.
+    const ::mystic::types::size_t body = size - 4;
+    ::mystic::types::size_t i = 0;
+
+#if MYSTIC_ARCH_SIMD_HAS_AVX512VBMI
+    {
+        const __m512i lookup_low = _mm512_loadu_si512(reinterpret_cast<const void*>(table));
+        const __m512i lookup_high = _mm512_loadu_si512(reinterpret_cast<const void*>(table + 64));
+        // Output byte k of each 32-bit lane holds the 24-bit group in reverse.
+        alignas(64) static constexpr ::mystic::types::uint8_t kPack[64] = {
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, 18, 17, 16, 22, 21, 20, 26, 25, 24, 30, 29, 28,
+            34, 33, 32, 38, 37, 36, 42, 41, 40, 46, 45, 44, 50, 49, 48, 54, 53, 52, 58, 57, 56, 62, 61, 60};
+        const __m512i pack = _mm512_load_si512(reinterpret_cast<const void*>(kPack));
+
+        for (; i + 64 <= body; i += 64) {
+            const __m512i v = _mm512_loadu_si512(reinterpret_cast<const void*>(in + i));
+            const __m512i sextets = _mm512_permutex2var_epi8(lookup_low, v, lookup_high);
+            if (_mm512_movepi8_mask(_mm512_or_si512(sextets, v)) != 0) {
+                written = 0;
+                return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+            }
+
+            const __m512i pairs = _mm512_maddubs_epi16(sextets, _mm512_set1_epi32(0x01400140));
+            const __m512i groups = _mm512_madd_epi16(pairs, _mm512_set1_epi32(0x00011000));
+            _mm512_mask_storeu_epi8(reinterpret_cast<void*>(dst + written), (__mmask64(1) << 48) - 1,
+                                    _mm512_permutexvar_epi8(pack, groups));
+            written += 48;
+        }
+    }
+#endif
+
+#if MYSTIC_ARCH_SIMD_HAS_AVX2
+    {
+        // Nibble classification tables; a character is valid if its low,
+        // and high nibble classes share no bit.
+        const __m256i class_low = _mm256_setr_epi8(
+            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+        const __m256i class_high = _mm256_setr_epi8(
+            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+        // Character to sextet offsets, by high nibble ('/' gets its own slot).
+        const __m256i offsets = _mm256_setr_epi8(
+            0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m256i slash = _mm256_set1_epi8(0x2F);
+        const __m256i pack = _mm256_setr_epi8(
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+        for (; i + 32 <= body; i += 32) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+            const __m256i high = _mm256_and_si256(_mm256_srli_epi32(v, 4), slash);
+            const __m256i low_class = _mm256_shuffle_epi8(class_low, _mm256_and_si256(v, slash));
+            const __m256i high_class = _mm256_shuffle_epi8(class_high, high);
+            if (!_mm256_testz_si256(low_class, high_class)) {
+                written = 0;
+                return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+            }
+
+            const __m256i roll = _mm256_shuffle_epi8(offsets,
+                                                     _mm256_add_epi8(_mm256_cmpeq_epi8(v, slash), high));
+            const __m256i sextets = _mm256_add_epi8(v, roll);
+            const __m256i pairs = _mm256_maddubs_epi16(sextets, _mm256_set1_epi32(0x01400140));
+            __m256i groups = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+            groups = _mm256_shuffle_epi8(groups, pack);
+            groups = _mm256_permutevar8x32_epi32(groups, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + written), _mm256_castsi256_si128(groups));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + written + 16), _mm256_extracti128_si256(groups, 1));
+            written += 24;
+        }
+    }
+#elif MYSTIC_ARCH_SIMD_HAS_NEON
+    {
+        uint8x16x4_t lookup_low;
+        uint8x16x4_t lookup_high;
+        for (int k = 0; k < 4; ++k) {
+            lookup_low.val[k] = vld1q_u8(table + 16 * k);
+            lookup_high.val[k] = vld1q_u8(table + 64 + 16 * k);
+        }
+        const uint8x16_t flip = vdupq_n_u8(0x40);
+
+        for (; i + 64 <= body; i += 64) {
+            const uint8x16x4_t v = vld4q_u8(in + i);
+            uint8x16_t sextets[4];
+            uint8x16_t error = vdupq_n_u8(0);
+
+            for (int k = 0; k < 4; ++k) {
+                // Indexes out of a 64 entry table yield 0 (tbl), or keep the lane (tbx).
+                sextets[k] = vqtbx4q_u8(vqtbl4q_u8(lookup_low, v.val[k]), lookup_high,
+                                        veorq_u8(v.val[k], flip));
+                error = vorrq_u8(error, vorrq_u8(sextets[k], v.val[k]));
+            }
+            if (vmaxvq_u8(error) >= 0x80) {
+                written = 0;
+                return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+            }
+
+            uint8x16x3_t bytes;
+            bytes.val[0] = vorrq_u8(vshlq_n_u8(sextets[0], 2), vshrq_n_u8(sextets[1], 4));
+            bytes.val[1] = vorrq_u8(vshlq_n_u8(sextets[1], 4), vshrq_n_u8(sextets[2], 2));
+            bytes.val[2] = vorrq_u8(vshlq_n_u8(sextets[2], 6), sextets[3]);
+            vst3q_u8(dst + written, bytes);
+            written += 48;
+        }
+    }
+#endif
+
+    ::mystic::types::uint8_t error = 0;
+    for (; i < body; i += 4) {
+        const ::mystic::types::uint8_t a = table[in[i]];
+        const ::mystic::types::uint8_t b = table[in[i + 1]];
+        const ::mystic::types::uint8_t c = table[in[i + 2]];
+        const ::mystic::types::uint8_t d = table[in[i + 3]];
+        error |= static_cast<::mystic::types::uint8_t>(a | b | c | d);
+
+        const ::mystic::types::uint32_t group = (static_cast<::mystic::types::uint32_t>(a) << 18) |
+                                                (static_cast<::mystic::types::uint32_t>(b) << 12) |
+                                                (static_cast<::mystic::types::uint32_t>(c) << 6) |
+                                                static_cast<::mystic::types::uint32_t>(d);
+        dst[written] = static_cast<::mystic::types::uint8_t>(group >> 16);
+        dst[written + 1] = static_cast<::mystic::types::uint8_t>(group >> 8);
+        dst[written + 2] = static_cast<::mystic::types::uint8_t>(group);
+        written += 3;
+    }
+
+    // Final quantum, "xx==", "xxx=", or "xxxx"; padding bits must be zero.
+    const ::mystic::types::uint8_t a = table[in[body]];
+    const ::mystic::types::uint8_t b = table[in[body + 1]];
+    error |= static_cast<::mystic::types::uint8_t>(a | b);
+    dst[written++] = static_cast<::mystic::types::uint8_t>((a << 2) | (b >> 4));
+
+    if (in[body + 2] == '=') {
+        error |= static_cast<::mystic::types::uint8_t>(((in[body + 3] != '=') || ((b & 0x0F) != 0)) ? 0xFF : 0);
+    } else {
+        const ::mystic::types::uint8_t c = table[in[body + 2]];
+        error |= c;
+        dst[written++] = static_cast<::mystic::types::uint8_t>((b << 4) | (c >> 2));
+
+        if (in[body + 3] == '=') {
+            error |= static_cast<::mystic::types::uint8_t>(((c & 0x03) != 0) ? 0xFF : 0);
+        } else {
+            const ::mystic::types::uint8_t d = table[in[body + 3]];
+            error |= d;
+            dst[written++] = static_cast<::mystic::types::uint8_t>((c << 6) | d);
+        }
+    }
+
+    if ((error & 0x80) != 0) {
+        written = 0;
+        return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+    }
+    return ::mystic::status::StatusCode::OK;
+}
+
+} // namespace string_utils
+} // namespace mystic
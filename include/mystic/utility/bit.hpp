@@ -0,0 +1,153 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/utility/bit.hpp
+ * @file bit.hpp
+ * @brief Defines bit manipulation helpers.
+ *
+ * @details
+ * This header provides pre-C++20 equivalents of `<bit>` (count zeros,
+ * population count, power of two rounding), mapped to compiler
+ * intrinsics where available.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/utility/bit.hpp"
+ *
+ * auto first = mystic::bit::countr_zero(mask);
+ * auto ones  = mystic::bit::popcount(mask);
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "mystic/architecture/compiler_detection.hpp"
+#include "mystic/types/standard_int.hpp"
+
+#if (MYSTIC_ARCH_COMPILER == MYSTIC_ARCH_COMPILER_MSVC)
+# include <intrin.h>
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::bit
+ * @brief Bit manipulation helpers.
+ */
+namespace bit {
+
+/**
+ * @brief Number of trailing zero bits, value must be non-zero.
+ */
+inline int countr_zero(::mystic::types::uint64_t value) noexcept {
+#if (MYSTIC_ARCH_COMPILER == MYSTIC_ARCH_COMPILER_MSVC) && defined(_M_X64)
+    unsigned long index = 0;
+    _BitScanForward64(&index, value);
+    return static_cast<int>(index);
+#elif (MYSTIC_ARCH_COMPILER == MYSTIC_ARCH_COMPILER_MSVC)
+    unsigned long index = 0;
+    if (_BitScanForward(&index, static_cast<unsigned long>(value))) {
+        return static_cast<int>(index);
+    }
+    _BitScanForward(&index, static_cast<unsigned long>(value >> 32));
+    return static_cast<int>(index) + 32;
+#else
+    return __builtin_ctzll(value);
+#endif
+}
+
+/**
+ * @brief Number of trailing zero bits, value must be non-zero.
+ */
+inline int countr_zero(::mystic::types::uint32_t value) noexcept {
+#if (MYSTIC_ARCH_COMPILER == MYSTIC_ARCH_COMPILER_MSVC)
+    unsigned long index = 0;
+    _BitScanForward(&index, value);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(value);
+#endif
+}
+
+/**
+ * @brief Number of leading zero bits, value must be non-zero.
+ */
+inline int countl_zero(::mystic::types::uint64_t value) noexcept {
+#if (MYSTIC_ARCH_COMPILER == MYSTIC_ARCH_COMPILER_MSVC) && defined(_M_X64)
+    unsigned long index = 0;
+    _BitScanReverse64(&index, value);
+    return 63 - static_cast<int>(index);
+#elif (MYSTIC_ARCH_COMPILER == MYSTIC_ARCH_COMPILER_MSVC)
+    unsigned long index = 0;
+    if (_BitScanReverse(&index, static_cast<unsigned long>(value >> 32))) {
+        return 31 - static_cast<int>(index);
+    }
+    _BitScanReverse(&index, static_cast<unsigned long>(value));
+    return 63 - static_cast<int>(index);
+#else
+    return __builtin_clzll(value);
+#endif
+}
+
+/**
+ * @brief Number of set bits.
+ */
+inline int popcount(::mystic::types::uint64_t value) noexcept {
+#if (MYSTIC_ARCH_COMPILER == MYSTIC_ARCH_COMPILER_MSVC) && defined(_M_X64)
+    return static_cast<int>(__popcnt64(value));
+#elif (MYSTIC_ARCH_COMPILER == MYSTIC_ARCH_COMPILER_MSVC)
+    return static_cast<int>(__popcnt(static_cast<unsigned int>(value)) +
+                            __popcnt(static_cast<unsigned int>(value >> 32)));
+#else
+    return __builtin_popcountll(value);
+#endif
+}
+
+/**
+ * @brief Smallest power of two not less than value (1 for 0).
+ */
+constexpr inline ::mystic::types::uint64_t bit_ceil(::mystic::types::uint64_t value) noexcept {
+    if (value <= 1) {
+        return 1;
+    }
+    value -= 1;
+    value |= value >> 1;
+    value |= value >> 2;
+    value |= value >> 4;
+    value |= value >> 8;
+    value |= value >> 16;
+    value |= value >> 32;
+    return value + 1;
+}
+
+/**
+ * @brief Returns true if value is a power of two.
+ */
+constexpr inline bool has_single_bit(::mystic::types::uint64_t value) noexcept {
+    return (value != 0) && ((value & (value - 1)) == 0);
+}
+
+} // namespace bit
+} // namespace mystic
@@ -0,0 +1,1142 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/utility/format.hpp
+ * @file format.hpp
+ * @brief Defines compile-time checked format_to engine.
+ *
+ * @details
+ * This header provides `{}`-style formatting into caller supplied
+ * storage, without allocating.
+ *
+ * The format string is parsed once into literal runs, and placeholder
+ * specs. How early it is parsed depends on the standard,
+ * 1. C++20, every string literal is parsed and validated at compile
+ *    time through a consteval constructor.
+ * 2. C++17, literals wrapped in `MYSTIC_FORMAT_STRING()` are parsed,
+ *    and validated at compile time through a template. Plain literals
+ *    are parsed at run time (cheap, single scan).
+ *
+ * Placeholder grammar is `{}` or `{:[[fill]align][#][0][width][.precision][type]}`,
+ * where align is one of `<`, `>`, `^`, and type is one of,
+ * - Integers: `d`, `x`, `X`, `b`, `o`, `c`.
+ * - Floats:   `f`, `e`, `g`.
+ * - Strings:  `s` (precision truncates).
+ * - Pointers: `p`.
+ * Use `{{`, and `}}` for literal braces. Positional arguments are not
+ * supported.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/utility/format.hpp"
+ *
+ * char buffer[256];
+ * auto result = mystic::format_to(buffer, "[{}] {} took {:.3f}ms", level, name, ms);
+ * write(fd, buffer, result.size);
+ *
+ * // Growing string (one append, no allocation if capacity allows).
+ * std::string line;
+ * mystic::format_to(line, "{:>8} | {:#x}", id, flags);
+ *
+ * // C++17 compile time checking.
+ * mystic::format_to(buffer, MYSTIC_FORMAT_STRING("{} {}"), a, b);
+ *
+ * // Run time format strings.
+ * mystic::format_to(buffer, mystic::runtime_format(fmt), a, b);
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "mystic/architecture/standard_detection.hpp"
+#include "mystic/traits/is_constant_evaluated.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/* =============================================
+    Format Spec & Writer
+   --------------------------------------------- */
+
+/**
+ * @brief Parsed placeholder spec.
+ */
+struct FormatSpec {
+    /// Fill character used for padding.
+    char fill = ' ';
+
+    /// Alignment (`<`, `>`, `^`), or 0 for the type's default.
+    char align = 0;
+
+    /// Presentation type, or 0 for the type's default.
+    char type = 0;
+
+    /// `#` was given, i.e., add base prefix.
+    bool alternate = false;
+
+    /// `0` was given, i.e., pad numbers with zeros after sign.
+    bool zero_pad = false;
+
+    /// Minimum field width.
+    ::mystic::types::uint16_t width = 0;
+
+    /// Precision, or -1 if none was given.
+    ::mystic::types::int16_t precision = -1;
+};
+
+/**
+ * @brief Bounded output cursor handed to formatters.
+ *
+ * @details
+ * Writes past the capacity are dropped, but still counted, so the
+ * caller learns the size the full output would have had.
+ */
+class FormatWriter {
+public:
+    constexpr FormatWriter(char* buffer, ::mystic::types::size_t capacity) noexcept
+        : cursor_(buffer), end_(buffer + capacity), size_(0) {}
+
+    /**
+     * @brief Appends `length` bytes.
+     */
+    void write(const char* data, ::mystic::types::size_t length) noexcept {
+        const ::mystic::types::size_t room = static_cast<::mystic::types::size_t>(end_ - cursor_);
+        const ::mystic::types::size_t count = (length < room) ? length : room;
+        if (count != 0) {
+            ::std::memcpy(cursor_, data, count);
+            cursor_ += count;
+        }
+        size_ += length;
+    }
+
+    /**
+     * @brief Appends a string view.
+     */
+    void write(::std::string_view str) noexcept {
+        write(str.data(), str.size());
+    }
+
+    /**
+     * @brief Appends one character.
+     */
+    void put(char c) noexcept {
+        if (cursor_ != end_) {
+            *cursor_++ = c;
+        }
+        ++size_;
+    }
+
+    /**
+     * @brief Appends `count` copies of a character.
+     */
+    void fill(char c, ::mystic::types::size_t count) noexcept {
+        const ::mystic::types::size_t room = static_cast<::mystic::types::size_t>(end_ - cursor_);
+        const ::mystic::types::size_t n = (count < room) ? count : room;
+        if (n != 0) {
+            ::std::memset(cursor_, c, n);
+            cursor_ += n;
+        }
+        size_ += count;
+    }
+
+    /**
+     * @brief Appends a field padded according to a spec.
+     *
+     * @param data The field text.
+     * @param length The field length.
+     * @param spec The placeholder spec.
+     * @param default_align Alignment used when the spec has none.
+     */
+    void write_padded(const char* data, ::mystic::types::size_t length,
+                      const FormatSpec& spec, char default_align) noexcept {
+        if (spec.width <= length) {
+            write(data, length);
+            return;
+        }
+
+        const ::mystic::types::size_t padding = spec.width - length;
+        const char align = (spec.align != 0) ? spec.align : default_align;
+
+        if (align == '>') {
+            fill(spec.fill, padding);
+            write(data, length);
+        } else if (align == '^') {
+            fill(spec.fill, padding / 2);
+            write(data, length);
+            fill(spec.fill, padding - (padding / 2));
+        } else {
+            write(data, length);
+            fill(spec.fill, padding);
+        }
+    }
+
+    /**
+     * @brief Returns the past-the-end pointer of what was written.
+     */
+    char* out() const noexcept {
+        return cursor_;
+    }
+
+    /**
+     * @brief Returns the untruncated output size.
+     */
+    ::mystic::types::size_t size() const noexcept {
+        return size_;
+    }
+
+private:
+    char* cursor_;
+    char* end_;
+    ::mystic::types::size_t size_;
+};
+
+/**
+ * @brief Extension point for user types.
+ *
+ * @details
+ * Specialize with a static function,
+ * `static void format(FormatWriter& out, const T& value, const FormatSpec& spec)`.
+ * Any presentation type letter is accepted for user types, and the
+ * formatter decides what it means.
+ */
+template <typename Type, typename = void>
+struct Formatter;
+
+/**
+ * @brief Result of formatting into bounded storage.
+ */
+struct FormatToResult {
+    /// Past-the-end pointer of what was written.
+    char* out;
+
+    /// Untruncated size, output was truncated if larger than capacity.
+    ::mystic::types::size_t size;
+};
+
+/**
+ * @brief Wrapper for format strings only known at run time.
+ */
+struct RuntimeFormatString {
+    ::std::string_view str;
+};
+
+/**
+ * @brief Marks a format string as only known at run time.
+ *
+ * @details
+ * Such strings skip compile time validation. If invalid, the raw
+ * format text is written instead of the formatted output.
+ */
+constexpr inline RuntimeFormatString runtime_format(::std::string_view str) noexcept {
+    return RuntimeFormatString{str};
+}
+
+/**
+ * @namespace mystic::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/* =============================================
+    Argument Classification
+   --------------------------------------------- */
+
+/**
+ * @brief Argument categories, used to validate specs.
+ */
+enum class FormatArgKind : ::mystic::types::uint8_t {
+    INTEGER,
+    CHAR,
+    BOOL,
+    FLOAT,
+    STRING,
+    POINTER,
+    CUSTOM,
+};
+
+/**
+ * @brief Detects a user Formatter specialization.
+ */
+template <typename Type, typename = void>
+struct has_formatter : ::std::false_type {};
+
+template <typename Type>
+struct has_formatter<Type, ::std::void_t<decltype(sizeof(::mystic::Formatter<Type>))>>
+    : ::std::true_type {};
+
+/**
+ * @brief Maps a (decayed) argument type to its category.
+ */
+template <typename Type>
+constexpr inline FormatArgKind format_arg_kind() noexcept {
+    using T = ::std::remove_cv_t<::std::decay_t<Type>>;
+
+    if constexpr (has_formatter<T>::value) {
+        return FormatArgKind::CUSTOM;
+    } else if constexpr (::std::is_same<T, bool>::value) {
+        return FormatArgKind::BOOL;
+    } else if constexpr (::std::is_same<T, char>::value) {
+        return FormatArgKind::CHAR;
+    } else if constexpr (::std::is_integral<T>::value || ::std::is_enum<T>::value) {
+        return FormatArgKind::INTEGER;
+    } else if constexpr (::std::is_floating_point<T>::value) {
+        return FormatArgKind::FLOAT;
+    } else if constexpr (::std::is_same<T, ::std::nullptr_t>::value) {
+        // Before the string check: nullptr converts to std::string_view, and would be read.
+        return FormatArgKind::POINTER;
+    } else if constexpr (::std::is_same<T, const char*>::value ||
+                         ::std::is_same<T, char*>::value ||
+                         ::std::is_convertible<const T&, ::std::string_view>::value) {
+        return FormatArgKind::STRING;
+    } else if constexpr (::std::is_pointer<T>::value) {
+        return FormatArgKind::POINTER;
+    } else {
+        static_assert(has_formatter<T>::value,
+                      "[Mystic Framework] - Format - No Formatter for this argument type.");
+        return FormatArgKind::CUSTOM;
+    }
+}
+
+/* =============================================
+    Parsing
+   --------------------------------------------- */
+
+/**
+ * @brief One literal run followed by (at most) one placeholder.
+ */
+struct FormatPiece {
+    /// Offset of the literal run in the format string.
+    ::mystic::types::uint32_t offset = 0;
+
+    /// Length of the literal run.
+    ::mystic::types::uint32_t length = 0;
+
+    /// The literal run contains `{{`, or `}}` escapes.
+    bool escaped = false;
+
+    /// Spec of the placeholder following the literal run.
+    FormatSpec spec{};
+};
+
+/**
+ * @brief Returns true if a presentation type is valid for a category.
+ */
+constexpr inline bool is_valid_type(FormatArgKind kind, char type) noexcept {
+    if (type == 0) {
+        return true;
+    }
+
+    switch (kind) {
+        case FormatArgKind::INTEGER:
+            return (type == 'd') || (type == 'x') || (type == 'X') ||
+                   (type == 'b') || (type == 'o') || (type == 'c');
+        case FormatArgKind::CHAR:
+            return (type == 'c') || (type == 'd') || (type == 'x') || (type == 'X');
+        case FormatArgKind::BOOL:
+            return (type == 's') || (type == 'd');
+        case FormatArgKind::FLOAT:
+            return (type == 'f') || (type == 'e') || (type == 'g');
+        case FormatArgKind::STRING:
+            return (type == 's');
+        case FormatArgKind::POINTER:
+            return (type == 'p');
+        case FormatArgKind::CUSTOM:
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Parses a spec (the part after `:`), stops at `}`.
+ *
+ * @returns Error message, or nullptr on success.
+ */
+constexpr inline const char* parse_spec(::std::string_view str, ::mystic::types::size_t& i,
+                                        FormatSpec& spec, FormatArgKind kind) noexcept {
+    const auto is_align = [](char c) { return (c == '<') || (c == '>') || (c == '^'); };
+    const auto is_digit = [](char c) { return (c >= '0') && (c <= '9'); };
+
+    if ((i + 1 < str.size()) && is_align(str[i + 1]) && (str[i] != '}')) {
+        spec.fill = str[i];
+        spec.align = str[i + 1];
+        i += 2;
+    } else if ((i < str.size()) && is_align(str[i])) {
+        spec.align = str[i];
+        i += 1;
+    }
+
+    if ((i < str.size()) && (str[i] == '#')) {
+        spec.alternate = true;
+        ++i;
+    }
+
+    if ((i < str.size()) && (str[i] == '0')) {
+        spec.zero_pad = true;
+        ++i;
+    }
+
+    ::mystic::types::uint32_t width = 0;
+    while ((i < str.size()) && is_digit(str[i])) {
+        width = (width * 10) + static_cast<::mystic::types::uint32_t>(str[i] - '0');
+        if (width > 0xFFFF) {
+            return "width is too large";
+        }
+        ++i;
+    }
+    spec.width = static_cast<::mystic::types::uint16_t>(width);
+
+    if ((i < str.size()) && (str[i] == '.')) {
+        ++i;
+        if ((i >= str.size()) || !is_digit(str[i])) {
+            return "missing precision after '.'";
+        }
+        ::mystic::types::int32_t precision = 0;
+        while ((i < str.size()) && is_digit(str[i])) {
+            precision = (precision * 10) + (str[i] - '0');
+            if (precision > 0x7FFF) {
+                return "precision is too large";
+            }
+            ++i;
+        }
+        spec.precision = static_cast<::mystic::types::int16_t>(precision);
+
+        if ((kind != FormatArgKind::FLOAT) && (kind != FormatArgKind::STRING) &&
+            (kind != FormatArgKind::CUSTOM)) {
+            return "precision is only valid for floats, and strings";
+        }
+    }
+
+    if ((i < str.size()) && (str[i] != '}')) {
+        spec.type = str[i];
+        ++i;
+        if (!is_valid_type(kind, spec.type)) {
+            return "presentation type is not valid for the argument";
+        }
+    }
+
+    if ((i >= str.size()) || (str[i] != '}')) {
+        return "expected '}' at end of placeholder";
+    }
+    ++i;
+    return nullptr;
+}
+
+/**
+ * @brief Returns the index of the next `{` or `}` at or after `i`, or `size`.
+ *
+ * @details
+ * At run time, 8 bytes are tested at once (SWAR), as literal runs are
+ * usually much longer than placeholders.
+ */
+constexpr inline ::mystic::types::size_t find_brace(const char* data, ::mystic::types::size_t i,
+                                                    ::mystic::types::size_t size) noexcept {
+    if (!::mystic::traits::is_constant_evaluated()) {
+        constexpr ::mystic::types::uint64_t kOnes  = 0x0101010101010101ULL;
+        constexpr ::mystic::types::uint64_t kHighs = 0x8080808080808080ULL;
+
+        while (i + 8 <= size) {
+            ::mystic::types::uint64_t word = 0;
+            ::std::memcpy(&word, data + i, sizeof(word));
+
+            const ::mystic::types::uint64_t open  = word ^ (kOnes * static_cast<unsigned char>('{'));
+            const ::mystic::types::uint64_t close = word ^ (kOnes * static_cast<unsigned char>('}'));
+            if ((((open - kOnes) & ~open) | ((close - kOnes) & ~close)) & kHighs) {
+                break;
+            }
+            i += 8;
+        }
+    }
+
+    while ((i < size) && (data[i] != '{') && (data[i] != '}')) {
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * @brief Parses a format string into pieces.
+ *
+ * @param str The format string.
+ * @param kinds Categories of the arguments.
+ * @param pieces Output, must hold `arg_count + 1` pieces.
+ * @param arg_count Number of arguments.
+ *
+ * @returns Error message, or nullptr on success.
+ */
+constexpr inline const char* parse_format(::std::string_view str, const FormatArgKind* kinds,
+                                          FormatPiece* pieces,
+                                          ::mystic::types::size_t arg_count) noexcept {
+    if (str.size() > 0xFFFFFFFFULL) {
+        return "format string is too long";
+    }
+
+    ::mystic::types::size_t count = 0;
+    ::mystic::types::size_t start = 0;
+    bool escaped = false;
+    ::mystic::types::size_t i = 0;
+
+    while (true) {
+        i = find_brace(str.data(), i, str.size());
+        if (i >= str.size()) {
+            break;
+        }
+        const char c = str[i];
+
+        if (c == '{') {
+            if ((i + 1 < str.size()) && (str[i + 1] == '{')) {
+                escaped = true;
+                i += 2;
+                continue;
+            }
+
+            if (count >= arg_count) {
+                return "more placeholders than arguments";
+            }
+
+            FormatPiece& piece = pieces[count];
+            piece.offset = static_cast<::mystic::types::uint32_t>(start);
+            piece.length = static_cast<::mystic::types::uint32_t>(i - start);
+            piece.escaped = escaped;
+            piece.spec = FormatSpec{};
+
+            ++i;
+            if ((i < str.size()) && (str[i] == ':')) {
+                ++i;
+                const char* error = parse_spec(str, i, piece.spec, kinds[count]);
+                if (error != nullptr) {
+                    return error;
+                }
+            } else if ((i < str.size()) && (str[i] == '}')) {
+                ++i;
+            } else {
+                return "positional, or malformed placeholder";
+            }
+
+            ++count;
+            start = i;
+            escaped = false;
+        } else {
+            if ((i + 1 < str.size()) && (str[i + 1] == '}')) {
+                escaped = true;
+                i += 2;
+                continue;
+            }
+            return "unmatched '}' in format string";
+        }
+    }
+
+    if (count != arg_count) {
+        return "fewer placeholders than arguments";
+    }
+
+    FormatPiece& last = pieces[count];
+    last.offset = static_cast<::mystic::types::uint32_t>(start);
+    last.length = static_cast<::mystic::types::uint32_t>(str.size() - start);
+    last.escaped = escaped;
+    last.spec = FormatSpec{};
+    return nullptr;
+}
+
+/**
+ * @brief Called during constant evaluation to report an invalid format string.
+ *
+ * @details
+ * Not constexpr on purpose, reaching it at compile time is an error
+ * whose diagnostic points here.
+ */
+inline void invalid_format_string(const char* /* message */) noexcept {}
+
+/**
+ * @brief Base of literal wrappers made by MYSTIC_FORMAT_STRING().
+ */
+struct CompileTimeFormatLiteral {};
+
+/**
+ * @brief Parse result of a compile-time literal (C++17 template path).
+ */
+template <::mystic::types::size_t N>
+struct ParsedFormat {
+    FormatPiece pieces[N + 1]{};
+    const char* error = nullptr;
+};
+
+/**
+ * @brief Parses a compile-time literal for a given argument list.
+ */
+template <typename Literal, typename... Args>
+constexpr inline ParsedFormat<sizeof...(Args)> parse_literal() noexcept {
+    constexpr FormatArgKind kinds[sizeof...(Args) + 1] = {format_arg_kind<Args>()...,
+                                                         FormatArgKind::CUSTOM};
+    ParsedFormat<sizeof...(Args)> parsed{};
+    parsed.error = parse_format(Literal::value(), kinds, parsed.pieces, sizeof...(Args));
+    return parsed;
+}
+
+/**
+ * @brief Holds the parse result of a literal as a constant.
+ */
+template <typename Literal, typename... Args>
+struct ParsedLiteral {
+    static constexpr ParsedFormat<sizeof...(Args)> value = parse_literal<Literal, Args...>();
+};
+
+/**
+ * @brief Identity alias, blocks template argument deduction.
+ */
+template <typename Type>
+struct type_identity {
+    using type = Type;
+};
+
+template <typename Type>
+using type_identity_t = typename type_identity<Type>::type;
+
+} // namespace internal
+
+/* =============================================
+    Format String
+   --------------------------------------------- */
+
+/**
+ * @brief Pre-parsed format string for a given argument list.
+ */
+template <typename... Args>
+class BasicFormatString {
+public:
+    static constexpr ::mystic::types::size_t kArgCount = sizeof...(Args);
+
+#if (MYSTIC_ARCH_STANDARD >= MYSTIC_ARCH_STANDARD_CPP20) && defined(__cpp_consteval)
+    /**
+     * @brief Parses, and validates a format string at compile time.
+     */
+    template <typename String,
+              typename = ::std::enable_if_t<::std::is_convertible<const String&, ::std::string_view>::value &&
+                                            !::std::is_base_of<internal::CompileTimeFormatLiteral, String>::value>>
+    consteval BasicFormatString(const String& str) noexcept {
+        parse(::std::string_view(str));
+        if (error_ != nullptr) {
+            internal::invalid_format_string(error_);
+        }
+    }
+#else
+    /**
+     * @brief Parses a format string (at run time, unless in a constant expression).
+     */
+    template <typename String,
+              typename = ::std::enable_if_t<::std::is_convertible<const String&, ::std::string_view>::value &&
+                                            !::std::is_base_of<internal::CompileTimeFormatLiteral, String>::value>>
+    constexpr BasicFormatString(const String& str) noexcept {
+        parse(::std::string_view(str));
+    }
+#endif
+
+    /**
+     * @brief Takes the compile time parse of a MYSTIC_FORMAT_STRING() literal.
+     */
+    template <typename Literal,
+              typename = ::std::enable_if_t<::std::is_base_of<internal::CompileTimeFormatLiteral, Literal>::value>,
+              typename = void>
+    constexpr BasicFormatString(Literal) noexcept : str_(Literal::value()) {
+        constexpr const auto& parsed = internal::ParsedLiteral<Literal, Args...>::value;
+        static_assert(parsed.error == nullptr,
+                      "[Mystic Framework] - Format - Invalid format string for the given arguments.");
+        for (::mystic::types::size_t i = 0; i <= kArgCount; ++i) {
+            pieces_[i] = parsed.pieces[i];
+        }
+    }
+
+    /**
+     * @brief Parses a run time format string.
+     */
+    constexpr BasicFormatString(RuntimeFormatString str) noexcept {
+        parse(str.str);
+    }
+
+    /**
+     * @brief Returns the raw format string.
+     */
+    constexpr ::std::string_view get() const noexcept {
+        return str_;
+    }
+
+    /**
+     * @brief Returns the parse error, or nullptr if valid.
+     */
+    constexpr const char* error() const noexcept {
+        return error_;
+    }
+
+    /**
+     * @brief Returns the piece at index (kArgCount + 1 pieces).
+     */
+    constexpr const internal::FormatPiece& piece(::mystic::types::size_t index) const noexcept {
+        return pieces_[index];
+    }
+
+private:
+    constexpr void parse(::std::string_view str) noexcept {
+        constexpr internal::FormatArgKind kinds[kArgCount + 1] = {internal::format_arg_kind<Args>()...,
+                                                                 internal::FormatArgKind::CUSTOM};
+        str_ = str;
+        error_ = internal::parse_format(str, kinds, pieces_, kArgCount);
+    }
+
+    ::std::string_view str_{};
+    const char* error_ = nullptr;
+    internal::FormatPiece pieces_[kArgCount + 1]{};
+};
+
+/**
+ * @brief Format string type, arguments are not deduced from it.
+ */
+template <typename... Args>
+using FormatString = BasicFormatString<internal::type_identity_t<Args>...>;
+
+/**
+ * @macro MYSTIC_FORMAT_STRING(literal)
+ * @brief Wraps a string literal so it is parsed, and validated at compile
+ * time even before C++20.
+ */
+#define MYSTIC_FORMAT_STRING(literal)                                                   \
+    ([] {                                                                               \
+        struct MysticFormatLiteral : ::mystic::internal::CompileTimeFormatLiteral {     \
+            static constexpr ::std::string_view value() noexcept { return literal; }    \
+        };                                                                              \
+        return MysticFormatLiteral{};                                                   \
+    }())
+
+/* =============================================
+    Argument Formatting
+   --------------------------------------------- */
+
+namespace internal {
+
+/**
+ * @brief Buffer size large enough for any integer in any base, plus prefix.
+ */
+constexpr inline ::mystic::types::size_t kIntegerBufferSize = 72;
+
+/**
+ * @brief Stack buffer size for floats; longer output is formatted on the heap.
+ */
+constexpr inline ::mystic::types::size_t kFloatBufferSize = 128;
+
+/**
+ * @brief Writes a number with sign, prefix, and padding.
+ */
+inline void write_number(FormatWriter& out, bool negative, const char* prefix,
+                         ::mystic::types::size_t prefix_length, const char* digits,
+                         ::mystic::types::size_t length, const FormatSpec& spec) noexcept {
+    const ::mystic::types::size_t total = (negative ? 1 : 0) + prefix_length + length;
+
+    if (spec.zero_pad && (spec.align == 0) && (spec.width > total)) {
+        if (negative) {
+            out.put('-');
+        }
+        out.write(prefix, prefix_length);
+        out.fill('0', spec.width - total);
+        out.write(digits, length);
+        return;
+    }
+
+    const ::mystic::types::size_t padding = (spec.width > total) ? spec.width - total : 0;
+    const char align = (spec.align != 0) ? spec.align : '>';
+    const ::mystic::types::size_t before = (align == '>') ? padding : (align == '^') ? padding / 2 : 0;
+
+    out.fill(spec.fill, before);
+    if (negative) {
+        out.put('-');
+    }
+    out.write(prefix, prefix_length);
+    out.write(digits, length);
+    out.fill(spec.fill, padding - before);
+}
+
+/**
+ * @brief Formats an integer.
+ */
+template <typename Integer>
+inline void format_integer(FormatWriter& out, Integer value, const FormatSpec& spec) noexcept {
+    using Unsigned = ::std::make_unsigned_t<Integer>;
+
+    if (spec.type == 'c') {
+        const char c = static_cast<char>(value);
+        out.write_padded(&c, 1, spec, '<');
+        return;
+    }
+
+    const bool negative = ::std::is_signed<Integer>::value && (value < 0);
+    const Unsigned magnitude = negative ? static_cast<Unsigned>(Unsigned(0) - static_cast<Unsigned>(value))
+                                        : static_cast<Unsigned>(value);
+
+    int base = 10;
+    const char* prefix = "";
+    ::mystic::types::size_t prefix_length = 0;
+
+    switch (spec.type) {
+        case 'x':
+            base = 16;
+            prefix = "0x";
+            break;
+        case 'X':
+            base = 16;
+            prefix = "0X";
+            break;
+        case 'b':
+            base = 2;
+            prefix = "0b";
+            break;
+        case 'o':
+            base = 8;
+            prefix = "0";
+            break;
+        default:
+            break;
+    }
+    if (spec.alternate && (base != 10)) {
+        prefix_length = (base == 8) ? 1 : 2;
+    }
+
+    char digits[kIntegerBufferSize];
+    const auto result = ::std::to_chars(digits, digits + sizeof(digits), magnitude, base);
+    const ::mystic::types::size_t length = static_cast<::mystic::types::size_t>(result.ptr - digits);
+
+    if (spec.type == 'X') {
+        for (::mystic::types::size_t i = 0; i < length; ++i) {
+            if ((digits[i] >= 'a') && (digits[i] <= 'f')) {
+                digits[i] = static_cast<char>(digits[i] - ('a' - 'A'));
+            }
+        }
+    }
+
+    if ((spec.width == 0) && !negative && (prefix_length == 0)) {
+        out.write(digits, length);
+        return;
+    }
+
+    write_number(out, negative, prefix, prefix_length, digits, length, spec);
+}
+
+/**
+ * @brief Writes a floating point value into `[first, last)`.
+ *
+ * @returns The length written, or 0 if the output does not fit.
+ */
+template <typename Float>
+inline ::mystic::types::size_t float_chars(char* first, char* last, Float value, const FormatSpec& spec) noexcept {
+#if defined(__cpp_lib_to_chars)
+    ::std::to_chars_result result{};
+    if (spec.precision < 0) {
+        switch (spec.type) {
+            case 'f':
+                result = ::std::to_chars(first, last, value, ::std::chars_format::fixed);
+                break;
+            case 'e':
+                result = ::std::to_chars(first, last, value, ::std::chars_format::scientific);
+                break;
+            default:
+                result = ::std::to_chars(first, last, value);
+                break;
+        }
+    } else {
+        const ::std::chars_format format = (spec.type == 'e') ? ::std::chars_format::scientific
+                                         : (spec.type == 'g') ? ::std::chars_format::general
+                                                              : ::std::chars_format::fixed;
+        result = ::std::to_chars(first, last, value, format, spec.precision);
+    }
+    return (result.ec == ::std::errc{}) ? static_cast<::mystic::types::size_t>(result.ptr - first) : 0;
+#else
+    char format[8] = {'%', '.', '*', 'L', 'g', '\0'};
+    format[4] = (spec.type == 'f') ? 'f' : (spec.type == 'e') ? 'e' : 'g';
+    const int precision = (spec.precision >= 0) ? spec.precision : ((spec.type == 0) ? 17 : 6);
+    const ::mystic::types::size_t room = static_cast<::mystic::types::size_t>(last - first);
+    const int written = ::std::snprintf(first, room, format, precision, static_cast<long double>(value));
+    // snprintf needs a byte for its terminator, so a full buffer does not fit.
+    return ((written > 0) && (static_cast<::mystic::types::size_t>(written) < room))
+               ? static_cast<::mystic::types::size_t>(written)
+               : 0;
+#endif
+}
+
+/**
+ * @brief Writes formatted float text, padded according to a spec.
+ */
+inline void write_float(FormatWriter& out, const char* text, ::mystic::types::size_t length,
+                        const FormatSpec& spec) noexcept {
+    if ((spec.width == 0) && (spec.align == 0)) {
+        out.write(text, length);
+        return;
+    }
+    const bool negative = (length != 0) && (text[0] == '-');
+    write_number(out, negative, "", 0, text + (negative ? 1 : 0), length - (negative ? 1 : 0), spec);
+}
+
+/**
+ * @brief Formats a floating point value.
+ *
+ * @details
+ * Output is never truncated: what does not fit on the stack (`{:f}` of
+ * 1e300, or `{:.1000f}`) is formatted into a growing heap buffer. Only
+ * if that allocation fails is the value written in shortest scientific
+ * form instead, which always fits.
+ */
+template <typename Float>
+inline void format_float(FormatWriter& out, Float value, const FormatSpec& spec) noexcept {
+    char buffer[kFloatBufferSize];
+    ::mystic::types::size_t length = float_chars(buffer, buffer + sizeof(buffer), value, spec);
+    if (length != 0) {
+        write_float(out, buffer, length, spec);
+        return;
+    }
+
+    for (::mystic::types::size_t capacity = sizeof(buffer) * 4;; capacity *= 2) {
+        const ::std::unique_ptr<char[]> heap(new (::std::nothrow) char[capacity]);
+        if (heap == nullptr) {
+            break;
+        }
+        length = float_chars(heap.get(), heap.get() + capacity, value, spec);
+        if (length != 0) {
+            write_float(out, heap.get(), length, spec);
+            return;
+        }
+    }
+
+    FormatSpec scientific = spec;
+    scientific.type = 'e';
+    scientific.precision = -1;
+    length = float_chars(buffer, buffer + sizeof(buffer), value, scientific);
+    write_float(out, buffer, length, spec);
+}
+
+/**
+ * @brief Formats a string.
+ */
+inline void format_string(FormatWriter& out, ::std::string_view value, const FormatSpec& spec) noexcept {
+    if ((spec.precision >= 0) && (static_cast<::mystic::types::size_t>(spec.precision) < value.size())) {
+        value = value.substr(0, static_cast<::mystic::types::size_t>(spec.precision));
+    }
+    out.write_padded(value.data(), value.size(), spec, '<');
+}
+
+/**
+ * @brief Formats one argument according to its category.
+ */
+template <typename Type>
+inline void format_arg(FormatWriter& out, const Type& value, const FormatSpec& spec) noexcept {
+    using T = ::std::remove_cv_t<::std::decay_t<Type>>;
+    constexpr FormatArgKind kind = format_arg_kind<Type>();
+
+    if constexpr (kind == FormatArgKind::CUSTOM) {
+        ::mystic::Formatter<T>::format(out, value, spec);
+    } else if constexpr (kind == FormatArgKind::BOOL) {
+        if (spec.type == 'd') {
+            format_integer(out, static_cast<int>(value), spec);
+        } else {
+            format_string(out, value ? ::std::string_view("true") : ::std::string_view("false"), spec);
+        }
+    } else if constexpr (kind == FormatArgKind::CHAR) {
+        if ((spec.type == 0) || (spec.type == 'c')) {
+            out.write_padded(&value, 1, spec, '<');
+        } else {
+            format_integer(out, static_cast<unsigned char>(value), spec);
+        }
+    } else if constexpr (kind == FormatArgKind::INTEGER) {
+        if constexpr (::std::is_enum<T>::value) {
+            format_integer(out, static_cast<::std::underlying_type_t<T>>(value), spec);
+        } else {
+            format_integer(out, value, spec);
+        }
+    } else if constexpr (kind == FormatArgKind::FLOAT) {
+        format_float(out, value, spec);
+    } else if constexpr (kind == FormatArgKind::STRING) {
+        if constexpr (::std::is_pointer<T>::value) {
+            format_string(out, (value != nullptr) ? ::std::string_view(value) : ::std::string_view("(null)"), spec);
+        } else {
+            format_string(out, ::std::string_view(value), spec);
+        }
+    } else {
+        FormatSpec pointer_spec = spec;
+        pointer_spec.type = 'x';
+        pointer_spec.alternate = true;
+        format_integer(out, reinterpret_cast<::mystic::types::uintptr_t>(static_cast<const void*>(value)),
+                       pointer_spec);
+    }
+}
+
+/**
+ * @brief Writes a literal run, unescaping `{{`, and `}}` if needed.
+ */
+inline void write_literal(FormatWriter& out, ::std::string_view str, const FormatPiece& piece) noexcept {
+    const char* data = str.data() + piece.offset;
+
+    if (!piece.escaped) {
+        out.write(data, piece.length);
+        return;
+    }
+
+    ::mystic::types::size_t start = 0;
+    for (::mystic::types::size_t i = 0; i < piece.length; ++i) {
+        if ((data[i] == '{') || (data[i] == '}')) {
+            out.write(data + start, i + 1 - start);
+            ++i;
+            start = i + 1;
+        }
+    }
+    out.write(data + start, piece.length - start);
+}
+
+/**
+ * @brief Formats all arguments into a writer.
+ */
+template <typename... FormatArgs, typename... Args, ::mystic::types::size_t... Index>
+inline void format_all(FormatWriter& out, const BasicFormatString<FormatArgs...>& fmt,
+                       ::std::index_sequence<Index...>, const Args&... args) noexcept {
+    if (fmt.error() != nullptr) {
+        out.write(fmt.get());
+        return;
+    }
+
+    (..., (write_literal(out, fmt.get(), fmt.piece(Index)),
+           format_arg(out, args, fmt.piece(Index).spec)));
+
+    write_literal(out, fmt.get(), fmt.piece(sizeof...(Args)));
+}
+
+/**
+ * @brief Detects growable string types (`append`, `resize`, `data`).
+ */
+template <typename String, typename = void>
+struct is_growable_string : ::std::false_type {};
+
+template <typename String>
+struct is_growable_string<String, ::std::void_t<
+    decltype(::std::declval<String&>().append(static_cast<const char*>(nullptr), ::mystic::types::size_t{})),
+    decltype(::std::declval<String&>().resize(::mystic::types::size_t{})),
+    decltype(::std::declval<String&>().size()),
+    decltype(::std::declval<String&>().data())>> : ::std::true_type {};
+
+/**
+ * @brief Stack buffer size tried before growing the string directly.
+ */
+constexpr inline ::mystic::types::size_t kInlineFormatCapacity = 512;
+
+} // namespace internal
+
+/* =============================================
+    Public Interface
+   --------------------------------------------- */
+
+/**
+ * @brief Formats into a bounded buffer.
+ *
+ * @param buffer The output buffer.
+ * @param capacity Capacity of the output buffer.
+ * @param fmt The format string.
+ * @param args The arguments.
+ *
+ * @returns Past-the-end pointer, and untruncated size. No null
+ * terminator is written.
+ */
+template <typename... Args>
+inline FormatToResult format_to_n(char* buffer, ::mystic::types::size_t capacity,
+                                  FormatString<Args...> fmt, const Args&... args) noexcept {
+    FormatWriter out(buffer, capacity);
+    internal::format_all(out, fmt, ::std::index_sequence_for<Args...>{}, args...);
+    return FormatToResult{out.out(), out.size()};
+}
+
+/**
+ * @brief Formats into a fixed array.
+ *
+ * @param buffer The output array.
+ * @param fmt The format string.
+ * @param args The arguments.
+ *
+ * @returns Past-the-end pointer, and untruncated size. No null
+ * terminator is written.
+ */
+template <::mystic::types::size_t N, typename... Args>
+inline FormatToResult format_to(char (&buffer)[N], FormatString<Args...> fmt,
+                                const Args&... args) noexcept {
+    FormatWriter out(buffer, N);
+    internal::format_all(out, fmt, ::std::index_sequence_for<Args...>{}, args...);
+    return FormatToResult{out.out(), out.size()};
+}
+
+/**
+ * @brief Appends formatted output to a growable string.
+ *
+ * @details
+ * Output is first formatted on the stack, then appended at once, so
+ * the string grows at most one time. Records longer than the stack
+ * buffer are formatted a second time, directly into the string.
+ *
+ * @param str The string to append to (e.g. `::mystic::string`).
+ * @param fmt The format string.
+ * @param args The arguments.
+ *
+ * @returns Number of appended characters.
+ */
+template <typename String, typename... Args,
+          typename = ::std::enable_if_t<internal::is_growable_string<String>::value>>
+inline ::mystic::types::size_t format_to(String& str, FormatString<Args...> fmt, const Args&... args) {
+    char buffer[internal::kInlineFormatCapacity];
+    FormatWriter out(buffer, sizeof(buffer));
+    internal::format_all(out, fmt, ::std::index_sequence_for<Args...>{}, args...);
+
+    const ::mystic::types::size_t size = out.size();
+    if (size <= sizeof(buffer)) {
+        str.append(buffer, size);
+        return size;
+    }
+
+    const ::mystic::types::size_t old_size = str.size();
+    str.resize(old_size + size);
+    FormatWriter direct(&str.data()[old_size], size);
+    internal::format_all(direct, fmt, ::std::index_sequence_for<Args...>{}, args...);
+    return size;
+}
+
+/**
+ * @brief Returns the size of the formatted output, without writing it.
+ */
+template <typename... Args>
+inline ::mystic::types::size_t formatted_size(FormatString<Args...> fmt, const Args&... args) noexcept {
+    FormatWriter out(nullptr, 0);
+    internal::format_all(out, fmt, ::std::index_sequence_for<Args...>{}, args...);
+    return out.size();
+}
+
+} // namespace mystic
@@ -0,0 +1,269 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/utility/hex.hpp
+ * @file hex.hpp
+ * @brief Defines vectorized hex encoding, and decoding.
+ *
+ * @details
+ * This header provides hex (base16) encoding, and strictly validated
+ * decoding over byte ranges. AVX2 handles 32 characters per step, and
+ * NEON 16, using nibble table lookups; other targets use scalar tables.
+ *
+ * Decoding accepts both upper, and lower case digits, and reports
+ * `StatusCode::INVALID_ARGUMENT` for odd lengths, or non-hex characters.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/utility/hex.hpp"
+ *
+ * char text[mystic::string_utils::hex_encoded_size(16)];
+ * mystic::string_utils::hex_encode(trace_id, 16, text);
+ *
+ * mystic::types::byte id[16];
+ * if (mystic::string_utils::hex_decode(header, id) != mystic::status::StatusCode::OK) {
+ *     // Reject the header.
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <string_view>
+
+#include "mystic/architecture/simd_detection.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+#if MYSTIC_ARCH_SIMD_HAS_AVX2
+# include <immintrin.h>
+#elif MYSTIC_ARCH_SIMD_HAS_NEON
+# include <arm_neon.h>
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::string_utils
+ * @brief String utility functions.
+ */
+namespace string_utils {
+
+/**
+ * @namespace mystic::string_utils::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/// Lower case hex digits.
+inline constexpr char kHexLower[] = "0123456789abcdef";
+
+/// Upper case hex digits.
+inline constexpr char kHexUpper[] = "0123456789ABCDEF";
+
+/**
+ * @brief Returns the value of a hex digit, or 0xFF if it is not one.
+ */
+constexpr inline ::mystic::types::uint8_t hex_digit_value(unsigned char c) noexcept {
+    return ((c >= '0') && (c <= '9')) ? static_cast<::mystic::types::uint8_t>(c - '0')
+         : ((c >= 'a') && (c <= 'f')) ? static_cast<::mystic::types::uint8_t>(c - 'a' + 10)
+         : ((c >= 'A') && (c <= 'F')) ? static_cast<::mystic::types::uint8_t>(c - 'A' + 10)
+                                      : static_cast<::mystic::types::uint8_t>(0xFF);
+}
+
+/**
+ * @brief Character to digit value table, 0xFF marks non-hex characters.
+ */
+struct HexDecodeTable {
+    ::mystic::types::uint8_t values[256];
+
+    constexpr HexDecodeTable() noexcept : values() {
+        for (int i = 0; i < 256; ++i) {
+            values[i] = hex_digit_value(static_cast<unsigned char>(i));
+        }
+    }
+};
+
+/// Shared decode table.
+inline constexpr HexDecodeTable kHexDecodeTable{};
+
+} // namespace internal
+
+/**
+ * @brief Encoded size of `size` bytes.
+ */
+constexpr inline ::mystic::types::size_t hex_encoded_size(::mystic::types::size_t size) noexcept {
+    return size * 2;
+}
+
+/**
+ * @brief Decoded size of `size` hex characters.
+ */
+constexpr inline ::mystic::types::size_t hex_decoded_size(::mystic::types::size_t size) noexcept {
+    return size / 2;
+}
+
+/**
+ * @brief Encodes bytes as hex.
+ *
+ * @param data The given bytes.
+ * @param size Number of bytes.
+ * @param out Destination of at least `hex_encoded_size(size)` characters.
+ * @param uppercase Use `A-F` instead of `a-f`.
+ */
+inline void hex_encode(const ::mystic::types::byte* data, ::mystic::types::size_t size,
+                       char* out, bool uppercase = false) noexcept {
+    const auto* in = reinterpret_cast<const ::mystic::types::uint8_t*>(data);
+    const char* digits = uppercase ? internal::kHexUpper : internal::kHexLower;
+    ::mystic::types::size_t i = 0;
+
+#if MYSTIC_ARCH_SIMD_HAS_AVX2
+    const __m256i table = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits)));
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+
+    for (; i + 32 <= size; i += 32) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        const __m256i hi = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+        const __m256i lo = _mm256_shuffle_epi8(table, _mm256_and_si256(v, nibble));
+
+        // Unpacking is per 128-bit lane, so swap the middle halves back.
+        const __m256i first = _mm256_unpacklo_epi8(hi, lo);
+        const __m256i second = _mm256_unpackhi_epi8(hi, lo);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i),
+                            _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i + 32),
+                            _mm256_permute2x128_si256(first, second, 0x31));
+    }
+#elif MYSTIC_ARCH_SIMD_HAS_NEON
+    const uint8x16_t table = vld1q_u8(reinterpret_cast<const ::mystic::types::uint8_t*>(digits));
+
+    for (; i + 16 <= size; i += 16) {
+        const uint8x16_t v = vld1q_u8(in + i);
+        uint8x16x2_t pair;
+        pair.val[0] = vqtbl1q_u8(table, vshrq_n_u8(v, 4));
+        pair.val[1] = vqtbl1q_u8(table, vandq_u8(v, vdupq_n_u8(0x0F)));
+        vst2q_u8(reinterpret_cast<::mystic::types::uint8_t*>(out + 2 * i), pair);
+    }
+#endif
+
+    for (; i < size; ++i) {
+        out[2 * i] = digits[in[i] >> 4];
+        out[2 * i + 1] = digits[in[i] & 0x0F];
+    }
+}
+
+/**
+ * @brief Decodes hex into bytes.
+ *
+ * @param text The hex text, of even length.
+ * @param out Destination of at least `hex_decoded_size(text.size())` bytes.
+ *
+ * @returns `StatusCode::OK`, or `StatusCode::INVALID_ARGUMENT` if the text
+ * has odd length, or a non-hex character (the output is then unspecified).
+ */
+inline ::mystic::status::StatusCode hex_decode(::std::string_view text, ::mystic::types::byte* out) noexcept {
+    if ((text.size() % 2) != 0) {
+        return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+    }
+
+    const auto* in = reinterpret_cast<const ::mystic::types::uint8_t*>(text.data());
+    auto* dst = reinterpret_cast<::mystic::types::uint8_t*>(out);
+    const ::mystic::types::size_t size = text.size();
+    ::mystic::types::size_t i = 0;
+
+#if MYSTIC_ARCH_SIMD_HAS_AVX2
+    const __m256i zero_char = _mm256_set1_epi8('0');
+    const __m256i a_char = _mm256_set1_epi8('a');
+    const __m256i case_bit = _mm256_set1_epi8(0x20);
+    const __m256i nine = _mm256_set1_epi8(9);
+    const __m256i five = _mm256_set1_epi8(5);
+    const __m256i ten = _mm256_set1_epi8(10);
+    // Pairs of (high, low) digits into `high * 16 + low`.
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+
+    for (; i + 32 <= size; i += 32) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+
+        // Unsigned range checks, x <= n <=> min(x, n) == x.
+        const __m256i digit = _mm256_sub_epi8(v, zero_char);
+        const __m256i letter = _mm256_sub_epi8(_mm256_or_si256(v, case_bit), a_char);
+        const __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, nine), digit);
+        const __m256i is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, five), letter);
+
+        if (_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_letter)) != -1) {
+            return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+        }
+
+        const __m256i values = _mm256_or_si256(_mm256_and_si256(is_digit, digit),
+                                               _mm256_and_si256(is_letter, _mm256_add_epi8(letter, ten)));
+        const __m256i words = _mm256_maddubs_epi16(values, weights);
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(words, words), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i / 2), _mm256_castsi256_si128(packed));
+    }
+#elif MYSTIC_ARCH_SIMD_HAS_NEON
+    const uint8x16_t zero_char = vdupq_n_u8('0');
+    const uint8x16_t a_char = vdupq_n_u8('a');
+    const uint8x16_t case_bit = vdupq_n_u8(0x20);
+    const uint8x16_t ten = vdupq_n_u8(10);
+    const uint8x16_t six = vdupq_n_u8(6);
+
+    for (; i + 32 <= size; i += 32) {
+        const uint8x16x2_t v = vld2q_u8(in + i);
+        uint8x16_t nibbles[2];
+        uint8x16_t valid = vdupq_n_u8(0xFF);
+
+        for (int k = 0; k < 2; ++k) {
+            const uint8x16_t digit = vsubq_u8(v.val[k], zero_char);
+            const uint8x16_t letter = vsubq_u8(vorrq_u8(v.val[k], case_bit), a_char);
+            const uint8x16_t is_digit = vcltq_u8(digit, ten);
+            const uint8x16_t is_letter = vcltq_u8(letter, six);
+            valid = vandq_u8(valid, vorrq_u8(is_digit, is_letter));
+            nibbles[k] = vorrq_u8(vandq_u8(is_digit, digit),
+                                  vandq_u8(is_letter, vaddq_u8(letter, ten)));
+        }
+
+        if (vminvq_u8(valid) != 0xFF) {
+            return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+        }
+        vst1q_u8(dst + i / 2, vorrq_u8(vshlq_n_u8(nibbles[0], 4), nibbles[1]));
+    }
+#endif
+
+    ::mystic::types::uint8_t error = 0;
+    for (; i < size; i += 2) {
+        const ::mystic::types::uint8_t hi = internal::kHexDecodeTable.values[in[i]];
+        const ::mystic::types::uint8_t lo = internal::kHexDecodeTable.values[in[i + 1]];
+        error |= static_cast<::mystic::types::uint8_t>(hi | lo);
+        dst[i / 2] = static_cast<::mystic::types::uint8_t>((hi << 4) | (lo & 0x0F));
+    }
+
+    return ((error & 0xF0) != 0) ? ::mystic::status::StatusCode::INVALID_ARGUMENT
+                                 : ::mystic::status::StatusCode::OK;
+}
+
+} // namespace string_utils
+} // namespace mystic
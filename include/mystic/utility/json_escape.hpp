@@ -0,0 +1,270 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/utility/json_escape.hpp
+ * @file json_escape.hpp
+ * @brief Defines SIMD JSON string escaping.
+ *
+ * @details
+ * This header provides JSON string escaping. Input is scanned 64 (AVX512BW),
+ * 32 (AVX2), 16 (NEON), or 8 (SWAR) bytes at a time for quotes,
+ * backslashes, and control characters, and clean runs in between are
+ * copied in bulk. Bytes >= 0x80 (UTF-8) are passed through unchanged.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/utility/json_escape.hpp"
+ *
+ * char out[mystic::string_utils::json_escaped_max_size(64)];
+ * auto size = mystic::string_utils::escape_json(message, out);
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstring>
+#include <string_view>
+
+#include "mystic/architecture/simd_detection.hpp"
+#include "mystic/attributes/forceinline.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+#include "mystic/utility/bit.hpp"
+
+#if MYSTIC_ARCH_SIMD_HAS_AVX2
+# include <immintrin.h>
+#elif MYSTIC_ARCH_SIMD_HAS_NEON
+# include <arm_neon.h>
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::string_utils
+ * @brief String utility functions.
+ */
+namespace string_utils {
+
+/**
+ * @namespace mystic::string_utils::internal
+ * @brief Implementation details, not part of the public interface.
+ */
+namespace internal {
+
+/**
+ * @brief Returns the second character of the short escape of a byte,
+ * 'u' if it needs `\u00XX`, or 0 if it needs no escape.
+ */
+constexpr inline char json_escape_code(unsigned char c) noexcept {
+    switch (c) {
+        case '"':  return '"';
+        case '\\': return '\\';
+        case '\b': return 'b';
+        case '\f': return 'f';
+        case '\n': return 'n';
+        case '\r': return 'r';
+        case '\t': return 't';
+        default:   return (c < 0x20) ? 'u' : 0;
+    }
+}
+
+/**
+ * @brief Returns true if a byte must be escaped.
+ */
+constexpr inline bool json_needs_escape(unsigned char c) noexcept {
+    return (c < 0x20) || (c == '"') || (c == '\\');
+}
+
+/**
+ * @brief Returns the index of the first byte that must be escaped, or size.
+ */
+inline ::mystic::types::size_t find_json_escape(const char* data, ::mystic::types::size_t size) noexcept {
+    ::mystic::types::size_t i = 0;
+
+#if MYSTIC_ARCH_SIMD_HAS_AVX512BW
+    const __m512i quote = _mm512_set1_epi8('"');
+    const __m512i backslash = _mm512_set1_epi8('\\');
+    const __m512i space = _mm512_set1_epi8(0x20);
+
+    for (; i + 64 <= size; i += 64) {
+        const __m512i v = _mm512_loadu_si512(reinterpret_cast<const void*>(data + i));
+        const __mmask64 mask = _mm512_cmpeq_epi8_mask(v, quote) |
+                               _mm512_cmpeq_epi8_mask(v, backslash) |
+                               _mm512_cmplt_epu8_mask(v, space);
+        if (mask != 0) {
+            return i + static_cast<::mystic::types::size_t>(
+                ::mystic::bit::countr_zero(static_cast<::mystic::types::uint64_t>(mask)));
+        }
+    }
+#endif
+
+#if MYSTIC_ARCH_SIMD_HAS_AVX2
+    const __m256i quote32 = _mm256_set1_epi8('"');
+    const __m256i backslash32 = _mm256_set1_epi8('\\');
+    const __m256i control32 = _mm256_set1_epi8(0x1F);
+
+    for (; i + 32 <= size; i += 32) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        // v <= 0x1F (unsigned) <=> min(v, 0x1F) == v.
+        const __m256i hits = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, quote32), _mm256_cmpeq_epi8(v, backslash32)),
+            _mm256_cmpeq_epi8(_mm256_min_epu8(v, control32), v));
+        const ::mystic::types::uint32_t mask = static_cast<::mystic::types::uint32_t>(_mm256_movemask_epi8(hits));
+        if (mask != 0) {
+            return i + static_cast<::mystic::types::size_t>(::mystic::bit::countr_zero(mask));
+        }
+    }
+#elif MYSTIC_ARCH_SIMD_HAS_NEON
+    const uint8x16_t quote = vdupq_n_u8('"');
+    const uint8x16_t backslash = vdupq_n_u8('\\');
+    const uint8x16_t space = vdupq_n_u8(0x20);
+
+    for (; i + 16 <= size; i += 16) {
+        const uint8x16_t v = vld1q_u8(reinterpret_cast<const ::mystic::types::uint8_t*>(data + i));
+        const uint8x16_t hits = vorrq_u8(vorrq_u8(vceqq_u8(v, quote), vceqq_u8(v, backslash)),
+                                         vcltq_u8(v, space));
+        // Narrow to 4 bits per byte, so the mask fits one 64-bit lane.
+        const ::mystic::types::uint64_t mask = vget_lane_u64(
+            vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(hits), 4)), 0);
+        if (mask != 0) {
+            return i + static_cast<::mystic::types::size_t>(::mystic::bit::countr_zero(mask) >> 2);
+        }
+    }
+#endif
+
+    // SWAR tail (and scalar builds), 8 bytes at a time.
+    constexpr ::mystic::types::uint64_t kOnes  = 0x0101010101010101ULL;
+    constexpr ::mystic::types::uint64_t kHighs = 0x8080808080808080ULL;
+
+    for (; i + 8 <= size; i += 8) {
+        ::mystic::types::uint64_t word = 0;
+        ::std::memcpy(&word, data + i, sizeof(word));
+
+        const ::mystic::types::uint64_t quote_x = word ^ (kOnes * '"');
+        const ::mystic::types::uint64_t slash_x = word ^ (kOnes * '\\');
+        const ::mystic::types::uint64_t hits = ((quote_x - kOnes) & ~quote_x) |
+                                               ((slash_x - kOnes) & ~slash_x) |
+                                               ((word - (kOnes * 0x20)) & ~word);
+        if ((hits & kHighs) != 0) {
+            break;
+        }
+    }
+
+    for (; i < size; ++i) {
+        if (json_needs_escape(static_cast<unsigned char>(data[i]))) {
+            return i;
+        }
+    }
+    return size;
+}
+
+/**
+ * @brief Writes the escape sequence of a byte, returns its length.
+ */
+MYSTIC_FORCEINLINE inline ::mystic::types::size_t write_json_escape(char* out, unsigned char c) noexcept {
+    constexpr char kHex[] = "0123456789abcdef";
+    const char code = json_escape_code(c);
+
+    out[0] = '\\';
+    if (code != 'u') {
+        out[1] = code;
+        return 2;
+    }
+    out[1] = 'u';
+    out[2] = '0';
+    out[3] = '0';
+    out[4] = kHex[c >> 4];
+    out[5] = kHex[c & 0x0F];
+    return 6;
+}
+
+} // namespace internal
+
+/**
+ * @brief Worst-case escaped size of `size` input bytes (`\u00XX` per byte).
+ */
+constexpr inline ::mystic::types::size_t json_escaped_max_size(::mystic::types::size_t size) noexcept {
+    return size * 6;
+}
+
+/**
+ * @brief Escapes a string for use inside JSON quotes.
+ *
+ * @param str The given string.
+ * @param out Destination of at least `json_escaped_max_size(str.size())` bytes.
+ *
+ * @returns Number of bytes written (quotes are not added).
+ */
+inline ::mystic::types::size_t escape_json(::std::string_view str, char* out) noexcept {
+    const char* data = str.data();
+    const ::mystic::types::size_t size = str.size();
+    char* cursor = out;
+    ::mystic::types::size_t i = 0;
+
+    while (i < size) {
+        const ::mystic::types::size_t clean = internal::find_json_escape(data + i, size - i);
+        ::std::memcpy(cursor, data + i, clean);
+        cursor += clean;
+        i += clean;
+
+        if (i < size) {
+            cursor += internal::write_json_escape(cursor, static_cast<unsigned char>(data[i]));
+            ++i;
+        }
+    }
+    return static_cast<::mystic::types::size_t>(cursor - out);
+}
+
+/**
+ * @brief Escapes a string into a writer exposing `write(const char*, size_t)`.
+ *
+ * @details
+ * Used to escape directly into bounded writers (e.g. `mystic::FormatWriter`)
+ * without an intermediate buffer.
+ *
+ * @param writer The destination writer.
+ * @param str The given string.
+ */
+template <typename Writer>
+inline void escape_json_to(Writer& writer, ::std::string_view str) {
+    const char* data = str.data();
+    const ::mystic::types::size_t size = str.size();
+    ::mystic::types::size_t i = 0;
+
+    while (i < size) {
+        const ::mystic::types::size_t clean = internal::find_json_escape(data + i, size - i);
+        writer.write(data + i, clean);
+        i += clean;
+
+        if (i < size) {
+            char escape[6];
+            writer.write(escape, internal::write_json_escape(escape, static_cast<unsigned char>(data[i])));
+            ++i;
+        }
+    }
+}
+
+} // namespace string_utils
+} // namespace mystic
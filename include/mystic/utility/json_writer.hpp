@@ -0,0 +1,365 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/utility/json_writer.hpp
+ * @file json_writer.hpp
+ * @brief Defines an allocation-free JSON writer.
+ *
+ * @details
+ * This header provides `mystic::JsonWriter`, a streaming writer for JSON
+ * objects, and arrays into caller-provided storage. Strings are escaped with
+ * `mystic::string_utils::escape_json_to`, numbers go through the format
+ * engine, and commas are tracked with one bit per nesting level, so no
+ * allocation happens at any point.
+ *
+ * Output past the capacity is dropped, but still counted, so truncation
+ * can be detected, and the required size learned.
+ *
+ * @code {.cpp}
+ * // Example
+ * #include "mystic/utility/json_writer.hpp"
+ *
+ * char buffer[512];
+ * mystic::JsonWriter json(buffer, sizeof(buffer));
+ * json.begin_object()
+ *     .field("level", "info")
+ *     .field("latency_ms", 1.25)
+ *     .key("tags").begin_array().value("db").value("read").end_array()
+ *     .end_object();
+ * if (!json.truncated()) {
+ *     write(fd, json.data(), json.size());
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+#include "mystic/utility/format.hpp"
+#include "mystic/utility/json_escape.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @brief Streaming JSON writer over a bounded buffer.
+ *
+ * @details
+ * Calls must form a well-nested document; the writer inserts commas,
+ * and colons, but does not validate the call sequence. Nesting deeper
+ * than `kMaxDepth`, or closing more than was opened, marks the writer
+ * `failed()`, after which every call is a no-op. NaN, infinities, and
+ * null `const char*` strings are written as `null`.
+ */
+class JsonWriter {
+public:
+    /// Maximum supported nesting depth.
+    static constexpr ::mystic::types::size_t kMaxDepth = 64;
+
+    JsonWriter(char* buffer, ::mystic::types::size_t capacity) noexcept
+        : buffer_(buffer), capacity_(capacity), out_(buffer, capacity) {}
+
+    JsonWriter(const JsonWriter&) = delete;
+    JsonWriter& operator=(const JsonWriter&) = delete;
+
+    /* =============================================
+        Structure
+       --------------------------------------------- */
+
+    /**
+     * @brief Opens an object.
+     */
+    JsonWriter& begin_object() noexcept {
+        open('{');
+        return *this;
+    }
+
+    /**
+     * @brief Closes the innermost object.
+     */
+    JsonWriter& end_object() noexcept {
+        close('}');
+        return *this;
+    }
+
+    /**
+     * @brief Opens an array.
+     */
+    JsonWriter& begin_array() noexcept {
+        open('[');
+        return *this;
+    }
+
+    /**
+     * @brief Closes the innermost array.
+     */
+    JsonWriter& end_array() noexcept {
+        close(']');
+        return *this;
+    }
+
+    /**
+     * @brief Writes an object key, the next call writes its value.
+     */
+    JsonWriter& key(::std::string_view name) noexcept {
+        if (!separate()) {
+            return *this;
+        }
+        write_string(name);
+        out_.put(':');
+        after_key_ = true;
+        return *this;
+    }
+
+    /* =============================================
+        Values
+       --------------------------------------------- */
+
+    /**
+     * @brief Writes a string value.
+     */
+    JsonWriter& value(::std::string_view str) noexcept {
+        if (!separate()) {
+            return *this;
+        }
+        write_string(str);
+        return *this;
+    }
+
+    /**
+     * @brief Writes a string value, or `null` for a null pointer (keeps literals away from the bool overload).
+     */
+    JsonWriter& value(const char* str) noexcept {
+        if (str == nullptr) {
+            return null_value();
+        }
+        return value(::std::string_view(str));
+    }
+
+    /**
+     * @brief Writes `true` or `false`.
+     */
+    JsonWriter& value(bool flag) noexcept {
+        if (!separate()) {
+            return *this;
+        }
+        out_.write(flag ? ::std::string_view("true") : ::std::string_view("false"));
+        return *this;
+    }
+
+    /**
+     * @brief Writes `null`.
+     */
+    JsonWriter& value(::std::nullptr_t) noexcept {
+        return null_value();
+    }
+
+    /**
+     * @brief Writes a one-character string (escaped like any string).
+     */
+    JsonWriter& value(char c) noexcept {
+        return value(::std::string_view(&c, 1));
+    }
+
+    /**
+     * @brief Writes an integer, or floating point number.
+     *
+     * @details
+     * `signed char`, and `unsigned char` are `int8_t`, and `uint8_t`, so
+     * they are numbers; only plain `char` is written as a string.
+     */
+    template <typename Number,
+              typename = ::std::enable_if_t<::std::is_arithmetic<Number>::value &&
+                                            !::std::is_same<Number, bool>::value &&
+                                            !::std::is_same<Number, char>::value>>
+    JsonWriter& value(Number number) noexcept {
+        static_assert(!::std::is_same<Number, wchar_t>::value && !::std::is_same<Number, char16_t>::value &&
+                          !::std::is_same<Number, char32_t>::value,
+                      "JsonWriter writes text as UTF-8; pass a string, not a wide character");
+        if (!separate()) {
+            return *this;
+        }
+        if constexpr (::std::is_floating_point<Number>::value) {
+            if (!::std::isfinite(number)) {
+                out_.write(::std::string_view("null"));
+                return *this;
+            }
+            internal::format_float(out_, number, FormatSpec{});
+        } else {
+            internal::format_integer(out_, number, FormatSpec{});
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Writes `null`.
+     */
+    JsonWriter& null_value() noexcept {
+        if (!separate()) {
+            return *this;
+        }
+        out_.write(::std::string_view("null"));
+        return *this;
+    }
+
+    /**
+     * @brief Writes already serialized JSON as a value, verbatim.
+     */
+    JsonWriter& raw_value(::std::string_view json) noexcept {
+        if (!separate()) {
+            return *this;
+        }
+        out_.write(json);
+        return *this;
+    }
+
+    /**
+     * @brief Writes a key, and its value.
+     */
+    template <typename Value>
+    JsonWriter& field(::std::string_view name, const Value& val) noexcept {
+        key(name);
+        return value(val);
+    }
+
+    /* =============================================
+        Output
+       --------------------------------------------- */
+
+    /**
+     * @brief Returns the start of the output.
+     */
+    const char* data() const noexcept {
+        return buffer_;
+    }
+
+    /**
+     * @brief Returns the number of bytes actually stored.
+     */
+    ::mystic::types::size_t size() const noexcept {
+        return static_cast<::mystic::types::size_t>(out_.out() - buffer_);
+    }
+
+    /**
+     * @brief Returns the size the complete output needs.
+     */
+    ::mystic::types::size_t required_size() const noexcept {
+        return out_.size();
+    }
+
+    /**
+     * @brief Returns true if output was dropped for lack of capacity.
+     */
+    bool truncated() const noexcept {
+        return out_.size() > capacity_;
+    }
+
+    /**
+     * @brief Returns true if the nesting limit was exceeded, or a close was unmatched.
+     */
+    bool failed() const noexcept {
+        return failed_;
+    }
+
+    /**
+     * @brief Returns the stored output as a view.
+     */
+    ::std::string_view view() const noexcept {
+        return ::std::string_view(buffer_, size());
+    }
+
+private:
+    /**
+     * @brief Emits the comma (if any) due before the next element.
+     *
+     * @returns False if the writer has failed, and nothing may be written.
+     */
+    bool separate() noexcept {
+        if (failed_) {
+            return false;
+        }
+        if (after_key_) {
+            after_key_ = false;
+            return true;
+        }
+        if (depth_ == 0) {
+            return true;
+        }
+
+        const ::mystic::types::uint64_t bit = ::mystic::types::uint64_t(1) << (depth_ - 1);
+        if ((non_empty_ & bit) != 0) {
+            out_.put(',');
+        } else {
+            non_empty_ |= bit;
+        }
+        return true;
+    }
+
+    void open(char bracket) noexcept {
+        if (depth_ >= kMaxDepth) {
+            failed_ = true;
+        }
+        if (!separate()) {
+            return;
+        }
+        out_.put(bracket);
+        ++depth_;
+        non_empty_ &= ~(::mystic::types::uint64_t(1) << (depth_ - 1));
+    }
+
+    void close(char bracket) noexcept {
+        if (depth_ == 0) {
+            failed_ = true;
+        }
+        if (failed_) {
+            return;
+        }
+        --depth_;
+        out_.put(bracket);
+    }
+
+    void write_string(::std::string_view str) noexcept {
+        out_.put('"');
+        ::mystic::string_utils::escape_json_to(out_, str);
+        out_.put('"');
+    }
+
+    char* buffer_;
+    ::mystic::types::size_t capacity_;
+    FormatWriter out_;
+
+    /// Bit `n` is set once level `n + 1` has an element.
+    ::mystic::types::uint64_t non_empty_ = 0;
+    ::mystic::types::uint32_t depth_ = 0;
+    bool after_key_ = false;
+    bool failed_ = false;
+};
+
+} // namespace mystic